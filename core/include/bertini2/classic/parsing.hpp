@@ -310,7 +310,8 @@ namespace bertini
                     
                     root_rule_.name("CommentStripper_root_rule");
                     
-                    root_rule_ = eps[_val = ""] >> *line_[_val = _val + _1 + "\n"] >> -last_line_[_val = _val + _1 + "\n"];//+line_ | qi::eoi;
+                    // append in place.  building _val + _1 + "\n" would copy everything stripped so far, for every line.
+                    root_rule_ = eps[_val = ""] >> *line_[_val += _1, _val += "\n"] >> -last_line_[_val += _1, _val += "\n"];//+line_ | qi::eoi;
                     
                     
                     line_.name("line_of_commented_input");
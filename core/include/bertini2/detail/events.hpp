@@ -41,9 +41,46 @@
 
 #ifndef BERTINI_DETAIL_EVENTS_HPP
 #define BERTINI_DETAIL_EVENTS_HPP
+#include <cstdint>
 #include <boost/type_index.hpp>
 namespace bertini {
 
+	/**
+	\brief A set of event types, one bit per type.
+
+	Each event type has its own bit, `Bit`, and a mask `Mask` which is its own bit together with the bits of all its ancestors in the event hierarchy.  An event is delivered to an observer if its `Mask` intersects the set of events the observer observes, so observing a type means observing all the types derived from it.
+
+	\see AnyObserver::ObservedEvents, Observable::Emit, EventBits
+	*/
+	using EventMask = std::uint64_t;
+
+	/**
+	\brief The set of all event types.
+	*/
+	constexpr EventMask AllEvents = ~EventMask(0);
+
+	/**
+	\brief The bit for the event type with a given index.  Indices are from 0 to 63.
+	*/
+	constexpr EventMask EventBit(unsigned index)
+	{
+		return EventMask(1) << index;
+	}
+
+	/**
+	\brief The set of event types made of the given types, and all types derived from them.
+
+	\tparam EventTs The event types.  The observed type they are instantiated with is irrelevant.
+	*/
+	template<typename... EventTs>
+	constexpr EventMask EventBits()
+	{
+		EventMask bits = 0;
+		for (auto b : {EventMask(0), EventTs::Bit...})
+			bits |= b;
+		return bits;
+	}
+
 	/**
 	\brief Strawman Event type, enabling polymorphism.
 
@@ -52,15 +89,18 @@ namespace bertini {
 	class AnyEvent
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		static constexpr EventMask Bit = 0;
+		static constexpr EventMask Mask = AllEvents; ///< An event whose type is not known statically goes to every observer.
+
 		virtual ~AnyEvent() = default;
 	};
 
 	/**
 	\brief For emission of events from observables.
 	
-	An observable object probably wants to emit events to notify observers that things are happening.  The observers filter the events, at this time by dynamic casting (slow, I know, but it works for now.  Premature optimization, etc.)  A better method than dynamic casting would be to filter based on a union of bits or something.  If you, the reader, want to help make this better, please contact a developer!
+	An observable object probably wants to emit events to notify observers that things are happening.  Events are first filtered by the observable, which only builds and delivers an event to observers whose ObservedEvents intersect the event's Mask.  Observers then tell apart the events they receive by dynamic casting, which is now only paid for events they asked for.
 
-	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers(Event<T>(*this))`.  Then an Observer can filter based on a heirarchy of event types, etc.  
+	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `Emit<Event<T>>(*this)`.  Then an Observer can filter based on a heirarchy of event types, etc.  
 
 	\tparam ObsT The Observed type.  When emitting an event, you pass in the type of object emitting the event, and the object itself.  Then the observer can `Get` the emitting object, and do (const) stuff to it.
 
@@ -70,6 +110,8 @@ namespace bertini {
 	class Event : public AnyEvent
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		static constexpr EventMask Bit = EventBit(0);
+		static constexpr EventMask Mask = Bit;
 
 		/**
 		\brief Constructor for an event.  
@@ -98,19 +140,27 @@ namespace bertini {
 		
 	};
 
+	template<class ObsT> constexpr EventMask Event<ObsT>::Bit;
+	template<class ObsT> constexpr EventMask Event<ObsT>::Mask;
+
 	/**
 	\brief Defines a new event type in a hierarchy
 
 	\param event_name The name of the new Event type you are making.
 	\param event_parenttype The name of the parent Event type in the heirarchy.
+	\param event_index The index of the bit for the new type, unique among all event types.  Index 0 is Event.
 	*/
-	#define ADD_BERTINI_EVENT_TYPE(event_name,event_parenttype) template<class ObservedT> \
+	#define ADD_BERTINI_EVENT_TYPE(event_name,event_parenttype,event_index) template<class ObservedT> \
 	class event_name : public event_parenttype<ObservedT> \
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS \
 	public: \
+		static constexpr EventMask Bit = EventBit(event_index); \
+		static constexpr EventMask Mask = Bit | event_parenttype<ObservedT>::Mask; \
 		event_name(const ObservedT & obs) : event_parenttype<ObservedT>(obs){} \
 		virtual ~event_name() = default; \
-		event_name() = delete; }
+		event_name() = delete; }; \
+	template<class ObservedT> constexpr EventMask event_name<ObservedT>::Bit; \
+	template<class ObservedT> constexpr EventMask event_name<ObservedT>::Mask
 	
 } //re: namespace bertini
 
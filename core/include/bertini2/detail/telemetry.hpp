@@ -0,0 +1,329 @@
+//This file is part of Bertini 2.
+//
+//telemetry.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//telemetry.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with telemetry.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file detail/telemetry.hpp
+
+\brief Per-thread counters and phase timers, for seeing where the time goes in a solve.
+
+Instrumented code calls BERTINI_TELEMETRY_INCREMENT and BERTINI_TELEMETRY_TIME.  Each thread counts into its own block, without locking or atomic read-modify-writes, and TakeSnapshot merges the blocks of all threads on demand.  Define BERTINI_DISABLE_TELEMETRY to compile the instrumentation out entirely; the snapshot API remains, and reports zeros.
+
+\code
+auto before = telemetry::TakeSnapshot();
+tracker.TrackPath(result, t_start, t_end, start_point);
+auto used = telemetry::TakeSnapshot() - before;
+std::cout << used.Count(telemetry::Counter::NewtonIterations) << " Newton iterations\n";
+\endcode
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <type_traits>
+
+namespace bertini {
+
+	namespace telemetry {
+
+		/**
+		\brief The things counted.
+		*/
+		enum class Counter : unsigned
+		{
+			SystemEvaluationsDouble, ///< Evaluations of a System's functions, in double precision.
+			SystemEvaluationsMultiple, ///< Evaluations of a System's functions, in multiple precision.
+			JacobianEvaluationsDouble, ///< Evaluations of a System's Jacobian, in double precision.
+			JacobianEvaluationsMultiple, ///< Evaluations of a System's Jacobian, in multiple precision.
+			LUFactorizations, ///< LU factorizations of Jacobians, by predictors and correctors.
+			LinearSolves, ///< Solves using an LU factorization, by predictors and correctors.
+			NewtonIterations, ///< Iterations of Newton's method.
+			PredictorStages, ///< Stages of explicit Runge-Kutta predictors.
+			PrecisionIncreases, ///< Increases of precision by the AMPTracker.
+			PrecisionDecreases, ///< Decreases of precision by the AMPTracker.
+			EndgameSamples, ///< Samples computed by endgames, including points around Cauchy loops.
+			EndgameLoopClosures, ///< Successful closures of loops around the origin by the Cauchy endgame.
+			NumCounters ///< Not a counter; the number of counters.
+		};
+
+		/**
+		\brief The phases timed.  Phases nest; tracking during an endgame is counted in both.
+		*/
+		enum class Phase : unsigned
+		{
+			Tracking, ///< Stepping along a path, in Tracker::StepPath.
+			Prediction, ///< Predicting the next point, in a tracker's Predict.
+			Correction, ///< Correcting a predicted point, in a tracker's Correct.
+			Endgame, ///< Running an endgame.
+			NumPhases ///< Not a phase; the number of phases.
+		};
+
+		constexpr unsigned NumCounters = static_cast<unsigned>(Counter::NumCounters);
+		constexpr unsigned NumPhases = static_cast<unsigned>(Phase::NumPhases);
+
+		/**
+		\brief The name of a counter, such as "newton_iterations".
+		*/
+		const char* Name(Counter c);
+
+		/**
+		\brief The name of a phase, such as "tracking".
+		*/
+		const char* Name(Phase p);
+
+		/**
+		\brief Pick the counter for the precision of a number type.
+
+		\tparam T The number type, such as dbl or mpfr.
+		\param double_counter The counter to use for double precision.
+		\param multiple_counter The counter to use for multiple precision.
+		*/
+		template<typename T>
+		constexpr Counter ByPrecision(Counter double_counter, Counter multiple_counter)
+		{
+			return (std::is_same<T, std::complex<double>>::value || std::is_same<T, double>::value) ? double_counter : multiple_counter;
+		}
+
+
+		/**
+		\brief Whether telemetry was compiled in.
+		*/
+		constexpr bool Enabled()
+		{
+		#ifdef BERTINI_DISABLE_TELEMETRY
+			return false;
+		#else
+			return true;
+		#endif
+		}
+
+
+		/**
+		\brief The merged counts and times of all threads, at some moment.
+		*/
+		struct Snapshot
+		{
+			std::array<std::uint64_t, NumCounters> counts{}; ///< The counts, indexed by Counter.
+			std::array<std::uint64_t, NumPhases> phase_nanoseconds{}; ///< The time spent in each phase, indexed by Phase.
+			std::array<std::uint64_t, NumPhases> phase_entries{}; ///< The number of times each phase was entered, indexed by Phase.
+
+			/**
+			\brief Get a count.
+			*/
+			std::uint64_t Count(Counter c) const
+			{
+				return counts[static_cast<unsigned>(c)];
+			}
+
+			/**
+			\brief Get the time spent in a phase, in seconds, summed over threads.
+			*/
+			double Seconds(Phase p) const
+			{
+				return phase_nanoseconds[static_cast<unsigned>(p)] * 1e-9;
+			}
+
+			/**
+			\brief Get the number of times a phase was entered.
+			*/
+			std::uint64_t Entries(Phase p) const
+			{
+				return phase_entries[static_cast<unsigned>(p)];
+			}
+
+			/**
+			\brief The counts and times accumulated since an earlier snapshot.
+			*/
+			Snapshot operator-(Snapshot const& earlier) const
+			{
+				Snapshot difference;
+				for (unsigned ii = 0; ii < NumCounters; ++ii)
+					difference.counts[ii] = counts[ii] - earlier.counts[ii];
+				for (unsigned ii = 0; ii < NumPhases; ++ii)
+				{
+					difference.phase_nanoseconds[ii] = phase_nanoseconds[ii] - earlier.phase_nanoseconds[ii];
+					difference.phase_entries[ii] = phase_entries[ii] - earlier.phase_entries[ii];
+				}
+				return difference;
+			}
+		};
+
+
+		/**
+		\brief Merge the counts and times of all threads, including threads which have finished.
+
+		May be called at any time, from any thread.  Counts being incremented while the snapshot is taken may or may not be included.
+		*/
+		Snapshot TakeSnapshot();
+
+		/**
+		\brief Zero the counts and times of all threads.
+
+		Increments made by other threads while resetting may be lost, so reset when no solve is running.
+		*/
+		void Reset();
+
+
+
+		namespace detail {
+
+			/**
+			\brief The counts and times of one thread.
+
+			Only the owning thread writes, so increments are a relaxed load and store rather than a locked read-modify-write.  Other threads only read, when taking snapshots.
+			*/
+			struct ThreadCounters
+			{
+				std::array<std::atomic<std::uint64_t>, NumCounters> counts;
+				std::array<std::atomic<std::uint64_t>, NumPhases> phase_nanoseconds;
+				std::array<std::atomic<std::uint64_t>, NumPhases> phase_entries;
+
+				ThreadCounters()
+				{
+					Zero();
+				}
+
+				void Zero()
+				{
+					for (auto& c : counts)
+						c.store(0, std::memory_order_relaxed);
+					for (auto& c : phase_nanoseconds)
+						c.store(0, std::memory_order_relaxed);
+					for (auto& c : phase_entries)
+						c.store(0, std::memory_order_relaxed);
+				}
+			};
+
+			/**
+			\brief Get a block of counters for a new thread.
+			*/
+			ThreadCounters* AcquireThreadCounters();
+
+			/**
+			\brief Give back the block of a finishing thread.  Its counts are kept, and the block is reused.
+			*/
+			void ReleaseThreadCounters(ThreadCounters* counters);
+
+			/**
+			\brief Holds the block of counters of one thread, for the life of the thread.
+			*/
+			struct ThreadRegistration
+			{
+				ThreadCounters* const counters;
+
+				ThreadRegistration() : counters(AcquireThreadCounters())
+				{}
+
+				~ThreadRegistration()
+				{
+					ReleaseThreadCounters(counters);
+				}
+			};
+
+			/**
+			\brief The counters of the calling thread.
+			*/
+			inline
+			ThreadCounters& Local()
+			{
+				thread_local ThreadRegistration registration;
+				return *registration.counters;
+			}
+
+			inline
+			void Add(std::atomic<std::uint64_t> & counter, std::uint64_t amount)
+			{
+				counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+			}
+
+			inline
+			void Increment(Counter c)
+			{
+				Add(Local().counts[static_cast<unsigned>(c)], 1);
+			}
+
+			/**
+			\brief Adds the time between its construction and destruction to a phase.
+			*/
+			class PhaseTimer
+			{
+			public:
+				PhaseTimer(Phase p) : phase_(static_cast<unsigned>(p)), start_(std::chrono::steady_clock::now())
+				{}
+
+				~PhaseTimer()
+				{
+					auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count();
+					auto& local = Local();
+					Add(local.phase_nanoseconds[phase_], static_cast<std::uint64_t>(elapsed));
+					Add(local.phase_entries[phase_], 1);
+				}
+
+				PhaseTimer(PhaseTimer const&) = delete;
+				PhaseTimer& operator=(PhaseTimer const&) = delete;
+
+			private:
+				const unsigned phase_;
+				const std::chrono::steady_clock::time_point start_;
+			};
+
+		} // re: namespace detail
+
+	} // re: namespace telemetry
+} // re: namespace bertini
+
+
+
+#define BERTINI_TELEMETRY_CONCAT_IMPL(a,b) a##b
+#define BERTINI_TELEMETRY_CONCAT(a,b) BERTINI_TELEMETRY_CONCAT_IMPL(a,b)
+
+#ifdef BERTINI_DISABLE_TELEMETRY
+
+	#define BERTINI_TELEMETRY_INCREMENT(counter) ((void)0)
+	#define BERTINI_TELEMETRY_TIME(phase) ((void)0)
+
+#else
+
+	/**
+	\brief Count one occurrence, on the calling thread.
+
+	\param counter A bertini::telemetry::Counter.
+	*/
+	#define BERTINI_TELEMETRY_INCREMENT(counter) ::bertini::telemetry::detail::Increment(counter)
+
+	/**
+	\brief Time the rest of the enclosing scope as a phase, on the calling thread.
+
+	\param phase A bertini::telemetry::Phase.
+	*/
+	#define BERTINI_TELEMETRY_TIME(phase) ::bertini::telemetry::detail::PhaseTimer BERTINI_TELEMETRY_CONCAT(bertini_telemetry_timer_,__LINE__)(phase)
+
+#endif
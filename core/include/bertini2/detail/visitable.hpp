@@ -33,6 +33,9 @@
 #ifndef BERTINI_DETAIL_VISITABLE_HPP
 #define BERTINI_DETAIL_VISITABLE_HPP
 
+#include <utility>
+#include <vector>
+
 #include "bertini2/detail/visitor.hpp"
 #include "bertini2/detail/events.hpp"
 
@@ -118,6 +121,8 @@ namespace bertini{
 	
 	Some known observable types are Tracker and Endgame.
 
+	Each observer declares the events it wants, by AnyObserver::ObservedEvents, and an event is only built and delivered if some observer wants it.  So with no observers attached, emitting an event costs one test of an integer.
+
 	\tparam RetT The return type of the Visit method of the observer or visitor.  Default is `void`.
 	\tparam CatchAll The policy to be invoked when the visited type doesn't know the visitor.  Default is the DefaultCatchAll.
 	*/
@@ -131,35 +136,83 @@ namespace bertini{
 
 		/**
 		\brief Add an observer, to observe this observable.
+
+		The observer's ObservedEvents are queried now, so they should not change while it is attached.
 		*/
 		void AddObserver(AnyObserver* new_observer)
 		{
-			current_watchers_.push_back(new_observer);
+			auto observed = new_observer->ObservedEvents();
+			current_watchers_.push_back(std::make_pair(new_observer, observed));
+			observed_events_ |= observed;
+		}
+
+
+		/**
+		\brief Detach all observers.  Useful on a copy, which otherwise notifies the same observers as the original.
+		*/
+		void ClearObservers()
+		{
+			current_watchers_.clear();
+			observed_events_ = 0;
+		}
+
+
+		/**
+		\brief Query whether any attached observer wants events of a type.
+
+		\tparam EventT The type of event.
+		*/
+		template<typename EventT>
+		bool IsObserved() const
+		{
+			return (observed_events_ & EventT::Mask) != 0;
 		}
 
 	protected:
 
 		/**
-		\brief Sends an Event (more particularly, AnyEvent) to all watching observers of this object.
+		\brief Build an event and send it to the observers which want it, if there are any.
 
-		This function could potentially be improved by filtering on the observer's desired event types, if known at compile time.  This could potentially be a performance bottleneck (hopefully not!) since filtering can use `dynamic_cast`ing.  One hopes this cost is overwhelmed by things like linear algebra and system evaluation.
+		This is the way to emit events.  Nothing is built if no observer wants the event, and observers are only sent the events they want.
 
-		\param e The event to emit.  Its type should be derived from AnyEvent.
+		\tparam EventT The type of event to emit.  Must be derived from AnyEvent, and have a Mask.
+		\param args The arguments to the event's constructor, usually starting with `*this`.
 		*/
-		void NotifyObservers(AnyEvent const& e) const
+		template<typename EventT, typename... ArgTs>
+		void Emit(ArgTs const&... args) const
 		{
+			if (!IsObserved<EventT>())
+				return;
 
+			EventT e(args...);
 			for (auto& obs : current_watchers_)
-				obs->Observe(e);
+				if (obs.second & EventT::Mask)
+					obs.first->Observe(e);
+		}
+
 
+		/**
+		\brief Sends an already-built Event to the watching observers which want it.
+
+		Prefer Emit, which does not build the event unless it is wanted.
+
+		\param e The event to emit.  Its type should be derived from AnyEvent.  Filtering is by its static type.
+		*/
+		template<typename EventT>
+		void NotifyObservers(EventT const& e) const
+		{
+			for (auto& obs : current_watchers_)
+				if (obs.second & EventT::Mask)
+					obs.first->Observe(e);
 		}
 
 
 	private:
 
-		using ObserverContainer = std::vector<AnyObserver*>;
+		using ObserverContainer = std::vector<std::pair<AnyObserver*, EventMask>>;
 
-		ObserverContainer current_watchers_;
+		ObserverContainer current_watchers_; ///< The observers, together with the events each wants.
+		EventMask observed_events_ = 0; ///< The union of the events wanted by all observers.
 	};
 
 } // namespace bertini
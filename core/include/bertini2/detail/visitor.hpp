@@ -95,6 +95,16 @@ namespace bertini{
 		\param e The event which was emitted by the observed object.
 		*/
 		virtual void Observe(AnyEvent const& e) = 0;
+
+		/**
+		\brief The set of event types this observer wants to Observe.
+
+		Observables consult this once, when the observer is added, and never build or deliver events outside it.  The default is all events.  Override it to return, for example, `EventBits<SuccessfulStep<T>, FailedStep<T>>()`, so that tracking is not slowed by events the observer would ignore.
+		*/
+		virtual EventMask ObservedEvents() const
+		{
+			return AllEvents;
+		}
 	};
 
 
@@ -155,6 +165,18 @@ namespace bertini{
 		    for_each(observers_, f);
 		}
 
+		/**
+		\brief The union of the events observed by the types you glued together.
+		*/
+		EventMask ObservedEvents() const override
+		{
+			using namespace boost::fusion;
+			EventMask observed = 0;
+		    auto f = [&observed](auto const& obs) { observed |= obs.ObservedEvents(); };
+		    for_each(observers_, f);
+		    return observed;
+		}
+
 		std::tuple<ObserverTypes<ObservedT>...> observers_;
 		virtual ~MultiObserver() = default;
 	};
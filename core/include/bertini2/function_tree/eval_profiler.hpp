@@ -0,0 +1,233 @@
+//This file is part of Bertini 2.
+//
+//eval_profiler.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//eval_profiler.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with eval_profiler.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+/**
+\file eval_profiler.hpp
+
+\brief Provides EvalProfile, an opt-in profiler recording the number of fresh evaluations of, and the time spent in, each node of a function tree.
+
+Profiling is per thread.  While a ScopedEvalProfiling is alive, every fresh evaluation of a node on its thread, in either precision, is recorded into its EvalProfile.  When no profile is active, the cost is one check of a thread-local pointer per fresh evaluation.  Define BERTINI_DISABLE_TELEMETRY to compile the check out.
+
+\code
+EvalProfile profile;
+{
+	ScopedEvalProfiling profiling(profile);
+	for (unsigned ii = 0; ii < 100; ++ii)
+	{
+		sys.Eval(x);
+		sys.Jacobian(x);
+	}
+}
+std::ofstream flames("eval.folded");
+profile.WriteFoldedStacks(flames); // then flamegraph.pl eval.folded > eval.svg
+\endcode
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_EVAL_PROFILER_HPP
+#define BERTINI_FUNCTION_TREE_EVAL_PROFILER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bertini {
+namespace node {
+
+	class Node;
+	class Variable;
+
+	/**
+	\brief Call counts and times of the fresh evaluations of the nodes of function trees, recorded on one thread.
+
+	The record is a call tree.  Its roots are the nodes evaluated directly, which for a System are the functions and the Jacobian entries, and beneath each node are the nodes it evaluated in turn.  A node evaluated with respect to different differentiation variables, as in the columns of a Jacobian, appears separately for each variable.
+
+	Only fresh evaluations are recorded.  A node shared between several functions is evaluated once per evaluation of the System, and its cost appears beneath the first function which reached it.
+
+	Each node is labelled by its printed sub-expression, computed the first time the node is reached along a given path, so that the profile remains readable after the function tree is gone.  Functions are labelled by name, and Jacobian entries by the name of the Jacobian and the differentiation variable, such as "df1/dx".
+
+	Not thread safe; use one per thread.
+	*/
+	class EvalProfile
+	{
+	public:
+
+		/**
+		\brief The totals for one function, Jacobian entry, or sub-expression.
+
+		Times are inclusive of the nodes beneath, except for self_seconds.
+		*/
+		struct Entry
+		{
+			std::string expression; ///< The printed sub-expression, or name of the function or Jacobian entry.
+			std::uint64_t calls_double = 0; ///< The number of fresh evaluations in double precision.
+			std::uint64_t calls_multiple = 0; ///< The number of fresh evaluations in multiple precision.
+			double seconds_double = 0; ///< The time spent in fresh evaluations in double precision.
+			double seconds_multiple = 0; ///< The time spent in fresh evaluations in multiple precision.
+			double self_seconds = 0; ///< The time spent in this node itself, in either precision, excluding the nodes beneath.
+
+			std::uint64_t Calls() const
+			{
+				return calls_double + calls_multiple;
+			}
+
+			double Seconds() const
+			{
+				return seconds_double + seconds_multiple;
+			}
+		};
+
+
+		/**
+		\brief Records one fresh evaluation of a node, from construction to destruction.
+		*/
+		class Scope
+		{
+		public:
+			Scope(EvalProfile & profile, Node const& n, Variable const* diff_variable, bool multiple_precision) : profile_(profile), multiple_precision_(multiple_precision)
+			{
+				profile_.Enter(n, diff_variable);
+				start_ = std::chrono::steady_clock::now();
+			}
+
+			~Scope()
+			{
+				profile_.Exit(multiple_precision_, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count());
+			}
+
+			Scope(Scope const&) = delete;
+			Scope& operator=(Scope const&) = delete;
+
+		private:
+			EvalProfile & profile_;
+			bool multiple_precision_;
+			std::chrono::steady_clock::time_point start_;
+		};
+
+
+		EvalProfile();
+
+		/**
+		\brief The totals for each function and Jacobian entry evaluated, or more generally for each node evaluated directly.  Sorted by decreasing time.
+		*/
+		std::vector<Entry> Roots() const;
+
+		/**
+		\brief The totals for each distinct sub-expression, summed over everywhere it was evaluated.  Sorted by decreasing self time.
+		*/
+		std::vector<Entry> Nodes() const;
+
+		/**
+		\brief Write the call tree in the folded stack format read by flame graph tools.
+
+		Each line is a path from a root to a node, with labels separated by semicolons, followed by the self time of the node in nanoseconds, summed over both precisions.
+		*/
+		void WriteFoldedStacks(std::ostream & out) const;
+
+		/**
+		\brief Whether anything has been recorded.
+		*/
+		bool Empty() const
+		{
+			return frames_.size()==1;
+		}
+
+		/**
+		\brief Discard everything recorded.  Must not be called during an evaluation being profiled.
+		*/
+		void Clear();
+
+	private:
+
+		/**
+		\brief One node of the call tree.
+		*/
+		struct Frame
+		{
+			std::string label;
+			std::size_t parent;
+			std::map<std::pair<Node const*, Variable const*>, std::size_t> children;
+			std::uint64_t calls[2] = {0, 0}; ///< Indexed by whether in multiple precision.
+			std::uint64_t nanoseconds[2] = {0, 0}; ///< Indexed by whether in multiple precision.
+		};
+
+		void Enter(Node const& n, Variable const* diff_variable);
+		void Exit(bool multiple_precision, std::uint64_t nanoseconds);
+
+		std::uint64_t SelfNanoseconds(Frame const& f) const;
+		void WriteFoldedStacks(std::ostream & out, std::size_t frame_index, std::string const& path) const;
+
+		std::vector<Frame> frames_; ///< The call tree.  The first frame is a sentinel, the parent of the roots.
+		std::size_t current_ = 0; ///< The frame being evaluated.
+	};
+
+
+	namespace detail {
+
+		/**
+		\brief The profile recording fresh evaluations on this thread, or nullptr if none.
+		*/
+		inline
+		EvalProfile*& ActiveEvalProfile()
+		{
+			thread_local EvalProfile* active = nullptr;
+			return active;
+		}
+	}
+
+
+	/**
+	\brief Record fresh evaluations on this thread into a profile, for the lifetime of this object.
+
+	Nested scopes are allowed; the innermost profile records, and the outer one resumes when the inner scope ends.
+	*/
+	class ScopedEvalProfiling
+	{
+	public:
+		ScopedEvalProfiling(EvalProfile & profile) : previous_(detail::ActiveEvalProfile())
+		{
+			detail::ActiveEvalProfile() = &profile;
+		}
+
+		~ScopedEvalProfiling()
+		{
+			detail::ActiveEvalProfile() = previous_;
+		}
+
+		ScopedEvalProfiling(ScopedEvalProfiling const&) = delete;
+		ScopedEvalProfiling& operator=(ScopedEvalProfiling const&) = delete;
+
+	private:
+		EvalProfile* previous_;
+	};
+
+} // re: namespace node
+} // re: namespace bertini
+
+#endif
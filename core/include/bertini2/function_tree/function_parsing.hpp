@@ -57,6 +57,8 @@
 #include <boost/phoenix/bind/bind_member_function.hpp>
 #include <boost/bind.hpp>
 
+#include <functional>
+#include <iostream>
 #include <memory>
 
 
@@ -260,6 +262,50 @@ namespace bertini {
 	}; //re: MPParserRules
 
 
+
+	namespace detail {
+
+		/**
+		\brief Add a term to a sum being parsed.
+
+		The first two terms make a SumOperator, and each later term is added to it as another child, so a sum of n terms parses to one node with n children, in linear time, rather than to a chain of sums n deep.  The sums met here were all made by the parser, so adding to one in place changes no other tree.
+
+		\param sum The sum so far.  Replaced by a SumOperator if it is not already one.
+		\param term The term to add.
+		\param add_or_sub True to add the term, false to subtract it.
+		*/
+		inline
+		void AddTermToSum(std::shared_ptr<node::Node> & sum, std::shared_ptr<node::Node> const& term, bool add_or_sub)
+		{
+			if (auto as_sum = std::dynamic_pointer_cast<node::SumOperator>(sum))
+				as_sum->AddChild(term, add_or_sub);
+			else
+				sum = std::make_shared<node::SumOperator>(sum, true, term, add_or_sub);
+		}
+
+		/**
+		\brief Add a factor to a product being parsed.
+
+		Like AddTermToSum, products of many factors become one MultOperator.  Until there is a MultOperator to add to, the usual arithmetic is used, so integer powers of the same base are still combined.
+
+		\param product The product so far.
+		\param factor The factor to multiply or divide by.
+		\param mult_or_div True to multiply by the factor, false to divide by it.
+		*/
+		inline
+		void AddFactorToProduct(std::shared_ptr<node::Node> & product, std::shared_ptr<node::Node> const& factor, bool mult_or_div)
+		{
+			if (auto as_product = std::dynamic_pointer_cast<node::MultOperator>(product))
+				as_product->AddChild(factor, mult_or_div);
+			else if (mult_or_div)
+				product *= factor;
+			else
+				product /= factor;
+		}
+
+	} // re: namespace detail
+
+
 	/**
 	A Qi grammar parser for parsing text into function trees.  Currently called from the SystemParser.
 
@@ -278,7 +324,15 @@ namespace bertini {
 		using Integer = node::Integer;
 		using Rational = node::Rational;
 		
-		FunctionParser(qi::symbols<char,std::shared_ptr<Node> > * encountered_symbols) : FunctionParser::base_type(root_rule_,"FunctionParser")
+		/**
+		 \param encountered_symbols The symbols which may appear in the functions parsed, such as variables and subfunctions.
+		 \param error_stream Where to describe parse errors.
+		 \param symbol_is_visible If given, a symbol may only be used if this returns true for its node.  The others are treated as if not encountered yet.
+		 */
+		FunctionParser(qi::symbols<char,std::shared_ptr<Node> > * encountered_symbols,
+		               std::ostream & error_stream = std::cout,
+		               std::function<bool(std::shared_ptr<Node> const&)> symbol_is_visible = nullptr)
+			: FunctionParser::base_type(root_rule_,"FunctionParser"), error_stream_(error_stream), symbol_is_visible_(std::move(symbol_is_visible))
 		{
 			namespace phx = boost::phoenix;
 			using qi::_1;
@@ -300,16 +354,16 @@ namespace bertini {
 			expression_.name("expression_");
 			expression_ =
 			term_ [_val = _1]
-			>> *(   (lit('+') > term_ [_val += _1])
-				 |  (lit('-') > term_ [_val -= _1])
+			>> *(   (lit('+') > term_ [phx::bind(&detail::AddTermToSum, _val, _1, true)])
+				 |  (lit('-') > term_ [phx::bind(&detail::AddTermToSum, _val, _1, false)])
 				 )
 			;
 
 			term_.name("term_");
 			term_ =
 			factor_ [_val = _1]
-			>> *(   (lit('*') > factor_ [_val *= _1])
-				 |  (lit('/') > factor_ [_val /= _1])
+			>> *(   (lit('*') > factor_ [phx::bind(&detail::AddFactorToProduct, _val, _1, true)])
+				 |  (lit('/') > factor_ [phx::bind(&detail::AddFactorToProduct, _val, _1, false)])
 				 )
 			;
 
@@ -348,7 +402,7 @@ namespace bertini {
 
 			symbol_.name("symbol_");
 			symbol_ %=
-			(*encountered_symbols) // the star here is the dereferencing of the encountered_symbols parameter to the constructor.
+			(*encountered_symbols) [ qi::_pass = phx::bind(&FunctionParser::IsVisible, this, _1) ] // the star here is the dereferencing of the encountered_symbols parameter to the constructor.
 			|
 			number_
 			;
@@ -384,7 +438,7 @@ namespace bertini {
 			on_error<qi::fail>
 			(
 			 root_rule_
-			 , std::cout
+			 , phx::ref(error_stream_)
 			 << val("Function parser error:  expecting ")
 			 << _4
 			 << val(" here: \"")
@@ -431,6 +485,17 @@ namespace bertini {
 		qi::rule<Iterator, std::shared_ptr<Node>(),  ascii::space_type > number_;
 		
 		MPParserRules<Iterator> mpfr_rules_;
+
+		std::ostream & error_stream_; ///< Where parse errors are described.
+		std::function<bool(std::shared_ptr<Node> const&)> symbol_is_visible_; ///< Which encountered symbols may be used.  All of them, if empty.
+
+		/**
+		 Whether an encountered symbol may be used.
+		 */
+		bool IsVisible(std::shared_ptr<Node> const& symbol) const
+		{
+			return !symbol_is_visible_ || symbol_is_visible_(symbol);
+		}
 	};
 
 
@@ -50,15 +50,21 @@
 #include <boost/type_index.hpp>
 
 #include "bertini2/num_traits.hpp"
+#include "bertini2/function_tree/eval_profiler.hpp"
 
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
 
 #include <deque>
+#include <memory>
+#include <set>
+#include <unordered_map>
 
 
 
@@ -81,6 +87,13 @@ enum class VariableGroupType
 
 namespace node{
 
+class Node;
+
+/**
+\brief Map from the nodes of a tree to their copies, for Node::Clone.
+*/
+using NodeCloneMap = std::unordered_map<Node const*, std::shared_ptr<Node> >;
+
 namespace detail{
 	template<typename T>
 	struct FreshEvalSelector
@@ -93,6 +106,13 @@ namespace detail{
 		template<typename N>
 		static dbl Run(N const& n, std::shared_ptr<Variable> const& diff_variable)
 		{
+		#ifndef BERTINI_DISABLE_TELEMETRY
+			if (auto profile = ActiveEvalProfile())
+			{
+				EvalProfile::Scope profiled(*profile, n, diff_variable.get(), false);
+				return n.FreshEval_d(diff_variable);
+			}
+		#endif
 			return n.FreshEval_d(diff_variable);
 		}
 		
@@ -100,6 +120,14 @@ namespace detail{
 		template<typename N>
 		static void RunInPlace(dbl& evaluation_value, N const& n, std::shared_ptr<Variable> const& diff_variable)
 		{
+		#ifndef BERTINI_DISABLE_TELEMETRY
+			if (auto profile = ActiveEvalProfile())
+			{
+				EvalProfile::Scope profiled(*profile, n, diff_variable.get(), false);
+				n.FreshEval_d(evaluation_value, diff_variable);
+				return;
+			}
+		#endif
 			n.FreshEval_d(evaluation_value, diff_variable);
 		}
 
@@ -111,6 +139,13 @@ namespace detail{
 		template<typename N>
 		static mpfr Run(N const& n, std::shared_ptr<Variable> const& diff_variable)
 		{
+		#ifndef BERTINI_DISABLE_TELEMETRY
+			if (auto profile = ActiveEvalProfile())
+			{
+				EvalProfile::Scope profiled(*profile, n, diff_variable.get(), true);
+				return n.FreshEval_mp(diff_variable);
+			}
+		#endif
 			return n.FreshEval_mp(diff_variable);
 		}
 		
@@ -118,6 +153,14 @@ namespace detail{
 		template<typename N>
 		static void RunInPlace(mpfr& evaluation_value, N const& n, std::shared_ptr<Variable> const& diff_variable)
 		{
+		#ifndef BERTINI_DISABLE_TELEMETRY
+			if (auto profile = ActiveEvalProfile())
+			{
+				EvalProfile::Scope profiled(*profile, n, diff_variable.get(), true);
+				n.FreshEval_mp(evaluation_value, diff_variable);
+				return;
+			}
+		#endif
 			n.FreshEval_mp(evaluation_value, diff_variable);
 		}
 
@@ -247,6 +290,15 @@ public:
 	*/
 	virtual int Degree(VariableGroup const& vars) const = 0;
 
+	/**
+	 Compute the support with respect to a variable group -- the exponent vectors of the monomials in the Node.  This is for building Newton polytopes.  Terms of sums are not collected, so a monomial whose coefficients cancel may still be present.
+
+	\param vars A group of variables.
+	 \return The exponent vectors, one entry per variable in the group.
+	 \throws std::runtime_error, if the Node is not polynomial in the variables.
+	*/
+	virtual std::set<std::vector<int> > Support(VariableGroup const& vars) const = 0;
+
 	/**
 	Homogenize a tree, inputting a variable group holding the non-homogeneous variables, and the new homogenizing variable.  The homvar may be an element of the variable group, that's perfectly ok.
 	
@@ -281,8 +333,47 @@ public:
 	{
 		return std::get<std::pair<mpfr,bool> >(current_value_).first.precision();
 	}
+
+
+	/**
+	 Make a copy of this node, of the same type, sharing its children with this one.  Used by Clone, which then replaces the children with their copies.
+	 */
+	virtual std::shared_ptr<Node> ShallowCopy() const = 0;
 	///////// PUBLIC PURE METHODS /////////////////
 
+
+	/**
+	 Deep-copy the tree below this node, in one pass.
+
+	 Nodes reachable along more than one path, such as variables and common subexpressions, are copied once, and shared by the copy in the same way.  Pass the same map when copying several trees with nodes in common, such as all the functions of a System, and the copies will have those nodes in common too.  Afterwards the map takes each original node to its copy, so use it to find the copies of variables.
+
+	 The copy has no stored values, and shares no mutable state with the original, so the two may be evaluated on different threads.
+
+	 \param already_cloned Map from original nodes to their copies.  Nodes already in it are not copied again.
+	 \return The copy of this node.
+	 */
+	std::shared_ptr<Node> Clone(NodeCloneMap & already_cloned) const
+	{
+		auto found = already_cloned.find(this);
+		if (found!=already_cloned.end())
+			return found->second;
+
+		auto copy = ShallowCopy();
+		copy->CloneChildren(already_cloned);
+		copy->ResetStoredValues();
+		already_cloned.emplace(this, copy);
+		return copy;
+	}
+
+	/**
+	 Deep-copy the tree below this node.  \see Clone(NodeCloneMap&)
+	 */
+	std::shared_ptr<Node> Clone() const
+	{
+		NodeCloneMap already_cloned;
+		return Clone(already_cloned);
+	}
+
 	/**
 	Check if a Node is polynomial -- it has degree at least 0.  Negative degrees indicate non-polynomial.
 
@@ -354,6 +445,13 @@ protected:
 	
 	
 	///////// END PRIVATE PURE METHODS /////////////////
+
+
+	/**
+	 Replace the children of a fresh ShallowCopy with their clones.  Overridden by every Node type which refers to other nodes.
+	 */
+	virtual void CloneChildren(NodeCloneMap & already_cloned)
+	{}
 	
 	
 	/**
@@ -78,6 +78,11 @@ namespace node{
 	{
 	public:
 		virtual ~SumOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<SumOperator>(*this);
+		}
 		
 		
 		
@@ -160,6 +165,12 @@ namespace node{
 		 Compute the multidegree with respect to a variable group.  This is for homogenization, and testing for homogeneity.  
 		*/
 		std::vector<int> MultiDegree(VariableGroup const& vars) const override;
+
+
+		/**
+		 Compute the support with respect to a variable group.  The union of the supports of the terms.
+		*/
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override;
 		
 
 
@@ -289,7 +300,20 @@ namespace node{
 			return child_->IsHomogeneous(vars);
 		}
 
+		/**
+		 The support of the negation is that of its child.
+		*/
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override
+		{
+			return child_->Support(vars);
+		}
+
 		virtual ~NegateOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<NegateOperator>(*this);
+		}
 		
 	protected:
 		
@@ -365,6 +389,11 @@ namespace node{
 		
 		
 		virtual ~MultOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<MultOperator>(*this);
+		}
 		
 		
 		
@@ -410,6 +439,12 @@ namespace node{
 		 Compute the multidegree with respect to a variable group.  This is for homogenization, and testing for homogeneity.  
 		*/
 		std::vector<int> MultiDegree(VariableGroup const& vars) const override;
+
+
+		/**
+		 Compute the support with respect to a variable group.  The Minkowski sum of the supports of the factors.  Division is only allowed by constants.
+		*/
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override;
 		
 
 		void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override;
@@ -527,6 +562,12 @@ namespace node{
 		 Compute the multidegree with respect to a variable group.  This is for homogenization, and testing for homogeneity.  
 		*/
 		std::vector<int> MultiDegree(VariableGroup const& vars) const override;
+
+
+		/**
+		 Compute the support with respect to a variable group.  The exponent must be a constant non-negative integer.
+		*/
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override;
 		
 
 
@@ -540,6 +581,11 @@ namespace node{
 		bool IsHomogeneous(VariableGroup const& vars) const override;
 
 		virtual ~PowerOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<PowerOperator>(*this);
+		}
 		
 		/**
 		 Change the precision of this variable-precision tree node.
@@ -565,6 +611,12 @@ namespace node{
 		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override;
 		void FreshEval_mp(mpfr& evaulation_value, std::shared_ptr<Variable> const& diff_variable) const override;
 
+		void CloneChildren(NodeCloneMap & already_cloned) override
+		{
+			base_ = base_->Clone(already_cloned);
+			exponent_ = exponent_->Clone(already_cloned);
+		}
+
 	private:
 				
 		PowerOperator() = default;
@@ -651,6 +703,12 @@ namespace node{
 		 */
 		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override;
 		
+
+		/**
+		 Compute the support with respect to a variable group, as the repeated Minkowski sum of the support of the base.
+		*/
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override;
+
 		
 		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
 		{
@@ -668,6 +726,11 @@ namespace node{
 
 
 		virtual ~IntegerPowerOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<IntegerPowerOperator>(*this);
+		}
 		
 		
 		/**
@@ -774,6 +837,11 @@ namespace node{
 		
 
 		virtual ~SqrtOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<SqrtOperator>(*this);
+		}
 		
 	protected:
 		
@@ -842,6 +910,11 @@ namespace node{
 		
 
 		virtual ~ExpOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<ExpOperator>(*this);
+		}
 		
 	protected:
 		
@@ -897,6 +970,11 @@ namespace node{
 		
 
 		virtual ~LogOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<LogOperator>(*this);
+		}
 		
 	protected:
 		
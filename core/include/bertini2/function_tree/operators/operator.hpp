@@ -154,6 +154,17 @@ namespace node{
 		}
 
 
+		/**
+		 Compute the support with respect to a variable group.  Unary operators other than negation and integer powers are only polynomial if their argument is constant.
+		*/
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override
+		{
+			if (this->Degree(vars)!=0)
+				throw std::runtime_error("asking for support of non-polynomial node");
+			return {std::vector<int>(vars.size(),0)};
+		}
+
+
 		void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override
 		{
 			child_->Homogenize(vars, homvar);
@@ -205,6 +216,11 @@ namespace node{
 		//Stores the single child of the unary operator
 		std::shared_ptr<Node> child_;
 		UnaryOperator(){}
+
+		void CloneChildren(NodeCloneMap & already_cloned) override
+		{
+			child_ = child_->Clone(already_cloned);
+		}
 	private:
 		friend class boost::serialization::access;
 		
@@ -288,6 +304,12 @@ namespace node{
 		//This is an NaryOperator and can have any number of children.
 		std::vector< std::shared_ptr<Node> > children_;
 		NaryOperator(){}
+
+		void CloneChildren(NodeCloneMap & already_cloned) override
+		{
+			for (auto& child : children_)
+				child = child->Clone(already_cloned);
+		}
 	private:
 
 		virtual void PrecisionChangeSpecific(unsigned prec) const
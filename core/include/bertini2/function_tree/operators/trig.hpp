@@ -113,6 +113,11 @@ namespace node{
 		
 		
 		virtual ~SinOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<SinOperator>(*this);
+		}
 		
 	protected:
 		
@@ -179,6 +184,11 @@ namespace node{
 		
 		
 		virtual ~ArcSinOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<ArcSinOperator>(*this);
+		}
 		
 	protected:
 		
@@ -255,6 +265,11 @@ namespace node{
 		
 		
 		virtual ~CosOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<CosOperator>(*this);
+		}
 		
 	protected:
 		
@@ -326,6 +341,11 @@ namespace node{
 
 
 		virtual ~ArcCosOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<ArcCosOperator>(*this);
+		}
 		
 	protected:
 		
@@ -403,6 +423,11 @@ namespace node{
 		
 		
 		virtual ~TanOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<TanOperator>(*this);
+		}
 		
 	protected:
 		
@@ -473,6 +498,11 @@ namespace node{
 		
 		
 		virtual ~ArcTanOperator() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<ArcTanOperator>(*this);
+		}
 		
 	protected:
 		
@@ -103,6 +103,11 @@ namespace node{
 		
 		
 		virtual ~Function() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<Function>(*this);
+		}
 		
 		
 		
@@ -183,6 +188,12 @@ namespace node{
 		}
 
 
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override
+		{
+			return entry_node_->Support(vars);
+		}
+
+
 		void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override
 		{
 			entry_node_->Homogenize(vars, homvar);
@@ -220,6 +231,12 @@ namespace node{
 		}
 		
 	protected:
+
+		void CloneChildren(NodeCloneMap & already_cloned) override
+		{
+			if (entry_node_)
+				entry_node_ = entry_node_->Clone(already_cloned);
+		}
 		
 		/**
 		 Calls FreshEval on the entry node to the tree.
@@ -137,6 +137,21 @@ namespace node{
 
 				
 				virtual ~Jacobian() = default;
+
+				std::shared_ptr<Node> ShallowCopy() const override
+				{
+					return std::make_shared<Jacobian>(*this);
+				}
+
+		protected:
+
+				void CloneChildren(NodeCloneMap & already_cloned) override
+				{
+					Function::CloneChildren(already_cloned);
+					current_diff_variable_ = nullptr;
+				}
+
+		public:
 				
 	
 				mutable std::shared_ptr<Variable> current_diff_variable_;
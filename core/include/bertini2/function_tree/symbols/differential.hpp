@@ -104,6 +104,11 @@ namespace node{
 
 		virtual ~Differential() = default;
 
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<Differential>(*this);
+		}
+
 
 
 
@@ -125,6 +130,11 @@ namespace node{
 			return std::vector<int>(vars.size(),0);
 		}
 
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override
+		{
+			return {std::vector<int>(vars.size(), 0)};
+		}
+
 		void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override
 		{
 			
@@ -157,6 +167,12 @@ namespace node{
 
 		
 	protected:
+
+		/**
+		 Points the copy at the clone of the variable.  Defined in node.cpp, as Variable is incomplete here.
+		 */
+		void CloneChildren(NodeCloneMap & already_cloned) override;
+
 		// This should never be called for a Differential.  Only for Jacobians.
 		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
 		{
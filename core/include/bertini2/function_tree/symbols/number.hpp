@@ -98,6 +98,11 @@ namespace node{
 			return std::vector<int>(vars.size(), 0);
 		}
 
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override
+		{
+			return {std::vector<int>(vars.size(), 0)};
+		}
+
 
 		void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override
 		{
@@ -170,6 +175,11 @@ namespace node{
 		Integer(Integer const&) = default;
 
 		~Integer() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<Integer>(*this);
+		}
 		
 
 
@@ -257,6 +267,11 @@ namespace node{
 		{}
 
 		~Float() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<Float>(*this);
+		}
 		
 
 
@@ -355,6 +370,11 @@ namespace node{
 		Rational(int, int) = delete;
 
 		~Rational() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<Rational>(*this);
+		}
 		
 		static Rational Rand()
 		{
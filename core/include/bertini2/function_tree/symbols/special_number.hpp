@@ -73,6 +73,11 @@ namespace node{
 
 			virtual ~Pi() = default;
 
+			std::shared_ptr<Node> ShallowCopy() const override
+			{
+				return std::make_shared<Pi>(*this);
+			}
+
 
 			void Reset() const override
 			{
@@ -109,6 +114,11 @@ namespace node{
 				return std::vector<int>(vars.size(), 0);
 			}
 
+			std::set<std::vector<int> > Support(VariableGroup const& vars) const override
+			{
+				return {std::vector<int>(vars.size(), 0)};
+			}
+
 
 			void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override
 			{
@@ -190,6 +200,11 @@ namespace node{
 
 			virtual ~E() = default;
 
+			std::shared_ptr<Node> ShallowCopy() const override
+			{
+				return std::make_shared<E>(*this);
+			}
+
 
 			void Reset() const override
 			{
@@ -225,6 +240,11 @@ namespace node{
 				return std::vector<int>(vars.size(), 0);
 			}
 
+			std::set<std::vector<int> > Support(VariableGroup const& vars) const override
+			{
+				return {std::vector<int>(vars.size(), 0)};
+			}
+
 
 			void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override
 			{
@@ -69,6 +69,11 @@ namespace node{
 		
 		
 		virtual ~Variable() = default;
+
+		std::shared_ptr<Node> ShallowCopy() const override
+		{
+			return std::make_shared<Variable>(*this);
+		}
 		
 
 
@@ -141,6 +146,11 @@ namespace node{
 			return deg;
 		}
 
+		std::set<std::vector<int> > Support(VariableGroup const& vars) const override
+		{
+			return {MultiDegree(vars)};
+		}
+
 
 		void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override
 		{
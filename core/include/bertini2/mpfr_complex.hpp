@@ -55,7 +55,7 @@ namespace bertini {
 	This class currently uses Boost.Multiprecision -- namely, the mpfr_float type for variable precision.
 	This class is serializable using Boost.Serialize.
 	
-	The precision of a newly-made bertini::complex is whatever current default is, set by DefaultPrecision(...).
+	The precision of a newly-made bertini::complex is the default precision, set by DefaultPrecision(...), unless it is made from an mpfr_float or another complex, whose precision it takes.
 
 	\todo{Implement MPI send/receive commands using Boost.MPI or alternative.}
 	*/
@@ -65,11 +65,7 @@ namespace bertini {
 		// The real and imaginary parts of the complex number
 		mpfr_float real_, imag_;
 		
-		#ifdef USE_THREAD_LOCAL
-			static thread_local mpfr_float temp_[8]; //OSX clang does NOT implement this. Use ./configure --disable-thread_local.  Also, send Apple a letter telling them to implement this keyword.
-		#else
-			static mpfr_float temp_[8];
-		#endif
+		static thread_local mpfr_float temp_[8]; // scratch space for arithmetic, one set per thread
 
 		// Let the boost serialization library have access to the private members of this class.
 		friend class boost::serialization::access;
@@ -111,13 +107,31 @@ namespace bertini {
 		// this has to be here so that the Boost.Serialization library
 		// knows that there are different methods for the serialize() method.
 		
+
+		/**
+		 \brief Bring a freshly made complex to the default precision.
+
+		 Its parts were made at the process-wide default of Boost.Multiprecision, which another thread may have changed.
+		 */
+		void MatchDefaultPrecision()
+		{
+			auto prec = DefaultPrecision();
+			if (real_.precision()!=prec)
+			{
+				real_.precision(prec);
+				imag_.precision(prec);
+			}
+		}
 		
 	public:
 		
 		/**
-		 Default constructor
+		 Default constructor, at the default precision.
 		 */
-		complex() : real_(), imag_(){}
+		complex() : real_(), imag_()
+		{
+			MatchDefaultPrecision();
+		}
 		
 		
 		
@@ -131,25 +145,49 @@ namespace bertini {
 		 Single-parameter for constructing a real-valued complex from a single real double number
 		 */
 		explicit
-		complex(double re) : real_(re), imag_(0){}
+		complex(double re) : complex()
+		{
+			real_ = re;
+		}
 		
 		template<typename T, typename = typename std::enable_if<std::is_integral<T>::value >::type>
-		complex(T re) : real_(re), imag_(0){}
+		complex(T re) : complex()
+		{
+			real_ = re;
+		}
 
 		template<typename T, typename = typename std::enable_if<std::is_integral<T>::value >::type>
 		explicit
-		complex(T re, T im) : real_(re), imag_(im){}
+		complex(T re, T im) : complex()
+		{
+			real_ = re;
+			imag_ = im;
+		}
 
-		complex(mpz_int const& re) : real_(re), imag_(0){}
+		complex(mpz_int const& re) : complex()
+		{
+			real_ = re;
+		}
 
 		explicit
-		complex(mpz_int const& re, mpz_int const& im) : real_(re), imag_(im){}
+		complex(mpz_int const& re, mpz_int const& im) : complex()
+		{
+			real_ = re;
+			imag_ = im;
+		}
 
 		explicit
-		complex(mpq_rational const& re) : real_(re), imag_(0){}
+		complex(mpq_rational const& re) : complex()
+		{
+			real_ = re;
+		}
 
 		explicit
-		complex(mpq_rational const& re, mpq_rational const& im) : real_(re), imag_(im){}
+		complex(mpq_rational const& re, mpq_rational const& im) : complex()
+		{
+			real_ = re;
+			imag_ = im;
+		}
 		/**
 		 Single-parameter for constructing a real-valued complex from a single high-precision number
 		 */
@@ -168,7 +206,10 @@ namespace bertini {
 		 Single-parameter for constructing a real-valued complex from a convertible single string
 		 */
 		explicit
-		complex(const std::string & re) : real_(re), imag_(0){}
+		complex(const std::string & re) : complex()
+		{
+			real_ = re;
+		}
 		
 		
 		
@@ -190,15 +231,21 @@ namespace bertini {
 		 Two-parameter constructor for building a complex from two low precision numbers
 		 */
 		 explicit
-		complex(std::complex<double> z) : real_(z.real()), imag_(z.imag())
-		{}
+		complex(std::complex<double> z) : complex()
+		{
+			real_ = z.real();
+			imag_ = z.imag();
+		}
 
 		/**
 		 Two-parameter constructor for building a complex from two low precision numbers
 		 */
 		 explicit
-		complex(double re, double im) : real_(re), imag_(im)
-		{}
+		complex(double re, double im) : complex()
+		{
+			real_ = re;
+			imag_ = im;
+		}
 		
 		
 		
@@ -206,8 +253,11 @@ namespace bertini {
 		 Two-parameter constructor for building a complex from two strings.
 		 */
 		explicit
-		complex(const std::string & re, const std::string & im) : real_(re), imag_(im)
-		{}
+		complex(const std::string & re, const std::string & im) : complex()
+		{
+			real_ = re;
+			imag_ = im;
+		}
 		
 		
 		/**
@@ -1420,6 +1470,8 @@ namespace bertini {
 	 */
 	inline complex pow(const complex & z, const complex & c)
 	{
+		if (z.real()==0 && z.imag()==0 && c.real()>0)
+			return complex(0,0);
 		return exp(c * log(z));
 	}
 	
@@ -1428,6 +1480,8 @@ namespace bertini {
 	 */
 	inline complex pow(const complex & z, const mpfr_float & c)
 	{
+		if (z.real()==0 && z.imag()==0 && c>0)
+			return complex(0,0);
 		return exp(c * log(z));
 	}
 
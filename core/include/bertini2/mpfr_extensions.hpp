@@ -27,13 +27,14 @@
 
 \brief Extensions to the Boost.Multiprecision library.
 
-Particularly includes Boost.Serialize code for the mpfr_float, gmp_rational, and gmp_int types.
+Particularly includes Boost.Serialize code for the mpfr_float, gmp_rational, and gmp_int types.  Text archives store them as decimal strings, and binary archives as the limbs of integers.
 */
 
 #ifndef BERTINI_MPFR_EXTENSIONS_HPP
 #define BERTINI_MPFR_EXTENSIONS_HPP
 
 #include "bertini2/config.h"
+#include "bertini2/random.hpp"
 
 #include <boost/multiprecision/mpfr.hpp>
 #include <boost/multiprecision/random.hpp>
@@ -41,8 +42,12 @@ Particularly includes Boost.Serialize code for the mpfr_float, gmp_rational, and
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/split_member.hpp>
 
+#include <cstdint>
+#include <stdexcept>
 #include <string>
 
 
@@ -60,16 +65,73 @@ namespace bertini{
 	using mpq_rational = boost::multiprecision::number<boost::multiprecision::backends::gmp_rational, boost::multiprecision::et_off>;
 #endif
 
-	inline auto DefaultPrecision()
+	/**
+	\brief Get the default precision, in digits.
+
+	This is the working precision: the precision at which bertini::complex numbers and mpfr_floats are made when none is given, and at which the temporaries of complex arithmetic are computed.
+
+	It is Boost.Multiprecision's default, which is shared by the whole process.  Boost also changes it for the duration of every arithmetic operation on numbers at some other precision, so threads may only compute concurrently if they all work at the current default, and none changes it while the others run.  In particular, adaptive precision trackers may only run on one thread at a time.
+	*/
+	inline unsigned DefaultPrecision()
 	{
 		return mpfr_float::default_precision();
 	}
 
+	/**
+	\brief Set the default precision, in digits.
+
+	This is process-wide; see DefaultPrecision().  Prefer ScopedDefaultPrecision for temporary changes, so the previous precision is restored however the scope is left.
+	*/
 	inline void DefaultPrecision(unsigned prec)
 	{
-		mpfr_float::default_precision(prec);
+		if (mpfr_float::default_precision()!=prec)
+			mpfr_float::default_precision(prec);
 	}
 
+
+	/**
+	\class ScopedDefaultPrecision
+
+	\brief Set the default precision for the lifetime of this object, restoring the previous default at destruction.
+
+	## Example
+
+	\code
+	{
+		ScopedDefaultPrecision higher(temp_higher_prec);
+		// refine at higher precision...
+	} // back to the previous precision, even if refining threw
+	\endcode
+	*/
+	class ScopedDefaultPrecision
+	{
+	public:
+		explicit
+		ScopedDefaultPrecision(unsigned prec) : previous_(DefaultPrecision())
+		{
+			DefaultPrecision(prec);
+		}
+
+		~ScopedDefaultPrecision()
+		{
+			DefaultPrecision(previous_);
+		}
+
+		ScopedDefaultPrecision(ScopedDefaultPrecision const&) = delete;
+		ScopedDefaultPrecision& operator=(ScopedDefaultPrecision const&) = delete;
+
+		/**
+		\brief The default precision in effect before this scope was entered.
+		*/
+		unsigned PreviousPrecision() const
+		{
+			return previous_;
+		}
+
+	private:
+		unsigned previous_; ///< The precision to restore.
+	};
+
 	/** 
 	\brief Get the precision of a number.
 
@@ -165,6 +227,144 @@ namespace boost { namespace serialization {
 	}
 
 
+
+	// Binary archives are for fast loading on the same kind of machine, so they skip the conversion to and from decimal, and store the limbs as they are in memory.  These overloads are preferred to the templates above for binary archives.
+
+	namespace detail {
+		/**
+		 Save the limbs of a gmp integer to a binary archive.
+		 */
+		inline
+		void SaveLimbs(::boost::archive::binary_oarchive& ar, mpz_srcptr z)
+		{
+			std::int64_t signed_size = static_cast<std::int64_t>(mpz_sgn(z)) * static_cast<std::int64_t>(mpz_size(z));
+			ar & signed_size;
+			if (signed_size!=0)
+				ar.save_binary(mpz_limbs_read(z), mpz_size(z)*sizeof(mp_limb_t));
+		}
+
+		/**
+		 Load the limbs of a gmp integer from a binary archive.
+		 */
+		inline
+		void LoadLimbs(::boost::archive::binary_iarchive& ar, mpz_ptr z)
+		{
+			std::int64_t signed_size;
+			ar & signed_size;
+			if (signed_size==0)
+			{
+				mpz_set_ui(z, 0);
+				return;
+			}
+
+			mp_size_t num_limbs = signed_size < 0 ? -signed_size : signed_size;
+			ar.load_binary(mpz_limbs_write(z, num_limbs), num_limbs*sizeof(mp_limb_t));
+			mpz_limbs_finish(z, static_cast<mp_size_t>(signed_size));
+		}
+	}
+
+	/**
+	 Save a mpfr_float type to a binary archive, as its precision in bits, kind, and sign, and if it is a regular number, as an integer significand and a power of two, \f$m 2^e\f$.
+	 */
+	inline
+	void save(::boost::archive::binary_oarchive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0> const& r, unsigned /*version*/)
+	{
+		mpfr_srcptr x = r.data();
+		std::int64_t precision_bits = mpfr_get_prec(x);
+		std::int32_t kind = mpfr_nan_p(x) ? 0 : (mpfr_inf_p(x) ? 1 : (mpfr_zero_p(x) ? 2 : 3));
+		std::int32_t sign = mpfr_signbit(x) ? -1 : 1;
+
+		ar & precision_bits;
+		ar & kind;
+		ar & sign;
+		if (kind==3)
+		{
+			::boost::multiprecision::backends::gmp_int significand;
+			std::int64_t exponent = mpfr_get_z_2exp(significand.data(), x);
+			ar & exponent;
+			detail::SaveLimbs(ar, significand.data());
+		}
+	}
+
+	/**
+	 Load a mpfr_float type from a binary archive.  The number comes back exactly, at the precision it was saved at.
+	 */
+	inline
+	void load(::boost::archive::binary_iarchive& ar, ::boost::multiprecision::backends::mpfr_float_backend<0>& r, unsigned /*version*/)
+	{
+		std::int64_t precision_bits;
+		std::int32_t kind;
+		std::int32_t sign;
+		ar & precision_bits;
+		ar & kind;
+		ar & sign;
+
+		mpfr_set_prec(r.data(), precision_bits);
+		switch (kind)
+		{
+			case 0:
+				mpfr_set_nan(r.data());
+				break;
+			case 1:
+				mpfr_set_inf(r.data(), sign);
+				break;
+			case 2:
+				mpfr_set_zero(r.data(), sign);
+				break;
+			case 3:
+			{
+				std::int64_t exponent;
+				ar & exponent;
+				::boost::multiprecision::backends::gmp_int significand;
+				detail::LoadLimbs(ar, significand.data());
+				// the significand has at most precision_bits bits, so this is exact
+				mpfr_set_z_2exp(r.data(), significand.data(), exponent, MPFR_RNDN);
+				break;
+			}
+			default:
+				throw std::runtime_error("unknown kind of mpfr_float in binary archive");
+		}
+	}
+
+	/**
+	 Save a gmp_rational type to a binary archive, as the limbs of its numerator and denominator.
+	 */
+	inline
+	void save(::boost::archive::binary_oarchive& ar, ::boost::multiprecision::backends::gmp_rational const& r, unsigned /*version*/)
+	{
+		detail::SaveLimbs(ar, mpq_numref(r.data()));
+		detail::SaveLimbs(ar, mpq_denref(r.data()));
+	}
+
+	/**
+	 Load a gmp_rational type from a binary archive.
+	 */
+	inline
+	void load(::boost::archive::binary_iarchive& ar, ::boost::multiprecision::backends::gmp_rational& r, unsigned /*version*/)
+	{
+		detail::LoadLimbs(ar, mpq_numref(r.data()));
+		detail::LoadLimbs(ar, mpq_denref(r.data()));
+	}
+
+	/**
+	 Save a gmp_int type to a binary archive, as its limbs.
+	 */
+	inline
+	void save(::boost::archive::binary_oarchive& ar, ::boost::multiprecision::backends::gmp_int const& r, unsigned /*version*/)
+	{
+		detail::SaveLimbs(ar, r.data());
+	}
+
+	/**
+	 Load a gmp_int type from a binary archive.
+	 */
+	inline
+	void load(::boost::archive::binary_iarchive& ar, ::boost::multiprecision::backends::gmp_int& r, unsigned /*version*/)
+	{
+		detail::LoadLimbs(ar, r.data());
+	}
+
+
 } } // re: namespaces
 
 BOOST_SERIALIZATION_SPLIT_FREE(::boost::multiprecision::backends::mpfr_float_backend<0>)
@@ -192,48 +392,66 @@ using boost::multiprecision::max; //3 options: ./configure --disable-expression_
 namespace bertini
 {
 	/**
-	Generate a random integer number between -10^digits and 10^digits
+	Generate a random integer number between -10^digits and 10^digits, drawn from the calling thread's engine.
 	*/
 	template <unsigned long digits = 50>
 	inline
 	mpz_int RandomInt()
 	{
-		using namespace boost::random;
-   		static mt19937 mt;
-	    static uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
-	    return ui(mt);
+		boost::random::uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
+		return ui(ThreadRandomEngine());
 	}
 	
 	
 	/**
-	Generate a random rational number with numerator and denomenator between -10^digits and 10^digits
+	Generate a random rational number with numerator and denomenator between -10^digits and 10^digits, drawn from the calling thread's engine.
 	*/
 	template <unsigned long digits = 50>
 	mpq_rational RandomRat()
 	{
-   		using namespace boost::random;
-   		static mt19937 mt;
-	    static uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
-	    return mpq_rational(ui(mt),ui(mt));
+		boost::random::uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
+		auto& engine = ThreadRandomEngine();
+		auto numerator = ui(engine);
+		return mpq_rational(numerator,ui(engine));
 	}
 
 
 	/**
-	 Produce a random number with at length_in_digits non-zero digits.
+	 Generate a random integer with a given number of random bits, drawn 32 at a time from the calling thread's engine.
+
+	 \tparam num_bits The number of bits.  The result is in \f$[0,2^{num\_bits})\f$.
+	 */
+	template <unsigned long num_bits>
+	mpz_int RandomBits()
+	{
+		auto& engine = ThreadRandomEngine();
+		mpz_int bits(0);
+		for (unsigned long ii = 0; ii < num_bits; ii+=32)
+		{
+			bits <<= 32;
+			bits += static_cast<std::uint32_t>(engine());
+		}
+		if (num_bits%32)
+			bits >>= 32-num_bits%32;
+		return bits;
+	}
+
+
+	/**
+	 Produce a random number in the unit interval, with length_in_digits random digits, drawn from the calling thread's engine.
 	 
 	 \tparam length_in_digits The length of the desired random number
 	 */
 	template <unsigned int length_in_digits>
 	mpfr_float RandomMp()
-	{	
-
-		using namespace boost::multiprecision;
-   		using namespace boost::random;
-
-   		static uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
-   		static independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen;
+	{
+		using boost::multiprecision::number;
+		using boost::multiprecision::mpfr_float_backend;
+		using boost::multiprecision::et_off;
+		using FixedT = number<mpfr_float_backend<length_in_digits>, et_off>;
 
-		return ur(gen);
+		constexpr unsigned long num_bits = length_in_digits*1000L/301L;
+		return mpfr_float(ldexp(FixedT(RandomBits<num_bits>()), -static_cast<int>(num_bits)));
 	}
 	
 	/**
@@ -243,15 +461,8 @@ namespace bertini
 	 */
 	template <unsigned int length_in_digits>
 	void RandomMp(mpfr_float & a)
-	{	
-
-		using namespace boost::multiprecision;
-   		using namespace boost::random;
-
-   		static uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
-   		static independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen;
-
-		a = ur(gen);
+	{
+		a = RandomMp<length_in_digits>();
 	}
 
 	/**
@@ -0,0 +1,327 @@
+//This file is part of Bertini 2.
+//
+//nag_algorithms/boundary_phase.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//nag_algorithms/boundary_phase.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with nag_algorithms/boundary_phase.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file nag_algorithms/boundary_phase.hpp
+
+\brief Contains the BoundaryPhase, for tracking every path of a solve to the endgame boundary, detecting and re-tracking paths which crossed.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "bertini2/nag_algorithms/path_scheduler.hpp"
+#include "bertini2/nag_algorithms/spatial_hash.hpp"
+#include "bertini2/random.hpp"
+#include "bertini2/tracking/tracker.hpp"
+
+namespace bertini {
+
+	namespace algorithm {
+
+		/**
+		\class BoundaryPhase
+
+		\brief Track every path to the endgame boundary, detecting path crossings as paths arrive, and re-tracking only the paths involved.
+
+		Distinct paths of a homotopy never meet before t=0.  If two paths arrive at the same point at the endgame boundary, one of them jumped onto the other somewhere along the way.  Which one is not known, so both are re-tracked with tighter settings.
+
+		Boundary points are kept in a SpatialHash as they arrive, so detecting a crossing costs expected constant time per path, rather than a comparison of all pairs at the end.  Re-tracks are queued ahead of fresh paths, on the same pool of workers, so they run concurrently with the rest of the batch rather than in a second pass.  A path may be re-tracked several times, each with tighter settings, up to a maximum, after which it is marked as crossed.
+
+		Each worker has its own deep copy of the homotopy, made with System::Clone, and two trackers on it: one set up for ordinary tracking, and one for re-tracking, which is set up again before every re-track with the level of tightening wanted.
+
+		\tparam TrackerT The type of tracker to use.
+
+		## Example
+
+		\code
+		BoundaryPhase<DoublePrecisionTracker> boundary(H, num_workers,
+			[](DoublePrecisionTracker & tr){tr.Setup(...);},
+			[](DoublePrecisionTracker & tr, unsigned level)
+			{
+				config::Stepping<double> stepping;
+				stepping.max_step_size /= pow(10, level);
+				tr.Setup(..., tracking_tolerance/pow(10, level), ..., stepping, ...);
+			});
+		auto results = boundary.Run(start_points, t_start, t_endgame_boundary);
+		\endcode
+
+		The default precision is shared by all threads (see DefaultPrecision), so an adaptive precision tracker may only be used with one worker.
+		*/
+		template<class TrackerT>
+		class BoundaryPhase
+		{
+			using BaseComplexType = typename tracking::TrackerTraits<TrackerT>::BaseComplexType;
+			using CT = BaseComplexType;
+
+		public:
+
+			/**
+			\brief How to detect and handle crossings.
+			*/
+			struct Settings
+			{
+				double crossing_tolerance = 1e-7; ///< Two boundary points closer than this are the same, and their paths crossed.
+				unsigned max_num_retracks = 2; ///< The most times a path is re-tracked, before it is marked as crossed.
+				std::uint64_t random_seed = DefaultRandomSeed(); ///< Each track of each path draws its random numbers from its own stream made from this seed, so results do not depend on the number of workers.
+			};
+
+
+			/**
+			\brief The outcome of tracking one path to the boundary.
+			*/
+			struct BoundaryResult
+			{
+				Vec<CT> point; ///< The point at the endgame boundary.  Only meaningful on success.
+				tracking::SuccessCode code = tracking::SuccessCode::PathInProgress; ///< The code from the last track of the path.
+				unsigned num_retracks = 0; ///< The number of times the path was re-tracked because of a crossing.
+				bool crossed = false; ///< Whether the path still met another after the last re-track.
+			};
+
+
+			/**
+			\param homotopy The homotopy.  It is copied, once per worker, not referred to.
+			\param num_workers The number of worker threads.
+			\param tracker_setup A function which sets up a freshly made tracker for ordinary tracking.
+			\param retrack_setup A function which sets up a tracker for the given level of re-tracking, 1 for the first re-track of a path, 2 for the second, and so on.  Should be tighter at each level.
+			*/
+			BoundaryPhase(System const& homotopy, unsigned num_workers, std::function<void(TrackerT &)> const& tracker_setup, std::function<void(TrackerT &, unsigned)> const& retrack_setup) : homotopies_(CloneForWorkers(homotopy, num_workers)), retrack_setup_(retrack_setup)
+			{
+				CheckConcurrentTracking<TrackerT>(num_workers);
+
+				for (const auto& H : homotopies_)
+				{
+					trackers_.push_back(std::make_shared<TrackerT>(*H));
+					tracker_setup(*trackers_.back());
+					retrackers_.push_back(std::make_shared<TrackerT>(*H));
+				}
+			}
+
+
+			/**
+			\brief Set how crossings are detected and handled.
+			*/
+			void SetSettings(Settings const& s)
+			{
+				settings_ = s;
+			}
+
+
+			/**
+			\brief Track all the paths to the endgame boundary.
+
+			\param start_points The start points of the paths.
+			\param start_time The time at which the paths start, usually 1.
+			\param boundary_time The endgame boundary, usually 0.1.
+			\return The results, one per path, in the same order as the start points.
+
+			\throws Whatever a tracker or the re-track setup throws.  The workers stop, and the first exception is rethrown on the calling thread.
+			*/
+			std::vector<BoundaryResult> Run(std::vector<Vec<CT>> const& start_points, CT const& start_time, CT const& boundary_time)
+			{
+				std::vector<BoundaryResult> results(start_points.size());
+				if (start_points.empty())
+					return results;
+
+				SpatialHash<CT> hash(start_points[0].size(), settings_.crossing_tolerance);
+				std::vector<typename SpatialHash<CT>::CellKey> keys(start_points.size());
+				std::vector<bool> is_hashed(start_points.size(), false);
+
+				std::deque<unsigned> retrack_queue;
+				unsigned next_fresh = 0, num_in_flight = 0;
+				std::mutex mutex;
+				std::condition_variable work_available;
+				std::exception_ptr failure; // the first exception thrown while tracking, after which all workers stop
+
+				// remove a path from the hash.  call with the lock held.
+				auto unhash = [&](unsigned path_index)
+				{
+					if (is_hashed[path_index])
+					{
+						hash.Erase(keys[path_index], path_index);
+						is_hashed[path_index] = false;
+					}
+				};
+
+				// queue a colliding path for re-tracking, or mark it as crossed if it has had enough.  call with the lock held.
+				auto handle_collision = [&](unsigned path_index)
+				{
+					if (results[path_index].num_retracks < settings_.max_num_retracks)
+					{
+						unhash(path_index);
+						retrack_queue.push_back(path_index);
+					}
+					else
+						results[path_index].crossed = true;
+				};
+
+				// record the result of tracking a path, checking for a crossing.  call with the lock held.
+				auto record = [&](unsigned path_index)
+				{
+					auto& result = results[path_index];
+					if (result.code!=tracking::SuccessCode::Success || !hash.Cell(result.point, keys[path_index]))
+						return;
+
+					unsigned other;
+					const double tol = settings_.crossing_tolerance;
+					if (hash.FindNear(keys[path_index], [&results, &result, tol](unsigned ii)
+					                  {return static_cast<double>((results[ii].point - result.point).norm()) <= tol;},
+					                  other))
+					{
+						handle_collision(other);
+						handle_collision(path_index);
+						if (!result.crossed)
+							return; // it will be re-tracked, and hashed again then
+					}
+
+					hash.Insert(keys[path_index], path_index);
+					is_hashed[path_index] = true;
+				};
+
+				auto worker_loop = [&](unsigned worker_index)
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					while (true)
+					{
+						work_available.wait(lock, [&]{return failure || !retrack_queue.empty() || next_fresh < start_points.size() || num_in_flight==0;});
+						if (failure)
+							break;
+
+						unsigned path_index;
+						bool is_retrack;
+						if (!retrack_queue.empty())
+						{
+							path_index = retrack_queue.front();
+							retrack_queue.pop_front();
+							is_retrack = true;
+						}
+						else if (next_fresh < start_points.size())
+						{
+							path_index = next_fresh++;
+							is_retrack = false;
+						}
+						else
+							break; // nothing queued, nothing in flight, so nothing more will be queued
+
+						unsigned level = is_retrack ? ++results[path_index].num_retracks : 0;
+						++num_in_flight;
+						lock.unlock();
+
+						Vec<CT> point;
+						tracking::SuccessCode code;
+						try
+						{
+							const auto& tracker = is_retrack ? *retrackers_[worker_index] : *trackers_[worker_index];
+							if (is_retrack)
+								retrack_setup_(*retrackers_[worker_index], level);
+
+							ScopedRandomStream random_stream(settings_.random_seed, path_index, level);
+							code = tracker.TrackPath(point, start_time, boundary_time, start_points[path_index]);
+						}
+						catch (...)
+						{
+							lock.lock();
+							--num_in_flight;
+							if (!failure)
+								failure = std::current_exception();
+							break;
+						}
+
+						lock.lock();
+						--num_in_flight;
+						results[path_index].point = point;
+						results[path_index].code = code;
+						record(path_index);
+						work_available.notify_all();
+					}
+					work_available.notify_all();
+				};
+
+				if (NumWorkers()==1)
+					worker_loop(0);
+				else
+				{
+					std::vector<std::thread> workers;
+					for (unsigned ii = 0; ii < NumWorkers(); ++ii)
+						workers.emplace_back(worker_loop, ii);
+					for (auto& w : workers)
+						w.join();
+				}
+
+				if (failure)
+					std::rethrow_exception(failure);
+
+				return results;
+			}
+
+
+			/**
+			\brief The number of worker threads.
+			*/
+			unsigned NumWorkers() const
+			{
+				return trackers_.size();
+			}
+
+
+			/**
+			\brief Get the ordinary tracker belonging to a worker, for attaching observers, etc.
+			*/
+			TrackerT & GetTracker(unsigned worker_index)
+			{
+				return *trackers_.at(worker_index);
+			}
+
+			TrackerT const& GetTracker(unsigned worker_index) const
+			{
+				return *trackers_.at(worker_index);
+			}
+
+
+			/**
+			\brief Get the copy of the homotopy belonging to a worker, which its trackers track.
+			*/
+			System const& GetHomotopy(unsigned worker_index) const
+			{
+				return *homotopies_.at(worker_index);
+			}
+
+		private:
+
+			std::vector<std::shared_ptr<System>> homotopies_; ///< One copy of the homotopy per worker.
+			std::vector<std::shared_ptr<TrackerT>> trackers_; ///< One tracker per worker, for ordinary tracking.
+			std::vector<std::shared_ptr<TrackerT>> retrackers_; ///< One tracker per worker, for re-tracking with tighter settings.
+			std::function<void(TrackerT &, unsigned)> retrack_setup_; ///< Sets up a re-tracker for a level of tightening.
+			Settings settings_; ///< How to detect and handle crossings.
+		};
+
+	} // re: namespace algorithm
+} // re: namespace bertini
+
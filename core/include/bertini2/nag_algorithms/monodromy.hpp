@@ -0,0 +1,412 @@
+//This file is part of Bertini 2.
+//
+//nag_algorithms/monodromy.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//nag_algorithms/monodromy.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with nag_algorithms/monodromy.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file nag_algorithms/monodromy.hpp
+
+\brief Contains the Monodromy solver, for finding all the solutions of a generic member of a parameterized family, by tracking around loops in parameter space.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "bertini2/nag_algorithms/parameter_homotopy.hpp"
+#include "bertini2/nag_algorithms/spatial_hash.hpp"
+
+namespace bertini {
+
+	namespace algorithm {
+
+		/**
+		\class Monodromy
+
+		\brief Solve a generic member of a parameterized family, starting from one known solution, by tracking around random loops in parameter space.
+
+		As the parameters travel around a loop and come back to where they started, the solutions of the system are permuted.  Tracking the known solutions around many random loops, and keeping the endpoints which are new, eventually fills out the whole set of isolated solutions at the base parameters.  The number of paths tracked is the number of solutions times the number of loops, which for many families is far fewer than any start system would need.
+
+		To begin, a single (parameters, solution) pair is needed.  Such a pair is usually easy to come by: choose a random point, and solve the (often linear) equations for parameters which make it a solution.
+
+		Each loop is a triangle, from the base parameters to two random points and back again, tracked as three straight line parameter homotopies.  The paths of one loop are tracked in parallel, on one worker per homotopy, and each endpoint is compared against the known solutions as soon as it arrives.  Solving stops when the expected number of solutions is known, or when a number of consecutive loops turns up nothing new, or after a maximum number of loops.  No trace test is done, so when the number of solutions is not known in advance, the result is complete only with high probability, more so with more stable loops.
+
+		The homotopy must be made with AddStraightLineParameters.  Each worker tracks its own deep copy of it, made with System::Clone.
+
+		\tparam TrackerT The type of tracker to use.
+
+		## Example
+
+		\code
+		Monodromy<DoublePrecisionTracker> monodromy(H, num_parameters, num_workers,
+			[](DoublePrecisionTracker & tr){tr.Setup(...);});
+		monodromy.Seed(base_parameters, seed_solution);
+
+		Monodromy<DoublePrecisionTracker>::StoppingCriteria stopping;
+		stopping.num_stable_loops = 5;
+		auto solutions = monodromy.Solve(stopping);
+		\endcode
+
+		The default precision is shared by all threads (see DefaultPrecision), so an adaptive precision tracker may only be used with one worker.
+		*/
+		template<class TrackerT>
+		class Monodromy
+		{
+			using BaseComplexType = typename tracking::TrackerTraits<TrackerT>::BaseComplexType;
+			using CT = BaseComplexType;
+
+		public:
+
+			/**
+			\brief When to stop looping.
+			*/
+			struct StoppingCriteria
+			{
+				unsigned max_num_loops = 100; ///< Stop after this many loops, no matter what.
+				unsigned num_stable_loops = 3; ///< Stop after this many consecutive loops find no new solution.
+				unsigned expected_num_solutions = 0; ///< Stop as soon as this many solutions are known.  0 if unknown.
+			};
+
+
+			/**
+			\brief Make a Monodromy solver, cloning the homotopy once per worker.
+
+			\param homotopy The homotopy, made with AddStraightLineParameters.  It is copied, not referred to.
+			\param num_parameters The number of parameters in the family.
+			\param num_workers The number of worker threads.
+			\param tracker_setup A function which sets up a freshly made tracker, by calling Setup and the like.
+			*/
+			Monodromy(System const& homotopy, unsigned num_parameters, unsigned num_workers, std::function<void(TrackerT &)> const& tracker_setup) : num_parameters_(num_parameters)
+			{
+				if (homotopy.NumImplicitParameters()!=2*num_parameters)
+					throw std::runtime_error("homotopy for Monodromy must have two implicit parameters per parameter.  use AddStraightLineParameters to make it.");
+				if (!homotopy.HavePathVariable())
+					throw std::runtime_error("homotopy for Monodromy must have a path variable");
+
+				CheckConcurrentTracking<TrackerT>(num_workers);
+				homotopies_ = CloneForWorkers(homotopy, num_workers);
+				for (const auto& H : homotopies_)
+				{
+					trackers_.push_back(std::make_shared<TrackerT>(*H));
+					tracker_setup(*trackers_.back());
+				}
+
+				ResetHash();
+			}
+
+
+			/**
+			\brief Set the base parameters, and a solution at them, from which to start.
+
+			Any solutions already found are forgotten.
+
+			\param parameters The base parameter values.  Should be generic.
+			\param solution A solution of the system at the base parameter values.
+			*/
+			void Seed(Vec<CT> const& parameters, Vec<CT> const& solution)
+			{
+				Seed(parameters, std::vector<Vec<CT>>{solution});
+			}
+
+
+			/**
+			\brief Set the base parameters, and any number of known solutions at them, from which to start.
+
+			\param parameters The base parameter values.  Should be generic.
+			\param solutions Some solutions of the system at the base parameter values.  Duplicates are removed.
+			*/
+			void Seed(Vec<CT> const& parameters, std::vector<Vec<CT>> const& solutions)
+			{
+				if (parameters.size()!=num_parameters_)
+					throw std::runtime_error("number of base parameter values must match number of parameters");
+
+				base_parameters_ = parameters;
+				solutions_.clear();
+				ResetHash();
+				for (const auto& s : solutions)
+					InsertIfNew(s);
+
+				num_loops_ = 0;
+				num_paths_tracked_ = 0;
+				num_failed_paths_ = 0;
+			}
+
+
+			/**
+			\brief Track around random loops until the stopping criteria are met.
+
+			May be called again, with looser criteria, to keep going.
+
+			\param stopping When to stop.
+			\return The solutions at the base parameters.
+			*/
+			std::vector<Vec<CT>> const& Solve(StoppingCriteria const& stopping)
+			{
+				if (solutions_.empty())
+					throw std::runtime_error("must seed Monodromy with a solution before solving");
+
+				unsigned num_stable_loops = 0;
+				for (unsigned ii = 0; ii < stopping.max_num_loops; ++ii)
+				{
+					if (stopping.expected_num_solutions > 0 && solutions_.size() >= stopping.expected_num_solutions)
+						break;
+
+					auto num_known = solutions_.size();
+					TrackLoop(RandomOfUnits<CT>(num_parameters_), RandomOfUnits<CT>(num_parameters_));
+
+					if (solutions_.size()==num_known)
+					{
+						if (++num_stable_loops >= stopping.num_stable_loops)
+							break;
+					}
+					else
+						num_stable_loops = 0;
+				}
+
+				return solutions_;
+			}
+
+
+			/**
+			\brief Track all the known solutions around one loop, through two given parameter points.
+
+			New solutions found are kept.
+
+			\param first The first parameter point visited after leaving the base parameters.
+			\param second The second parameter point visited, before returning to the base parameters.
+			\return The number of new solutions found.
+			*/
+			unsigned TrackLoop(Vec<CT> const& first, Vec<CT> const& second)
+			{
+				if (first.size()!=num_parameters_ || second.size()!=num_parameters_)
+					throw std::runtime_error("number of parameter values of loop points must match number of parameters");
+
+				// the solutions found during this loop are tracked around the next one
+				const std::vector<Vec<CT>> loop_starts = solutions_;
+
+				PathScheduler scheduler(loop_starts.size());
+				scheduler.Run(NumWorkers(), [this, &loop_starts, &first, &second](unsigned path_index, unsigned worker_index)
+					{
+						return TrackAroundLoop(loop_starts[path_index], first, second, worker_index);
+					});
+
+				++num_loops_;
+				return solutions_.size() - loop_starts.size();
+			}
+
+
+			/**
+			\brief Get the solutions found so far, at the base parameters.
+			*/
+			std::vector<Vec<CT>> const& Solutions() const
+			{
+				return solutions_;
+			}
+
+
+			/**
+			\brief Get the base parameter values.
+			*/
+			Vec<CT> const& BaseParameters() const
+			{
+				return base_parameters_;
+			}
+
+
+			/**
+			\brief Set the relative distance below which two endpoints are taken to be the same solution.  Default is 1e-8.
+			*/
+			void SameSolutionTolerance(double tol)
+			{
+				same_solution_tolerance_ = tol;
+				ResetHash();
+			}
+
+
+			/**
+			\brief The number of loops tracked since seeding.
+			*/
+			unsigned NumLoops() const
+			{
+				return num_loops_;
+			}
+
+
+			/**
+			\brief The number of paths tracked around loops since seeding, each being three legs.
+			*/
+			unsigned NumPathsTracked() const
+			{
+				return num_paths_tracked_;
+			}
+
+
+			/**
+			\brief The number of paths which failed on some leg of their loop, since seeding.
+			*/
+			unsigned NumFailedPaths() const
+			{
+				return num_failed_paths_;
+			}
+
+
+			/**
+			\brief The number of worker threads.
+			*/
+			unsigned NumWorkers() const
+			{
+				return trackers_.size();
+			}
+
+
+			/**
+			\brief Get the tracker belonging to a worker, for attaching observers, etc.
+			*/
+			TrackerT & GetTracker(unsigned worker_index)
+			{
+				return *trackers_.at(worker_index);
+			}
+
+		private:
+
+			/**
+			\brief Track one solution around a loop, on one worker, keeping the endpoint if it is new.
+
+			\return The total number of steps taken, as the cost of the path.
+			*/
+			double TrackAroundLoop(Vec<CT> const& start, Vec<CT> const& first, Vec<CT> const& second, unsigned worker_index)
+			{
+				const auto& H = *homotopies_[worker_index];
+				const auto& tracker = *trackers_[worker_index];
+
+				const Vec<CT>* waypoints[4] = {&base_parameters_, &first, &second, &base_parameters_};
+
+				CT t_start(1), t_end(0);
+				double cost = 0;
+
+				++num_paths_tracked_;
+				Vec<CT> current = start, next;
+				for (unsigned leg = 0; leg < 3; ++leg)
+				{
+					SetStraightLineParameterValues(H, *waypoints[leg], *waypoints[leg+1]);
+					auto code = tracker.TrackPath(next, t_start, t_end, current);
+					cost += tracker.NumTotalStepsTaken();
+					if (code!=tracking::SuccessCode::Success)
+					{
+						++num_failed_paths_;
+						return cost;
+					}
+					current = next;
+				}
+
+				InsertIfNew(current);
+				return cost;
+			}
+
+
+			/**
+			\brief Find the square of the hash into which a point goes.
+
+			Points are hashed scaled to norm at most 1.  Two points within the relative tolerance of each other are then within twice the tolerance after scaling, which is the width of the squares, so they are in the same or neighbouring squares.
+			*/
+			bool HashCell(Vec<CT> const& point, typename SpatialHash<CT>::CellKey & key) const
+			{
+				using std::max;
+				const double scale = max(1.0, static_cast<double>(point.norm()));
+				return hash_.Cell(Vec<CT>(point/CT(scale)), key);
+			}
+
+
+			/**
+			\brief Make the hash anew, for the current tolerance, and put the known solutions into it.
+			*/
+			void ResetHash()
+			{
+				hash_ = SpatialHash<CT>(homotopies_[0]->NumVariables(), 2*same_solution_tolerance_);
+				for (unsigned ii = 0; ii < solutions_.size(); ++ii)
+				{
+					typename SpatialHash<CT>::CellKey key;
+					if (HashCell(solutions_[ii], key))
+						hash_.Insert(key, ii);
+				}
+			}
+
+
+			/**
+			\brief Add a point to the known solutions, unless it is already there.
+
+			The point is only compared against the known solutions near it in the hash, so this takes expected constant time.  Safe to call from many workers at once.
+
+			\return Whether the point was new.
+			*/
+			bool InsertIfNew(Vec<CT> const& point)
+			{
+				using std::max;
+				const double scale = max(1.0, static_cast<double>(point.norm()));
+				auto is_near = [this, &point, scale](unsigned ii)
+				{
+					return static_cast<double>((solutions_[ii]-point).norm()) <= same_solution_tolerance_*scale;
+				};
+
+				typename SpatialHash<CT>::CellKey key;
+				const bool hashable = HashCell(point, key);
+
+				std::lock_guard<std::mutex> lock(solutions_mutex_);
+				unsigned found;
+				if (hashable)
+				{
+					if (hash_.FindNear(key, is_near, found))
+						return false;
+					hash_.Insert(key, solutions_.size());
+				}
+				else // only if the tolerance is 0, or the point is not finite
+				{
+					for (unsigned ii = 0; ii < solutions_.size(); ++ii)
+						if (is_near(ii))
+							return false;
+				}
+
+				solutions_.push_back(point);
+				return true;
+			}
+
+
+			std::vector<std::shared_ptr<System>> homotopies_; ///< One copy of the homotopy per worker.
+			std::vector<std::shared_ptr<TrackerT>> trackers_; ///< One tracker per worker, tracking the corresponding homotopy.
+			unsigned num_parameters_; ///< The number of parameters in the family.
+
+			Vec<CT> base_parameters_; ///< The parameter values at which solutions are collected.
+			std::vector<Vec<CT>> solutions_; ///< The distinct solutions found so far, at the base parameters.
+			std::mutex solutions_mutex_; ///< Protects solutions_ and hash_ while workers add to them.
+			double same_solution_tolerance_ = 1e-8; ///< Relative distance below which two points are the same solution.
+			SpatialHash<CT> hash_{0, 0}; ///< The known solutions, scaled to norm at most 1, hashed by location.
+
+			unsigned num_loops_ = 0; ///< The number of loops tracked since seeding.
+			std::atomic<unsigned> num_paths_tracked_{0}; ///< The number of paths tracked around loops since seeding.
+			std::atomic<unsigned> num_failed_paths_{0}; ///< The number of paths which failed since seeding.
+		};
+
+	} // re: namespace algorithm
+} // re: namespace bertini
+
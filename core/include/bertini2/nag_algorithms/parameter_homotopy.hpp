@@ -0,0 +1,321 @@
+//This file is part of Bertini 2.
+//
+//nag_algorithms/parameter_homotopy.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//nag_algorithms/parameter_homotopy.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with nag_algorithms/parameter_homotopy.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file nag_algorithms/parameter_homotopy.hpp
+
+\brief Contains the ParameterHomotopy type, for solving many instances of a parameterized family of systems, starting from the solutions at a single generic instance.
+*/
+
+#pragma once
+
+#include "bertini2/nag_algorithms/path_scheduler.hpp"
+
+namespace bertini {
+
+	namespace algorithm {
+
+		/**
+		\brief Add the machinery for a straight-line parameter homotopy to a system.
+
+		For each parameter, two implicit parameters are added to the system: the start value \f$s_i\f$ and the target value \f$e_i\f$, in that order (all starts, then all targets).  The path variable is set to t, and an explicit parameter \f$p_i(t) = t\, s_i + (1-t)\, e_i\f$ is added.  Write the functions of the system in terms of the returned parameters, and the system is then a homotopy from the start parameter values at t=1 to the target values at t=0.
+
+		The values of the start and target parameters are set with System::SetImplicitParameters, so moving to a new instance of the family requires no change to the function tree.
+
+		\param sys The system to add the parameters to.
+		\param t The path variable.
+		\param num_parameters The number of parameters in the family.
+		\return The parameters, as functions of the path variable.
+		*/
+		inline
+		std::vector<std::shared_ptr<node::Function>> AddStraightLineParameters(System & sys, std::shared_ptr<node::Variable> const& t, unsigned num_parameters)
+		{
+			VariableGroup start_values, target_values;
+			for (unsigned ii = 0; ii < num_parameters; ++ii)
+			{
+				start_values.push_back(std::make_shared<node::Variable>("parameter_start_" + std::to_string(ii)));
+				target_values.push_back(std::make_shared<node::Variable>("parameter_target_" + std::to_string(ii)));
+			}
+
+			sys.AddImplicitParameters(start_values);
+			sys.AddImplicitParameters(target_values);
+			sys.AddPathVariable(t);
+
+			std::vector<std::shared_ptr<node::Function>> parameters;
+			for (unsigned ii = 0; ii < num_parameters; ++ii)
+			{
+				auto p = std::make_shared<node::Function>("parameter_" + std::to_string(ii));
+				p->SetRoot(t*start_values[ii] + (1-t)*target_values[ii]);
+				sys.AddParameter(p);
+				parameters.push_back(p);
+			}
+			return parameters;
+		}
+
+
+
+
+		namespace detail {
+
+			/**
+			\brief Set the implicit parameters in both double and multiple precision, so the system can be evaluated in either.
+			*/
+			inline
+			void SetImplicitParametersBothPrecisions(System const& H, Vec<dbl> const& values)
+			{
+				H.SetImplicitParameters(values);
+
+				Vec<mpfr> values_mp(values.size());
+				for (unsigned ii = 0; ii < values.size(); ++ii)
+					values_mp(ii) = mpfr(values(ii));
+				H.SetImplicitParameters(values_mp);
+			}
+
+			inline
+			void SetImplicitParametersBothPrecisions(System const& H, Vec<mpfr> const& values)
+			{
+				H.SetImplicitParameters(values);
+
+				Vec<dbl> values_d(values.size());
+				for (unsigned ii = 0; ii < values.size(); ++ii)
+					values_d(ii) = static_cast<dbl>(values(ii));
+				H.SetImplicitParameters(values_d);
+			}
+
+		} // re: namespace detail
+
+
+		/**
+		\brief Set the start and target parameter values of a homotopy made with AddStraightLineParameters.
+
+		The values are set in both double and multiple precision, so the homotopy can be tracked in either.
+
+		\param H The homotopy.
+		\param start The parameter values at t=1.
+		\param target The parameter values at t=0.
+		*/
+		template<typename CT>
+		void SetStraightLineParameterValues(System const& H, Vec<CT> const& start, Vec<CT> const& target)
+		{
+			if (start.size()!=target.size() || H.NumImplicitParameters()!=2*static_cast<unsigned>(start.size()))
+				throw std::runtime_error("number of start and target parameter values must match the number of straight line parameters of the homotopy");
+
+			Vec<CT> start_and_target(start.size()+target.size());
+			start_and_target << start, target;
+			detail::SetImplicitParametersBothPrecisions(H, start_and_target);
+		}
+
+
+
+
+		/**
+		\class ParameterHomotopy
+
+		\brief Solve many instances of a parameterized family, by tracking from the solutions at one generic instance.
+
+		The expensive part of solving a parameterized family is done once: find all isolated solutions at generic (random complex) parameter values, by whatever method suits the family, and give them to this object with GenericPoint.  Then each new instance is solved by tracking only those paths, along a straight line in parameter space.
+
+		The homotopy must be made with AddStraightLineParameters.  Evaluation of a System is not re-entrant, so each worker thread tracks its own deep copy of it, made with System::Clone.  Each worker has its own tracker, made once and reused for every path it tracks, so the workspaces of the trackers are reused across paths and instances.  Instances are handed out by a PathScheduler, most distant from the generic parameters first, and each is solved in its own random stream, so the results do not depend on the number of workers.
+
+		\tparam TrackerT The type of tracker to use.
+
+		## Example
+
+		\code
+		System H;
+		auto p = AddStraightLineParameters(H, t, 1);
+		// add variables, and functions written in terms of p[0]
+
+		ParameterHomotopy<DoublePrecisionTracker> ph(H, 1, num_workers,
+			[](DoublePrecisionTracker & tr){tr.Setup(...);});
+		ph.GenericPoint(generic_parameters, generic_solutions);
+		auto results = ph.Solve(instances);
+		\endcode
+
+		The default precision is shared by all threads (see DefaultPrecision), so an adaptive precision tracker may only be used with one worker.
+		*/
+		template<class TrackerT>
+		class ParameterHomotopy
+		{
+			using BaseComplexType = typename tracking::TrackerTraits<TrackerT>::BaseComplexType;
+			using CT = BaseComplexType;
+
+		public:
+
+			/**
+			\brief The result of solving at one parameter instance.
+			*/
+			struct InstanceResult
+			{
+				std::vector<Vec<CT>> solutions; ///< One endpoint per generic solution, in the same order.
+				std::vector<tracking::SuccessCode> codes; ///< The code from tracking each path.
+			};
+
+
+			/**
+			\brief Make a ParameterHomotopy, cloning the homotopy once per worker.
+
+			\param homotopy The homotopy, made with AddStraightLineParameters.  It is copied, not referred to.
+			\param num_parameters The number of parameters in the family.
+			\param num_workers The number of worker threads.
+			\param tracker_setup A function which sets up a freshly made tracker, by calling Setup and the like.
+			*/
+			ParameterHomotopy(System const& homotopy, unsigned num_parameters, unsigned num_workers, std::function<void(TrackerT &)> const& tracker_setup) : num_parameters_(num_parameters)
+			{
+				if (homotopy.NumImplicitParameters()!=2*num_parameters)
+					throw std::runtime_error("homotopy for ParameterHomotopy must have two implicit parameters per parameter.  use AddStraightLineParameters to make it.");
+				if (!homotopy.HavePathVariable())
+					throw std::runtime_error("homotopy for ParameterHomotopy must have a path variable");
+
+				CheckConcurrentTracking<TrackerT>(num_workers);
+				homotopies_ = CloneForWorkers(homotopy, num_workers);
+				for (const auto& H : homotopies_)
+				{
+					trackers_.push_back(std::make_shared<TrackerT>(*H));
+					tracker_setup(*trackers_.back());
+				}
+			}
+
+
+			/**
+			\brief Set the generic parameter values, and the solutions at them, from which every instance is solved.
+
+			\param parameters The generic parameter values.
+			\param solutions All the isolated solutions of the system at the generic parameter values.
+			*/
+			void GenericPoint(Vec<CT> const& parameters, std::vector<Vec<CT>> const& solutions)
+			{
+				if (parameters.size()!=num_parameters_)
+					throw std::runtime_error("number of generic parameter values must match number of parameters");
+				generic_parameters_ = parameters;
+				generic_solutions_ = solutions;
+			}
+
+
+			/**
+			\brief Get the generic solutions.
+			*/
+			std::vector<Vec<CT>> const& GenericSolutions() const
+			{
+				return generic_solutions_;
+			}
+
+
+			/**
+			\brief The number of paths tracked per instance.
+			*/
+			unsigned NumPathsPerInstance() const
+			{
+				return generic_solutions_.size();
+			}
+
+
+			/**
+			\brief The number of worker threads.
+			*/
+			unsigned NumWorkers() const
+			{
+				return trackers_.size();
+			}
+
+
+			/**
+			\brief Get the tracker belonging to a worker, for attaching observers, etc.
+			*/
+			TrackerT & GetTracker(unsigned worker_index)
+			{
+				return *trackers_.at(worker_index);
+			}
+
+
+			/**
+			\brief Solve the family at many parameter instances.
+
+			\param instances The parameter values, one vector per instance.
+			\return The results, one per instance, in the same order as the instances.
+			*/
+			std::vector<InstanceResult> Solve(std::vector<Vec<CT>> const& instances) const
+			{
+				if (generic_solutions_.empty())
+					throw std::runtime_error("must set the generic parameters and solutions before solving instances");
+
+				for (const auto& p : instances)
+					if (p.size()!=num_parameters_)
+						throw std::runtime_error("number of parameter values in an instance must match number of parameters");
+
+				std::vector<InstanceResult> results(instances.size());
+
+				PathScheduler scheduler(instances.size());
+				// longer paths in parameter space are predicted to cost more
+				for (unsigned ii = 0; ii < instances.size(); ++ii)
+					scheduler.PredictedCost(ii, static_cast<double>((instances[ii]-generic_parameters_).norm()));
+				scheduler.Reset();
+
+				scheduler.Run(NumWorkers(), [this, &instances, &results](unsigned instance_index, unsigned worker_index)
+					{
+						return SolveInstance(results[instance_index], instances[instance_index], worker_index);
+					});
+
+				return results;
+			}
+
+		private:
+
+			/**
+			\brief Track all generic solutions to one instance, on one worker.
+
+			\return The total number of steps taken, as the cost of the instance.
+			*/
+			double SolveInstance(InstanceResult & result, Vec<CT> const& instance, unsigned worker_index) const
+			{
+				const auto& H = *homotopies_[worker_index];
+				const auto& tracker = *trackers_[worker_index];
+
+				SetStraightLineParameterValues(H, generic_parameters_, instance);
+
+				CT t_start(1), t_end(0);
+				double cost = 0;
+
+				result.solutions.resize(generic_solutions_.size());
+				result.codes.resize(generic_solutions_.size());
+				for (unsigned ii = 0; ii < generic_solutions_.size(); ++ii)
+				{
+					result.codes[ii] = tracker.TrackPath(result.solutions[ii], t_start, t_end, generic_solutions_[ii]);
+					cost += tracker.NumTotalStepsTaken();
+				}
+				return cost;
+			}
+
+
+			std::vector<std::shared_ptr<System>> homotopies_; ///< One copy of the homotopy per worker.
+			std::vector<std::shared_ptr<TrackerT>> trackers_; ///< One tracker per worker, tracking the corresponding homotopy.
+			unsigned num_parameters_; ///< The number of parameters in the family.
+
+			Vec<CT> generic_parameters_; ///< The generic parameter values.
+			std::vector<Vec<CT>> generic_solutions_; ///< The solutions at the generic parameter values.
+		};
+
+	} // re: namespace algorithm
+} // re: namespace bertini
+
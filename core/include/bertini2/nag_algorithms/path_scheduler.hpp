@@ -0,0 +1,426 @@
+//This file is part of Bertini 2.
+//
+//nag_algorithms/path_scheduler.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//nag_algorithms/path_scheduler.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with nag_algorithms/path_scheduler.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file nag_algorithms/path_scheduler.hpp
+
+\brief Contains the PathScheduler, for handing out paths to worker threads in order of decreasing predicted cost, and tools for predicting the cost of a path.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "bertini2/random.hpp"
+#include "bertini2/tracking/tracker.hpp"
+#include "bertini2/tracking/resumable_path.hpp"
+
+namespace bertini {
+
+	namespace algorithm {
+
+		/**
+		\brief The relative cost of one tracker iteration at a given precision.
+
+		This is the AMP arithmetic cost model, \f$C(P)\f$ from \cite AMP2, converted to a double for use in scheduling.
+
+		\param precision The precision in digits.
+		*/
+		inline
+		double IterationCost(unsigned precision)
+		{
+			return static_cast<double>(tracking::ArithmeticCost(precision));
+		}
+
+
+
+		/**
+		\brief Make deep copies of a system, one per worker thread, sharing no nodes with each other or with the original.
+
+		Evaluation of a System is not re-entrant, so each worker needs its own.  See System::Clone.
+
+		\param sys The system to copy.
+		\param num_workers The number of copies to make.
+		*/
+		inline
+		std::vector<std::shared_ptr<System>> CloneForWorkers(System const& sys, unsigned num_workers)
+		{
+			if (num_workers==0)
+				throw std::runtime_error("must use at least one worker");
+
+			std::vector<std::shared_ptr<System>> copies;
+			copies.reserve(num_workers);
+			for (unsigned ii = 0; ii < num_workers; ++ii)
+				copies.push_back(std::make_shared<System>(sys.Clone()));
+			return copies;
+		}
+
+
+
+		/**
+		\brief Check that trackers of a type may track on several workers at once.
+
+		The default precision is shared by all threads (see DefaultPrecision), and an adaptive precision tracker changes it as it tracks, so trackers of that kind may only run one at a time.
+
+		\param num_workers The number of workers which will track at once.
+		\tparam TrackerT The type of tracker.
+		\throws std::runtime_error if TrackerT is adaptive precision and more than one worker would track at once.
+		*/
+		template<class TrackerT>
+		void CheckConcurrentTracking(unsigned num_workers)
+		{
+			if (tracking::TrackerTraits<TrackerT>::IsAdaptivePrec && num_workers > 1)
+				throw std::runtime_error("adaptive precision trackers change the process-wide default precision, so may only track on one worker at a time");
+		}
+
+
+
+		/**
+		\class PathCostAccumulator
+
+		\brief Observer which accumulates the cost of tracking a path, for predicting the cost of tracking it again.
+
+		Each iteration, successful or not, costs IterationCost at the precision in which it was taken.  Precision changes are counted too.
+
+		Example usage:
+		PathCostAccumulator<AMPTracker> cost_accumulator;
+		tracker.AddObserver(&cost_accumulator);
+		*/
+		template<class TrackerT>
+		class PathCostAccumulator : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+			using EmitterT = typename tracking::TrackerTraits<TrackerT>::EventEmitterType;
+
+			virtual void Observe(AnyEvent const& e) override
+			{
+				if (auto p = dynamic_cast<const tracking::Initializing<EmitterT,typename tracking::TrackerTraits<TrackerT>::BaseComplexType>*>(&e))
+					Reset();
+				else if (auto p = dynamic_cast<const tracking::SuccessfulStep<EmitterT>*>(&e))
+					cost_ += IterationCost(p->Get().CurrentPrecision());
+				else if (auto p = dynamic_cast<const tracking::FailedStep<EmitterT>*>(&e))
+					cost_ += IterationCost(p->Get().CurrentPrecision());
+				else if (auto p = dynamic_cast<const tracking::PrecisionChanged<EmitterT>*>(&e))
+					++num_precision_changes_;
+			}
+
+			virtual EventMask ObservedEvents() const override
+			{
+				using CT = typename tracking::TrackerTraits<TrackerT>::BaseComplexType;
+				return EventBits<tracking::Initializing<EmitterT,CT>, tracking::SuccessfulStep<EmitterT>, tracking::FailedStep<EmitterT>, tracking::PrecisionChanged<EmitterT>>();
+			}
+
+			virtual void Visit(TrackerT const& t) override
+			{}
+
+		public:
+
+			/**
+			\brief The accumulated cost of the most recently tracked path.
+			*/
+			double Cost() const
+			{
+				return cost_;
+			}
+
+			/**
+			\brief The number of precision changes during the most recently tracked path.
+			*/
+			unsigned NumPrecisionChanges() const
+			{
+				return num_precision_changes_;
+			}
+
+			/**
+			\brief Zero the accumulated data.  Called automatically when a tracker begins a new path.
+			*/
+			void Reset()
+			{
+				cost_ = 0;
+				num_precision_changes_ = 0;
+			}
+
+		private:
+			double cost_ = 0;
+			unsigned num_precision_changes_ = 0;
+		};
+
+
+
+
+		/**
+		\brief Predict the cost of tracking a path, by tracking it for a few iterations with a cheap tracker.
+
+		Usually the probe tracker is a DoublePrecisionTracker with loose tolerances.  The cost is extrapolated from the fraction of the path covered by the probe.  A probe which fails, or which has to raise precision, indicates a difficult path, and is penalized by the cost of arithmetic at the lowest multiple precision.
+
+		\param probe_tracker The set-up tracker to probe with.  The probe runs on a copy with no observers attached, so neither the tracker nor its observers see the probe's steps.
+		\param start_time The time at which the path starts.
+		\param endtime The time to which the path would be tracked.
+		\param start_point The start point of the path.
+		\param max_num_iterations The largest number of iterations to spend on the probe.
+		\return A predicted cost, in the units of IterationCost.
+		*/
+		template<class TrackerT, typename CT = typename tracking::TrackerTraits<TrackerT>::BaseComplexType>
+		double ProbePathCost(TrackerT const& probe_tracker, CT const& start_time, CT const& endtime, Vec<CT> const& start_point, unsigned max_num_iterations)
+		{
+			using std::abs;
+
+			TrackerT quiet_tracker(probe_tracker);
+			quiet_tracker.ClearObservers();
+
+			tracking::ResumablePath<TrackerT> probe(quiet_tracker, start_time, endtime, start_point);
+			auto code = probe.Advance(max_num_iterations);
+
+			double cost = probe.NumTotalStepsTaken() * IterationCost(probe.CurrentPrecision());
+			if (code==tracking::SuccessCode::Success)
+				return cost;
+
+			double fraction_covered = static_cast<double>(abs(probe.CurrentTime()-start_time)/abs(endtime-start_time));
+			if (fraction_covered > 0)
+				cost /= fraction_covered;
+			else // no progress at all, so the whole budget is a lower bound
+				cost = max_num_iterations * IterationCost(probe.CurrentPrecision());
+
+			if (code!=tracking::SuccessCode::PathInProgress || probe.CurrentPrecision()!=DoublePrecision())
+				cost *= IterationCost(LowestMultiplePrecision());
+
+			return cost;
+		}
+
+
+
+
+		/**
+		\class PathScheduler
+
+		\brief Hands out path indices to worker threads, most expensive first.
+
+		Starting the expensive paths first, and letting idle workers pull the next path as soon as they finish one, is the longest-processing-time-first rule.  It keeps the cheap paths for the tail of a batch, where they fill in around the last expensive ones, so the workers finish close together.
+
+		Predicted costs come from wherever you have them: a probe (ProbePathCost), or the actual costs from a previous solve of the same paths (ActualCosts, as recorded by PathCostAccumulator).  Paths with no prediction are treated as equally expensive, and handed out in index order.
+
+		Between calls to Reset, Next and ReportCost may be called concurrently from many threads.
+
+		## Example
+
+		\code
+		PathScheduler scheduler(num_paths);
+		scheduler.PredictedCosts(previous_costs);
+		scheduler.Run(num_threads, [&](unsigned path_index, unsigned worker_index)
+			{
+				// track path path_index, using the tracker belonging to worker_index
+				return cost_accumulators[worker_index].Cost();
+			});
+		\endcode
+		*/
+		class PathScheduler
+		{
+		public:
+
+			/**
+			\brief Make a scheduler for a given number of paths, with no predictions.
+			*/
+			PathScheduler(unsigned num_paths) : predicted_costs_(num_paths, 1), actual_costs_(num_paths, 0), random_seed_(DefaultRandomSeed())
+			{
+				Reset();
+			}
+
+			/**
+			\brief The number of paths being scheduled.
+			*/
+			unsigned NumPaths() const
+			{
+				return predicted_costs_.size();
+			}
+
+			/**
+			\brief Set the predicted cost of one path.  Call Reset afterwards to reorder.
+			*/
+			void PredictedCost(unsigned path_index, double cost)
+			{
+				predicted_costs_.at(path_index) = cost;
+			}
+
+			/**
+			\brief Set the predicted costs of all paths, and reorder the queue.
+
+			\param costs The costs, one per path.  Typically the ActualCosts from a previous run.
+			*/
+			void PredictedCosts(std::vector<double> const& costs)
+			{
+				if (costs.size()!=NumPaths())
+					throw std::runtime_error("number of predicted costs must match number of paths in scheduler");
+				predicted_costs_ = costs;
+				Reset();
+			}
+
+			/**
+			\brief Get the predicted costs of all paths.
+			*/
+			std::vector<double> const& PredictedCosts() const
+			{
+				return predicted_costs_;
+			}
+
+			/**
+			\brief Get the actual costs reported so far.  Paths not yet reported have cost 0.
+			*/
+			std::vector<double> const& ActualCosts() const
+			{
+				return actual_costs_;
+			}
+
+
+			/**
+			\brief Set the seed from which the random stream of each path is made.  Defaults to the DefaultRandomSeed at construction.
+			*/
+			void RandomSeed(std::uint64_t seed)
+			{
+				random_seed_ = seed;
+			}
+
+			/**
+			\brief Get the seed from which the random stream of each path is made.
+			*/
+			std::uint64_t RandomSeed() const
+			{
+				return random_seed_;
+			}
+
+
+			/**
+			\brief Reorder the queue by decreasing predicted cost, and mark all paths as not yet handed out.
+
+			Not thread safe.
+			*/
+			void Reset()
+			{
+				order_.resize(NumPaths());
+				std::iota(order_.begin(), order_.end(), 0);
+				std::stable_sort(order_.begin(), order_.end(),
+				                 [this](unsigned a, unsigned b){return predicted_costs_[a] > predicted_costs_[b];});
+				next_ = 0;
+			}
+
+
+			/**
+			\brief Get the next path to work on.
+
+			\param[out] path_index The index of the path to work on, if there is one.
+			\return Whether there was a path left to work on.
+			*/
+			bool Next(unsigned & path_index)
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (next_ >= order_.size())
+					return false;
+				path_index = order_[next_++];
+				return true;
+			}
+
+
+			/**
+			\brief Record the actual cost of a path, once done.
+
+			\param path_index The index of the path.
+			\param cost The cost of the path, in the same units as the predictions.
+			*/
+			void ReportCost(unsigned path_index, double cost)
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				actual_costs_.at(path_index) = cost;
+			}
+
+
+			/**
+			\brief Work through all the paths, on a number of threads.
+
+			Each thread repeatedly pulls the next path and calls the work function with it, inside a ScopedRandomStream for the path, reporting the cost it returns.  The work function must only use resources belonging to the worker index it is passed, such as that worker's own System and tracker.
+
+			If the work function throws, no further paths are handed out, and the first exception is rethrown on the calling thread once all workers have stopped.
+
+			\param num_workers The number of threads to use.  If 1, all work is done on the calling thread.
+			\param work The function to call for each path.  Signature is double(unsigned path_index, unsigned worker_index), returning the cost of the path.
+			*/
+			void Run(unsigned num_workers, std::function<double(unsigned, unsigned)> const& work)
+			{
+				if (num_workers==0)
+					throw std::runtime_error("must use at least one worker to run a PathScheduler");
+
+				std::exception_ptr failure;
+
+				auto worker_loop = [this, &work, &failure](unsigned worker_index)
+				{
+					try
+					{
+						unsigned path_index;
+						while (Next(path_index))
+						{
+							ScopedRandomStream random_stream(random_seed_, path_index);
+							ReportCost(path_index, work(path_index, worker_index));
+						}
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(mutex_);
+						if (!failure)
+							failure = std::current_exception();
+						next_ = order_.size(); // hand out no more paths
+					}
+				};
+
+				if (num_workers==1)
+					worker_loop(0);
+				else
+				{
+					std::vector<std::thread> workers;
+					for (unsigned ii = 0; ii < num_workers; ++ii)
+						workers.emplace_back(worker_loop, ii);
+					for (auto& w : workers)
+						w.join();
+				}
+
+				if (failure)
+					std::rethrow_exception(failure);
+			}
+
+		private:
+
+			std::vector<double> predicted_costs_; ///< The predicted cost of each path.
+			std::vector<double> actual_costs_; ///< The actual cost of each path, as reported.
+			std::vector<unsigned> order_; ///< Path indices, in the order they will be handed out.
+			unsigned next_; ///< Position in order_ of the next path to hand out.
+			std::uint64_t random_seed_; ///< The seed of the random streams of the paths.
+			std::mutex mutex_; ///< Protects next_ and actual_costs_.
+		};
+
+	} // re: namespace algorithm
+} // re: namespace bertini
+
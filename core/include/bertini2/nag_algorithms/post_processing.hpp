@@ -0,0 +1,292 @@
+//This file is part of Bertini 2.
+//
+//nag_algorithms/post_processing.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//nag_algorithms/post_processing.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with nag_algorithms/post_processing.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file nag_algorithms/post_processing.hpp
+
+\brief Contains the EndpointPostProcessor, for merging duplicate endpoints of a solve and classifying the solutions as real, finite, and singular.
+*/
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bertini2/system.hpp"
+#include "bertini2/tracking/tracking_config.hpp"
+#include "bertini2/nag_algorithms/spatial_hash.hpp"
+
+namespace bertini {
+
+	namespace algorithm {
+
+		/**
+		\class EndpointPostProcessor
+
+		\brief Merge duplicate endpoints, and classify the distinct solutions, as paths finish.
+
+		Endpoints are dehomogenized with System::DehomogenizePoint, and two endpoints are the same solution when the distance between their dehomogenized coordinates is at most final_tol_times_mult from the config::PostProcessing.
+
+		Comparing every pair of endpoints is quadratic in the number of paths.  Instead, finite endpoints are kept in a SpatialHash, and each new endpoint is compared only against the few solutions near it in the hash, so adding an endpoint takes expected constant time.  Infinite endpoints are never merged.
+
+		A solution is
+		- finite, if the norm of its dehomogenized coordinates is at most endpoint_finite_threshold,
+		- real, if the imaginary part of every coordinate is at most real_threshold,
+		- singular, if more than one path converged to it, or the condition number of the Jacobian at one of its endpoints exceeds condition_number_threshold.
+
+		Add may be called concurrently from many threads, for instance from the workers of a PathScheduler as each finishes a path.  Dehomogenization and classification happen outside the lock, which is held only for the hash lookup.
+
+		\tparam ComplexType The complex number type of the endpoints.
+
+		## Example
+
+		\code
+		EndpointPostProcessor<dbl> post_processor(sys, tracking::config::PostProcessing<double>());
+		// as each path finishes, possibly on many threads
+		auto result = post_processor.Add(path_index, endpoint, condition_number);
+		if (result.is_new)
+			// a new solution
+		\endcode
+		*/
+		template<typename ComplexType>
+		class EndpointPostProcessor
+		{
+			using CT = ComplexType;
+			using RT = typename Eigen::NumTraits<CT>::Real;
+
+		public:
+
+			/**
+			\brief A distinct solution, and the paths which converged to it.
+			*/
+			struct Solution
+			{
+				Vec<CT> point; ///< The dehomogenized coordinates of the first endpoint at this solution.
+				std::vector<unsigned> path_indices; ///< The paths whose endpoints are this solution.
+				RT max_condition_number; ///< The largest condition number among the endpoints at this solution.
+				bool is_finite; ///< Whether the solution is finite.
+				bool is_real; ///< Whether the solution is real.
+
+				/**
+				\brief The number of paths which converged to this solution.
+				*/
+				unsigned Multiplicity() const
+				{
+					return path_indices.size();
+				}
+			};
+
+
+			/**
+			\brief What became of an endpoint given to Add.
+			*/
+			struct AddResult
+			{
+				unsigned solution_index; ///< The index of the solution the endpoint belongs to.
+				bool is_new; ///< Whether the endpoint is the first at its solution.
+			};
+
+
+			/**
+			\param sys The system whose endpoints are being processed.  Used for dehomogenization, so must outlive this object.
+			\param settings The thresholds for classification and merging.
+			*/
+			EndpointPostProcessor(System const& sys, tracking::config::PostProcessing<RT> const& settings) : system_(sys), settings_(settings), hash_(sys.NumNaturalVariables(), static_cast<double>(settings.final_tol_times_mult))
+			{
+				// the variable ordering is constructed lazily, which is not thread safe.  construct it now, before any concurrent dehomogenization.
+				sys.Variables();
+			}
+
+
+			/**
+			\brief Add the endpoint of a path, merging it with a known solution if it is one.
+
+			Thread safe.
+
+			\param path_index The index of the path, for recording which paths went to which solution.
+			\param endpoint The endpoint, in the variables of the system (homogenized, if the system is).
+			\param condition_number An estimate of the condition number of the Jacobian at the endpoint.  0 if not known.
+			*/
+			AddResult Add(unsigned path_index, Vec<CT> const& endpoint, RT const& condition_number = RT(0))
+			{
+				Solution candidate;
+				candidate.point = system_.DehomogenizePoint(endpoint);
+				candidate.path_indices.push_back(path_index);
+				candidate.max_condition_number = condition_number;
+				Classify(candidate);
+
+				typename SpatialHash<CT>::CellKey key;
+				bool hashable = candidate.is_finite && hash_.Cell(candidate.point, key);
+
+				std::lock_guard<std::mutex> lock(mutex_);
+
+				unsigned solution_index;
+				if (hashable && hash_.FindNear(key, [this, &candidate](unsigned ii)
+				                               {return (solutions_[ii].point - candidate.point).norm() <= settings_.final_tol_times_mult;},
+				                               solution_index))
+				{
+					auto& s = solutions_[solution_index];
+					s.path_indices.push_back(path_index);
+					if (condition_number > s.max_condition_number)
+						s.max_condition_number = condition_number;
+					return AddResult{solution_index, false};
+				}
+
+				solution_index = solutions_.size();
+				solutions_.push_back(std::move(candidate));
+				if (hashable)
+					hash_.Insert(key, solution_index);
+
+				return AddResult{solution_index, true};
+			}
+
+
+			/**
+			\brief Add many endpoints at once, on a number of threads.
+
+			\param endpoints The endpoints, whose path indices are their positions in this vector.
+			\param condition_numbers The condition numbers at the endpoints.  Either empty, or one per endpoint.
+			\param num_threads The number of threads to use.
+			*/
+			void AddAll(std::vector<Vec<CT>> const& endpoints, std::vector<RT> const& condition_numbers = std::vector<RT>(), unsigned num_threads = 1)
+			{
+				if (!condition_numbers.empty() && condition_numbers.size()!=endpoints.size())
+					throw std::runtime_error("number of condition numbers must match number of endpoints in post processing");
+				if (num_threads==0)
+					throw std::runtime_error("must use at least one thread to post process endpoints");
+
+				auto work = [this, &endpoints, &condition_numbers, num_threads](unsigned thread_index)
+				{
+					for (unsigned ii = thread_index; ii < endpoints.size(); ii += num_threads)
+						Add(ii, endpoints[ii], condition_numbers.empty() ? RT(0) : condition_numbers[ii]);
+				};
+
+				if (num_threads==1)
+				{
+					work(0);
+					return;
+				}
+
+				std::vector<std::thread> threads;
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+					threads.emplace_back(work, ii);
+				for (auto& t : threads)
+					t.join();
+			}
+
+
+			/**
+			\brief The number of distinct solutions found so far.
+			*/
+			unsigned NumSolutions() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				return solutions_.size();
+			}
+
+
+			/**
+			\brief Get a solution.  Not thread safe with respect to Add.
+			*/
+			Solution const& GetSolution(unsigned solution_index) const
+			{
+				return solutions_.at(solution_index);
+			}
+
+
+			/**
+			\brief Get all the solutions found so far.  Not thread safe with respect to Add.
+			*/
+			std::deque<Solution> const& Solutions() const
+			{
+				return solutions_;
+			}
+
+
+			/**
+			\brief Query whether a solution is singular.  This can change as more endpoints arrive.
+			*/
+			bool IsSingular(unsigned solution_index) const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				const auto& s = solutions_.at(solution_index);
+				return s.Multiplicity() > 1 || s.max_condition_number > settings_.condition_number_threshold;
+			}
+
+
+			/**
+			\brief Count the solutions which are finite, real, and nonsingular, of each combination.  Not thread safe with respect to Add.
+
+			\param[out] num_finite The number of finite solutions.
+			\param[out] num_real The number of finite real solutions.
+			\param[out] num_singular The number of finite singular solutions.
+			*/
+			void Summary(unsigned & num_finite, unsigned & num_real, unsigned & num_singular) const
+			{
+				num_finite = num_real = num_singular = 0;
+				for (unsigned ii = 0; ii < solutions_.size(); ++ii)
+				{
+					if (!solutions_[ii].is_finite)
+						continue;
+					++num_finite;
+					if (solutions_[ii].is_real)
+						++num_real;
+					if (IsSingular(ii))
+						++num_singular;
+				}
+			}
+
+		private:
+
+			/**
+			\brief Set the finite and real flags of a solution.
+			*/
+			void Classify(Solution & s) const
+			{
+				using std::abs;
+
+				// NaN fails every comparison, so is infinite
+				s.is_finite = s.point.norm() <= settings_.endpoint_finite_threshold;
+
+				s.is_real = s.is_finite;
+				for (unsigned ii = 0; ii < s.point.size() && s.is_real; ++ii)
+					if (!(abs(s.point(ii).imag()) <= settings_.real_threshold))
+						s.is_real = false;
+			}
+
+
+			System const& system_; ///< The system, for dehomogenization.
+			tracking::config::PostProcessing<RT> settings_; ///< The thresholds.
+
+			std::deque<Solution> solutions_; ///< The distinct solutions.
+			SpatialHash<CT> hash_; ///< The finite solutions, hashed by location.
+			mutable std::mutex mutex_; ///< Protects solutions_ and hash_.
+		};
+
+	} // re: namespace algorithm
+} // re: namespace bertini
+
@@ -0,0 +1,172 @@
+//This file is part of Bertini 2.
+//
+//nag_algorithms/spatial_hash.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//nag_algorithms/spatial_hash.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with nag_algorithms/spatial_hash.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file nag_algorithms/spatial_hash.hpp
+
+\brief Contains the SpatialHash, for finding points near a given point in expected constant time.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "bertini2/eigen_extensions.hpp"
+
+namespace bertini {
+
+	namespace algorithm {
+
+		/**
+		\class SpatialHash
+
+		\brief A tolerance-aware hash of points, for finding those within a tolerance of a given point without comparing against all of them.
+
+		Each point is projected onto a random complex unit vector, and the real and imaginary parts of the projection are hashed into a grid of squares as wide as the tolerance.  The projection moves no two points farther apart, so any point within tolerance of a given one lands in the same square as it or one of the eight neighbouring squares.  Only the items in those nine squares are candidates, and a random projection rarely puts distant points together, so lookup takes expected constant time.
+
+		The hash stores only item indices.  The caller keeps the points, and decides whether a candidate is actually near with a function of its own, so the final comparison is in whatever precision and norm the caller likes.
+
+		Not thread safe.  Computing the Cell of a point is const, and may be done outside a caller's lock.
+		*/
+		template<typename ComplexType>
+		class SpatialHash
+		{
+		public:
+
+			using CellKey = std::pair<std::int64_t, std::int64_t>;
+
+			/**
+			\param dimension The number of coordinates of the points.
+			\param tolerance The width of a square of the grid.  Points farther apart than this are never reported as near.
+			*/
+			SpatialHash(unsigned dimension, double tolerance) : cell_width_(tolerance)
+			{
+				projection_ = RandomOfUnits<dbl>(dimension);
+				if (projection_.size() > 0)
+					projection_ /= projection_.norm();
+			}
+
+
+			/**
+			\brief Find the square of the grid into which a point projects.
+
+			\param x The point.
+			\param[out] key The square.
+			\return false if the point cannot be hashed, because it is not finite, or its projection is too large for the width of the grid.
+			*/
+			bool Cell(Vec<ComplexType> const& x, CellKey & key) const
+			{
+				if (!(cell_width_ > 0))
+					return false;
+
+				dbl p(0);
+				for (unsigned ii = 0; ii < x.size(); ++ii)
+					p += projection_(ii) * static_cast<dbl>(x(ii));
+
+				double a = std::floor(p.real()/cell_width_), b = std::floor(p.imag()/cell_width_);
+				const double limit = 1e18;
+				if (!(std::abs(a) < limit && std::abs(b) < limit))
+					return false;
+
+				key = CellKey{static_cast<std::int64_t>(a), static_cast<std::int64_t>(b)};
+				return true;
+			}
+
+
+			/**
+			\brief Find an item near a point, among those hashed into its square or the neighbouring ones.
+
+			\param key The square of the point, from Cell.
+			\param is_near Decides whether an item is actually near the point.
+			\param[out] found The first near item, if there is one.
+			\return Whether a near item was found.
+			*/
+			bool FindNear(CellKey const& key, std::function<bool(unsigned)> const& is_near, unsigned & found) const
+			{
+				for (std::int64_t dx = -1; dx <= 1; ++dx)
+					for (std::int64_t dy = -1; dy <= 1; ++dy)
+					{
+						auto cell = cells_.find(CellKey{key.first+dx, key.second+dy});
+						if (cell==cells_.end())
+							continue;
+
+						for (auto item : cell->second)
+							if (is_near(item))
+							{
+								found = item;
+								return true;
+							}
+					}
+				return false;
+			}
+
+
+			/**
+			\brief Put an item into a square.
+			*/
+			void Insert(CellKey const& key, unsigned item)
+			{
+				cells_[key].push_back(item);
+			}
+
+
+			/**
+			\brief Remove an item from a square, if it is there.
+			*/
+			void Erase(CellKey const& key, unsigned item)
+			{
+				auto cell = cells_.find(key);
+				if (cell==cells_.end())
+					return;
+
+				auto& items = cell->second;
+				items.erase(std::remove(items.begin(), items.end(), item), items.end());
+				if (items.empty())
+					cells_.erase(cell);
+			}
+
+		private:
+
+			struct CellHash
+			{
+				std::size_t operator()(CellKey const& k) const
+				{
+					return std::hash<std::int64_t>()(k.first) ^ (std::hash<std::int64_t>()(k.second) * 0x9e3779b97f4a7c15ULL);
+				}
+			};
+
+			Vec<dbl> projection_; ///< Unit vector onto which points are projected.
+			double cell_width_; ///< The width of a square of the grid.
+			std::unordered_map<CellKey, std::vector<unsigned>, CellHash> cells_; ///< The items in each square of the grid.
+		};
+
+	} // re: namespace algorithm
+} // re: namespace bertini
+
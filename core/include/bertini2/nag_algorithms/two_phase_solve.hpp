@@ -0,0 +1,479 @@
+//This file is part of Bertini 2.
+//
+//nag_algorithms/two_phase_solve.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//nag_algorithms/two_phase_solve.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with nag_algorithms/two_phase_solve.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file nag_algorithms/two_phase_solve.hpp
+
+\brief Contains the TwoPhaseSolve, which tracks all paths to the endgame boundary, then finishes the nonsingular ones with Newton's method and schedules endgames for the rest by cost.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <queue>
+
+#include <Eigen/SVD>
+
+#include "bertini2/nag_algorithms/boundary_phase.hpp"
+
+namespace bertini {
+
+	namespace algorithm {
+
+		namespace detail {
+
+			/**
+			\brief Bring a system, and a time, to the precision of a point, so the system can be evaluated at them.  Nothing to do in double precision.
+			*/
+			inline
+			void MatchPrecision(System const& H, Vec<dbl> const& x, dbl & t)
+			{}
+
+			inline
+			void MatchPrecision(System const& H, Vec<mpfr> const& x, mpfr & t)
+			{
+				auto p = Precision(x(0));
+				DefaultPrecision(p);
+				H.precision(p);
+				Precision(t, p);
+			}
+
+		} // re: namespace detail
+
+
+		/**
+		\class TwoPhaseSolve
+
+		\brief Solve by tracking every path to the endgame boundary, then finishing each according to how singular it looks there.
+
+		Endgames are far more expensive than tracking, and their cost varies hugely from path to path, while most endpoints of most systems are nonsingular and need no endgame at all.  So solving is split in two.
+
+		In the first phase, every path is tracked to the endgame boundary by a BoundaryPhase, a fast and uniform job, with crossings caught and re-tracked along the way.
+
+		In the second phase, each path is probed a short way beyond the boundary, from \f$t_b\f$ to \f$\rho t_b\f$.  Near a singular endpoint of cycle number \f$c\f$, the smallest singular value of the Jacobian shrinks like \f$t^{1-1/c}\f$, so comparing it at the two times estimates the cycle number.  Paths whose Jacobian is well conditioned, and not getting worse, are clearly heading to nonsingular endpoints, and are finished on the tracking workers without tracking any further: one Euler step from the probe predicts the endpoint, and a few Newton corrections at t=0 refine it.  Within the endgame boundary the path of a nonsingular endpoint is short and nearly straight, so this lands well inside the basin of Newton's method.  If refinement fails, or the Jacobian at the endpoint turns out ill conditioned after all, the path goes to the endgame instead.  The rest are queued for the endgame, on a separate pool of endgame workers, most expensive first: higher estimated cycle number and worse conditioning go to the front.  The endgame workers start as soon as the first path is queued.
+
+		Every tracking worker and every endgame worker has its own deep copy of the homotopy, made with System::Clone.
+
+		\tparam TrackerT The type of tracker to use.
+		\tparam EndgameT The type of endgame to use, such as EndgameSelector<TrackerT>::Cauchy.
+
+		## Example
+
+		\code
+		TwoPhaseSolve<DoublePrecisionTracker, EndgameSelector<DoublePrecisionTracker>::Cauchy> solver(
+			H, num_tracking_workers, num_endgame_workers,
+			tracker_setup, retrack_setup,
+			[](auto & endgame){endgame.SetToleranceSettings(tolerances);});
+
+		auto results = solver.Solve(start_points, t_start, t_endgame_boundary);
+		\endcode
+
+		The default precision is shared by all threads (see DefaultPrecision), and the endgame workers run alongside the tracking workers, so an adaptive precision tracker may only be used with one tracking worker and no endgame workers.
+		*/
+		template<class TrackerT, class EndgameT>
+		class TwoPhaseSolve
+		{
+			using BaseComplexType = typename tracking::TrackerTraits<TrackerT>::BaseComplexType;
+			using CT = BaseComplexType;
+
+		public:
+
+			/**
+			\brief How a path was finished from the endgame boundary.
+			*/
+			enum class FinishMethod
+			{
+				None, ///< Not finished, because tracking to the boundary failed.
+				Refined, ///< Refined at t=0 by Newton's method, without an endgame, being clearly nonsingular.
+				Endgame ///< Finished by the endgame.
+			};
+
+
+			/**
+			\brief How to sort paths between finishing and endgames.
+			*/
+			struct Settings
+			{
+				double probe_factor = 0.5; ///< The probe runs from the boundary time \f$t_b\f$ to this times \f$t_b\f$.
+				double nonsingular_condition_threshold = 1e6; ///< Paths whose Jacobian condition number stays below this may be finished without an endgame.
+				double nonsingular_growth_threshold = 0.1; ///< Paths whose smallest singular value shrinks like a power of t no larger than this may be finished without an endgame.
+				unsigned max_estimated_cycle_number = 16; ///< Cap on the estimated cycle number.
+				double finish_tolerance = 1e-11; ///< Newton's method at t=0 finishes a nonsingular path when its step is shorter than this.
+				unsigned max_finish_newton_iterations = 5; ///< Nonsingular paths whose Newton's method at t=0 has not converged after this many steps go to the endgame.
+				std::uint64_t random_seed = DefaultRandomSeed(); ///< Finishing and endgames draw their random numbers from streams made from this seed, one per path, distinct from those of the first phase.
+			};
+
+
+			/**
+			\brief The outcome of solving one path.
+			*/
+			struct PathResult
+			{
+				typename BoundaryPhase<TrackerT>::BoundaryResult boundary; ///< The result of the first phase.
+				Vec<CT> solution; ///< The endpoint at t=0.  Only meaningful on success.
+				tracking::SuccessCode code = tracking::SuccessCode::PathInProgress; ///< The code from the last thing done to the path.
+				FinishMethod method = FinishMethod::None; ///< How the path was finished.
+				double boundary_condition_number = 0; ///< The condition number of the Jacobian at the boundary.
+				double singular_value_growth = 0; ///< The estimated exponent \f$1-1/c\f$, from the probe.
+				unsigned estimated_cycle_number = 1; ///< The cycle number estimated from the probe.
+				unsigned cycle_number = 1; ///< The cycle number found by the endgame, or 1 if there was none.
+			};
+
+
+			/**
+			\param homotopy The homotopy.  It is copied, once per worker, not referred to.
+			\param num_tracking_workers The number of tracking workers.  At least one.
+			\param num_endgame_workers The number of endgame workers.  May be 0, in which case every path needing an endgame fails with SuccessCode::Failure.
+			\param tracker_setup Sets up a freshly made tracker, for ordinary tracking.
+			\param retrack_setup Sets up a tracker for re-tracking crossed paths, at a level of tightening.  See BoundaryPhase.
+			\param endgame_setup Sets up a freshly made endgame.
+			*/
+			TwoPhaseSolve(System const& homotopy,
+			              unsigned num_tracking_workers,
+			              unsigned num_endgame_workers,
+			              std::function<void(TrackerT &)> const& tracker_setup,
+			              std::function<void(TrackerT &, unsigned)> const& retrack_setup,
+			              std::function<void(EndgameT &)> const& endgame_setup = [](EndgameT &){})
+				: boundary_(homotopy, num_tracking_workers, tracker_setup, retrack_setup)
+			{
+				CheckConcurrentTracking<TrackerT>(num_tracking_workers + num_endgame_workers);
+
+				if (num_endgame_workers > 0)
+					endgame_homotopies_ = CloneForWorkers(homotopy, num_endgame_workers);
+
+				for (const auto& H : endgame_homotopies_)
+				{
+					endgame_trackers_.push_back(std::make_shared<TrackerT>(*H));
+					tracker_setup(*endgame_trackers_.back());
+					endgames_.push_back(std::make_shared<EndgameT>(*endgame_trackers_.back()));
+					endgame_setup(*endgames_.back());
+				}
+			}
+
+
+			/**
+			\brief Set how paths are sorted between finishing and endgames.
+			*/
+			void SetSettings(Settings const& s)
+			{
+				settings_ = s;
+			}
+
+
+			/**
+			\brief Get the first phase, for changing its settings.
+			*/
+			BoundaryPhase<TrackerT> & Boundary()
+			{
+				return boundary_;
+			}
+
+
+			/**
+			\brief Solve, from start points at the start time to t=0.
+
+			\param start_points The start points of the paths.
+			\param start_time The time at which the paths start, usually 1.
+			\param boundary_time The endgame boundary, usually 0.1.
+			\return The results, one per path, in the same order as the start points.
+
+			\throws Whatever a tracker or an endgame throws.  The workers of both phases stop, and the first exception is rethrown on the calling thread.
+			*/
+			std::vector<PathResult> Solve(std::vector<Vec<CT>> const& start_points, CT const& start_time, CT const& boundary_time)
+			{
+				auto boundary_results = boundary_.Run(start_points, start_time, boundary_time);
+
+				std::vector<PathResult> results(start_points.size());
+				for (unsigned ii = 0; ii < results.size(); ++ii)
+				{
+					results[ii].boundary = boundary_results[ii];
+					results[ii].code = boundary_results[ii].code;
+				}
+
+				std::mutex mutex;
+				std::condition_variable endgame_work_available;
+				std::priority_queue<std::pair<double, unsigned>> endgame_queue;
+				bool sorting_done = false;
+				unsigned next_path = 0;
+				std::exception_ptr failure; // the first exception thrown by any worker, after which all workers stop
+
+				// record an exception, and stop all workers.  call with the lock held.
+				auto fail = [&]()
+				{
+					if (!failure)
+						failure = std::current_exception();
+					next_path = results.size();
+					endgame_work_available.notify_all();
+				};
+
+				auto sorting_loop = [&](unsigned worker_index)
+				{
+					while (true)
+					{
+						unsigned path_index;
+						{
+							std::lock_guard<std::mutex> lock(mutex);
+							if (next_path >= results.size())
+								return;
+							path_index = next_path++;
+						}
+
+						auto& r = results[path_index];
+						if (r.boundary.code!=tracking::SuccessCode::Success)
+							continue;
+
+						try
+						{
+							ScopedRandomStream random_stream(settings_.random_seed, results.size()+path_index);
+							if (FinishIfNonsingular(r, boundary_time, worker_index))
+								continue;
+						}
+						catch (...)
+						{
+							std::lock_guard<std::mutex> lock(mutex);
+							fail();
+							return;
+						}
+
+						if (endgames_.empty())
+						{
+							r.code = tracking::SuccessCode::Failure;
+							continue;
+						}
+
+						double cost = r.estimated_cycle_number * std::max(1.0, std::log10(r.boundary_condition_number));
+						std::lock_guard<std::mutex> lock(mutex);
+						endgame_queue.push({cost, path_index});
+						endgame_work_available.notify_one();
+					}
+				};
+
+				auto endgame_loop = [&](unsigned endgame_index)
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					while (true)
+					{
+						endgame_work_available.wait(lock, [&]{return failure || !endgame_queue.empty() || sorting_done;});
+						if (failure || endgame_queue.empty())
+							return;
+
+						unsigned path_index = endgame_queue.top().second;
+						endgame_queue.pop();
+						lock.unlock();
+
+						try
+						{
+							ScopedRandomStream random_stream(settings_.random_seed, 2*results.size()+path_index);
+							RunEndgame(results[path_index], boundary_time, endgame_index);
+						}
+						catch (...)
+						{
+							lock.lock();
+							fail();
+							return;
+						}
+
+						lock.lock();
+					}
+				};
+
+				std::vector<std::thread> endgame_workers;
+				for (unsigned ii = 0; ii < NumEndgameWorkers(); ++ii)
+					endgame_workers.emplace_back(endgame_loop, ii);
+
+				if (NumTrackingWorkers()==1)
+					sorting_loop(0);
+				else
+				{
+					std::vector<std::thread> sorting_workers;
+					for (unsigned ii = 0; ii < NumTrackingWorkers(); ++ii)
+						sorting_workers.emplace_back(sorting_loop, ii);
+					for (auto& w : sorting_workers)
+						w.join();
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					sorting_done = true;
+				}
+				endgame_work_available.notify_all();
+				for (auto& w : endgame_workers)
+					w.join();
+
+				if (failure)
+					std::rethrow_exception(failure);
+
+				return results;
+			}
+
+
+			/**
+			\brief The number of tracking workers.
+			*/
+			unsigned NumTrackingWorkers() const
+			{
+				return boundary_.NumWorkers();
+			}
+
+
+			/**
+			\brief The number of endgame workers.
+			*/
+			unsigned NumEndgameWorkers() const
+			{
+				return endgames_.size();
+			}
+
+
+			/**
+			\brief Get the endgame belonging to an endgame worker, for attaching observers, etc.
+			*/
+			EndgameT & GetEndgame(unsigned endgame_index)
+			{
+				return *endgames_.at(endgame_index);
+			}
+
+		private:
+
+			/**
+			\brief Probe a path beyond the boundary, estimating its cycle number, and finish it at t=0 with Newton's method if it is clearly nonsingular.
+
+			\return Whether the path was finished.  If not, it needs an endgame.
+			*/
+			bool FinishIfNonsingular(PathResult & r, CT const& boundary_time, unsigned worker_index) const
+			{
+				using std::log;
+				using std::round;
+				using RT = typename Eigen::NumTraits<CT>::Real;
+
+				const auto& H = boundary_.GetHomotopy(worker_index);
+				const auto& tracker = boundary_.GetTracker(worker_index);
+
+				double boundary_largest, boundary_smallest;
+				SingularValueExtremes(H, r.boundary.point, boundary_time, boundary_largest, boundary_smallest);
+				r.boundary_condition_number = boundary_largest/boundary_smallest;
+
+				CT probe_time = boundary_time * CT(settings_.probe_factor);
+				Vec<CT> probe_point;
+				if (tracker.TrackPath(probe_point, boundary_time, probe_time, r.boundary.point)!=tracking::SuccessCode::Success)
+				{
+					r.estimated_cycle_number = settings_.max_estimated_cycle_number;
+					return false;
+				}
+
+				double probe_largest, probe_smallest;
+				SingularValueExtremes(H, probe_point, probe_time, probe_largest, probe_smallest);
+
+				r.singular_value_growth = log(boundary_smallest/probe_smallest) / log(1/settings_.probe_factor);
+				if (!(r.singular_value_growth < 1))
+					r.estimated_cycle_number = settings_.max_estimated_cycle_number;
+				else
+				{
+					double c = round(1/(1-std::max(0.0, r.singular_value_growth)));
+					r.estimated_cycle_number = static_cast<unsigned>(std::min(c, static_cast<double>(settings_.max_estimated_cycle_number)));
+				}
+
+				if (!(probe_largest/probe_smallest <= settings_.nonsingular_condition_threshold && r.singular_value_growth <= settings_.nonsingular_growth_threshold))
+					return false;
+
+				// predict the endpoint with one Euler step, reusing the factorization from tracking to the probe, then correct at t=0
+				CT probe_time_at_point(probe_time), end_time(0);
+				detail::MatchPrecision(H, probe_point, probe_time_at_point);
+				detail::MatchPrecision(H, probe_point, end_time);
+
+				Vec<CT> dx_dt;
+				tracker.PathDerivative(dx_dt, probe_point, probe_time_at_point, RT(settings_.finish_tolerance));
+				Vec<CT> predicted = probe_point - probe_time_at_point*dx_dt;
+
+				Vec<CT> endpoint;
+				if (tracker.Refine(endpoint, predicted, end_time, RT(settings_.finish_tolerance), settings_.max_finish_newton_iterations)!=tracking::SuccessCode::Success)
+					return false;
+
+				double end_largest, end_smallest;
+				SingularValueExtremes(H, endpoint, end_time, end_largest, end_smallest);
+				if (!(end_largest/end_smallest <= settings_.nonsingular_condition_threshold))
+					return false;
+
+				r.solution = endpoint;
+				r.code = tracking::SuccessCode::Success;
+				r.method = FinishMethod::Refined;
+				r.cycle_number = 1;
+				return true;
+			}
+
+
+			/**
+			\brief Run the endgame on a path, from its boundary point.
+			*/
+			void RunEndgame(PathResult & r, CT const& boundary_time, unsigned endgame_index) const
+			{
+				auto& endgame = *endgames_[endgame_index];
+
+				r.method = FinishMethod::Endgame;
+				r.code = endgame.Run(boundary_time, r.boundary.point);
+				r.cycle_number = endgame.CycleNumber();
+				if (r.code==tracking::SuccessCode::Success)
+					r.solution = endgame.template FinalApproximation<CT>();
+			}
+
+
+			/**
+			\brief Compute the largest and smallest singular values of the Jacobian of a homotopy, with respect to the space variables.
+
+			Computed in double precision, which is plenty for estimates.
+			*/
+			static
+			void SingularValueExtremes(System const& H, Vec<CT> const& x, CT const& t, double & largest, double & smallest)
+			{
+				CT t_eval(t);
+				detail::MatchPrecision(H, x, t_eval);
+
+				Mat<CT> J = H.Jacobian(x, t_eval);
+				Mat<dbl> J_d(J.rows(), J.cols());
+				for (unsigned ii = 0; ii < J.rows(); ++ii)
+					for (unsigned jj = 0; jj < J.cols(); ++jj)
+						J_d(ii,jj) = static_cast<dbl>(J(ii,jj));
+
+				Eigen::JacobiSVD<Mat<dbl>> svd(J_d);
+				const auto& s = svd.singularValues();
+				largest = s.size() > 0 ? s(0) : 0;
+				smallest = s.size() > 0 ? s(s.size()-1) : 0;
+				if (!(smallest > 0))
+					smallest = std::numeric_limits<double>::min();
+			}
+
+
+			BoundaryPhase<TrackerT> boundary_; ///< The first phase, which owns the tracking workers' trackers.
+			std::vector<std::shared_ptr<System>> endgame_homotopies_; ///< One copy of the homotopy per endgame worker.
+			std::vector<std::shared_ptr<TrackerT>> endgame_trackers_; ///< The tracker used by each endgame worker's endgame.
+			std::vector<std::shared_ptr<EndgameT>> endgames_; ///< One endgame per endgame worker.
+			Settings settings_; ///< How to sort paths between finishing and endgames.
+		};
+
+	} // re: namespace algorithm
+} // re: namespace bertini
+
@@ -33,11 +33,13 @@ The bertini::NumTraits struct provides NumDigits and NumFuzzyDigits functions.
 #ifndef BERTINI_NUM_TRAITS_HPP
 #define BERTINI_NUM_TRAITS_HPP
 
-#include <random>
 #include <complex>
 #include <cmath>
 #include "bertini2/mpfr_complex.hpp"
 #include "bertini2/mpfr_extensions.hpp"
+#include "bertini2/random.hpp"
+
+#include <boost/random/uniform_real_distribution.hpp>
 
 
 
@@ -187,18 +189,20 @@ namespace bertini
 	{
 		using std::abs;
 		using std::sqrt;
-		std::default_random_engine generator;
-		std::uniform_real_distribution<double> distribution(-1.0,1.0);
-		std::complex<double> returnme(distribution(generator), distribution(generator));
+		auto& generator = ThreadRandomEngine();
+		boost::random::uniform_real_distribution<double> distribution(-1.0,1.0);
+		auto real_part = distribution(generator);
+		std::complex<double> returnme(real_part, distribution(generator));
 		return returnme / sqrt( abs(returnme));
 	}
 
 	template <> inline
 	std::complex<double> RandomUnit<std::complex<double> >()
 	{
-		std::default_random_engine generator;
-		std::uniform_real_distribution<double> distribution(-1.0,1.0);
-		std::complex<double> returnme(distribution(generator), distribution(generator));
+		auto& generator = ThreadRandomEngine();
+		boost::random::uniform_real_distribution<double> distribution(-1.0,1.0);
+		auto real_part = distribution(generator);
+		std::complex<double> returnme(real_part, distribution(generator));
 		return returnme / abs(returnme);
 	}
 
@@ -0,0 +1,158 @@
+//This file is part of Bertini 2.
+//
+//random.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//random.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with random.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file random.hpp
+
+\brief Per-thread random number engines, seedable for reproducible runs.
+
+All the random numbers Bertini makes -- random complex units for the AMP criteria, random coefficients for start systems and patches, random liftings for mixed volume -- are drawn from the engine belonging to the calling thread.  There is no shared generator, so parallel workers never contend for, or race on, random state.
+
+For a run to be bit-reproducible with more than one thread, the random numbers used for a unit of work (a path, say) must not depend on which thread did the work, or on what that thread did before.  To that end, wrap each unit of work in a ScopedRandomStream, keyed on the seed of the run and the index of the unit of work.  The parallel algorithms in Bertini do so.
+*/
+
+#ifndef BERTINI_RANDOM_HPP
+#define BERTINI_RANDOM_HPP
+
+#include <cstdint>
+
+#include <boost/random/mersenne_twister.hpp>
+
+namespace bertini {
+
+	/**
+	\brief The type of engine from which Bertini draws its random numbers.
+
+	Boost's engine and distributions are used in preference to the standard library's, because their output is specified, so results are the same across platforms.
+	*/
+	using RandomEngine = boost::random::mt19937;
+
+
+	/**
+	\brief Make an engine for a stream of random numbers.
+
+	Engines with the same seed and stream produce the same sequence.  Engines with different seeds or streams produce (with overwhelming probability) unrelated sequences.
+
+	\param seed The seed of the run.
+	\param stream The index of the stream, such as a path index.
+	\param substream A further index, for distinguishing several kinds of work on the same stream, such as tracking and retracking one path.
+	*/
+	RandomEngine MakeRandomEngine(std::uint64_t seed, std::uint64_t stream, std::uint64_t substream = 0);
+
+
+	/**
+	\brief Get the base seed, from which the engines of threads are seeded when first used.
+
+	Defaults to 5489, so that runs are reproducible unless a seed is set.
+	*/
+	std::uint64_t DefaultRandomSeed();
+
+
+	/**
+	\brief Set the base seed, and reseed the calling thread's engine from it.
+
+	Threads whose engines have not yet been used get engines made from the new seed.  The engines of other threads which have already been used are not affected.
+
+	\param seed The new base seed.
+	*/
+	void DefaultRandomSeed(std::uint64_t seed);
+
+
+	namespace detail {
+		/**
+		\brief Make the engine for a thread using random numbers for the first time.
+
+		Threads are numbered in the order in which they first use random numbers, and each gets the stream of the base seed with its number.
+		*/
+		RandomEngine MakeThreadRandomEngine();
+	}
+
+
+	/**
+	\brief Get the random engine belonging to the calling thread.
+
+	All of Bertini's random number generation draws from this engine.  Use it with a distribution from Boost.Random, to get the same numbers on every platform.
+	*/
+	inline
+	RandomEngine& ThreadRandomEngine()
+	{
+		thread_local RandomEngine engine = detail::MakeThreadRandomEngine();
+		return engine;
+	}
+
+
+	/**
+	\brief Reseed the calling thread's engine.
+
+	\see MakeRandomEngine
+	*/
+	inline
+	void SeedThreadRandomEngine(std::uint64_t seed, std::uint64_t stream = 0, std::uint64_t substream = 0)
+	{
+		ThreadRandomEngine() = MakeRandomEngine(seed, stream, substream);
+	}
+
+
+	/**
+	\class ScopedRandomStream
+
+	\brief Switch the calling thread to a given random stream, for the lifetime of this object.
+
+	The engine of the thread is saved at construction, and restored at destruction, so random numbers drawn inside the scope do not disturb those drawn outside it.  Scopes may nest.
+
+	## Example
+
+	\code
+	scheduler.Run(num_workers, [&](unsigned path_index, unsigned worker_index)
+		{
+			ScopedRandomStream random_stream(seed, path_index);
+			// every random number used for this path is now the same, whichever worker tracks it
+		});
+	\endcode
+	*/
+	class ScopedRandomStream
+	{
+	public:
+
+		ScopedRandomStream(std::uint64_t seed, std::uint64_t stream, std::uint64_t substream = 0) : saved_(ThreadRandomEngine())
+		{
+			SeedThreadRandomEngine(seed, stream, substream);
+		}
+
+		~ScopedRandomStream()
+		{
+			ThreadRandomEngine() = saved_;
+		}
+
+		ScopedRandomStream(ScopedRandomStream const&) = delete;
+		ScopedRandomStream& operator=(ScopedRandomStream const&) = delete;
+
+	private:
+		RandomEngine saved_; ///< The engine of the thread when this scope was entered.
+	};
+
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,111 @@
+//This file is part of Bertini 2.
+//
+//serialization.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//serialization.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with serialization.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file serialization.hpp
+
+\brief Saving and loading of Systems, start systems, and patches in the compact binary format.
+
+The text archives used elsewhere are portable, but slow to load for large systems, because every number goes through a decimal string.  The binary format is a Boost binary archive, written by the same serialize methods as the text archives.  The function trees are written recursively, from each root down, and Boost's object tracking writes each node only the first time it is met, referring back to it after that, so common subexpressions and variables stay shared on loading.  As writing and reading recurse, very deep trees need a correspondingly deep stack.  Multiple precision numbers are written as integer significands and binary exponents, with no conversion to decimal.  A differentiated System carries its Jacobian, so differentiate before saving, and the loaded system need not be differentiated again.
+
+Binary files are meant for fast startup of many worker processes on the same kind of machine.  They are not portable across architectures, nor across versions of Boost.
+*/
+
+#pragma once
+
+#include "bertini2/system.hpp"
+#include "bertini2/start_system.hpp"
+
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+
+#include <fstream>
+#include <streambuf>
+#include <vector>
+
+namespace bertini {
+
+	namespace detail {
+
+		/**
+		\brief A read-only stream buffer over a block of memory, so an archive can be read from a file loaded in one read.
+		*/
+		class MemoryStreamBuf : public std::streambuf
+		{
+		public:
+			MemoryStreamBuf(char* data, std::size_t size)
+			{
+				setg(data, data, data+size);
+			}
+		};
+
+	} // re: namespace detail
+
+
+	/**
+	\brief Save an object to a file in the binary format.
+
+	\param obj The object to save.  A System, any StartSystem, or a Patch.
+	\param filename The name of the file to write.  It is overwritten.
+	*/
+	template<typename T>
+	void SaveBinary(T const& obj, std::string const& filename)
+	{
+		std::ofstream fout(filename, std::ios::binary);
+		if (!fout)
+			throw std::runtime_error("unable to open file " + filename + " for saving in binary format");
+
+		boost::archive::binary_oarchive oa(fout);
+		oa << obj;
+	}
+
+
+	/**
+	\brief Load an object from a file in the binary format.
+
+	The whole file is read into memory with one read, and the archive is read from there.
+
+	\param obj The object to load into.  Must be of the same type as the object which was saved.
+	\param filename The name of the file to read.
+	*/
+	template<typename T>
+	void LoadBinary(T & obj, std::string const& filename)
+	{
+		std::ifstream fin(filename, std::ios::binary | std::ios::ate);
+		if (!fin)
+			throw std::runtime_error("unable to open file " + filename + " for loading in binary format");
+
+		std::vector<char> contents(static_cast<std::size_t>(fin.tellg()));
+		fin.seekg(0);
+		if (!fin.read(contents.data(), contents.size()))
+			throw std::runtime_error("unable to read file " + filename + " for loading in binary format");
+
+		detail::MemoryStreamBuf buffer(contents.data(), contents.size());
+		boost::archive::binary_iarchive ia(buffer);
+		ia >> obj;
+	}
+
+} // re: namespace bertini
+
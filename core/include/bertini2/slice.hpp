@@ -116,6 +116,104 @@ namespace bertini {
 
 
 
+		/**
+		\brief Evaluate the slice into a segment of a vector of function values, reading the sliced variables out of a longer point.
+
+		This is how a System evaluates its slices: as a dense matrix-vector product, with no function tree involved.
+
+		\param function_values The vector into which to write the values of the slice.
+		\param offset The index in function_values at which to write the first value.
+		\param x The point, containing the values of at least the sliced variables.
+		\param variable_indices The index in x of each sliced variable, in the order of the slice's variables.
+		*/
+		template<typename Derived, typename NumT>
+		void EvalInPlace(Eigen::MatrixBase<Derived> & function_values, unsigned offset, Vec<NumT> const& x, std::vector<unsigned> const& variable_indices) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar,NumT>::value,"scalar types must match");
+
+			#ifndef BERTINI_DISABLE_ASSERTS
+			assert(variable_indices.size()==NumVariables() && "must have an index for every sliced variable");
+			assert(function_values.size()>=offset+Dimension() && "function values too short to hold values of slice");
+			#endif
+
+			const Mat<NumT>& coefficients = std::get<Mat<NumT> >(coefficients_working_);
+
+			for (unsigned ii = 0; ii < Dimension(); ++ii)
+			{
+				NumT& value = function_values(offset+ii);
+				if (is_homogeneous_)
+					value = NumT(0);
+				else
+					value = std::get<Vec<NumT> >(constants_working_)(ii);
+
+				for (unsigned jj = 0; jj < NumVariables(); ++jj)
+					value += coefficients(ii,jj)*x(variable_indices[jj]);
+			}
+		}
+
+
+		/**
+		\brief Write the Jacobian of the slice into rows of a larger Jacobian matrix.
+
+		The rows are zeroed, and the coefficients are copied into the columns of the sliced variables.
+
+		\param jacobian The matrix into which to write.
+		\param offset The index of the row into which to write the first row of the slice.
+		\param variable_indices The column of each sliced variable, in the order of the slice's variables.
+		*/
+		template<typename Derived>
+		void JacobianInPlace(Eigen::MatrixBase<Derived> & jacobian, unsigned offset, std::vector<unsigned> const& variable_indices) const
+		{
+			using NumT = typename Derived::Scalar;
+
+			#ifndef BERTINI_DISABLE_ASSERTS
+			assert(variable_indices.size()==NumVariables() && "must have an index for every sliced variable");
+			assert(jacobian.rows()>=offset+Dimension() && "jacobian has too few rows to hold jacobian of slice");
+			#endif
+
+			const Mat<NumT>& coefficients = std::get<Mat<NumT> >(coefficients_working_);
+
+			for (unsigned ii = 0; ii < Dimension(); ++ii)
+			{
+				for (unsigned jj = 0; jj < jacobian.cols(); ++jj)
+					jacobian(offset+ii,jj) = NumT(0);
+				for (unsigned jj = 0; jj < NumVariables(); ++jj)
+					jacobian(offset+ii,variable_indices[jj]) = coefficients(ii,jj);
+			}
+		}
+
+
+		/**
+		\brief Get the variables on which the slice is defined, in the order of the columns of its coefficient matrix.
+		*/
+		VariableGroup const& Variables() const
+		{
+			return sliced_vars_;
+		}
+
+		/**
+		\brief Replace the variables on which the slice is defined, keeping the coefficients.  For moving the slice to a copy of its system.
+
+		\param v The new variables, one for each of the old, in the same order.
+		*/
+		void Variables(VariableGroup const& v)
+		{
+			if (v.size()!=sliced_vars_.size())
+				throw std::runtime_error("number of replacement variables for a linear slice must match the number of sliced variables");
+			sliced_vars_ = v;
+		}
+
+
+		/**
+		\brief Query whether the slice is homogeneous, that is, has no constant terms.
+		*/
+		bool IsHomogeneous() const
+		{
+			return is_homogeneous_;
+		}
+
+
+
 		/**
 		\brief Get the current precision of the slice.
 
@@ -197,16 +295,15 @@ namespace bertini {
 					for (unsigned jj(0); jj<mindim; ++jj)
 						gen(s.coefficients_highest_precision_(ii,jj), MaxPrecisionAllowed());
 
-				auto prev_precision = DefaultPrecision();
-				DefaultPrecision(MaxPrecisionAllowed());
+				{
+					ScopedDefaultPrecision highest(MaxPrecisionAllowed());
 
-				auto QR_factorization = Eigen::HouseholderQR<Mat<mpfr> >(s.coefficients_highest_precision_);
-				s.coefficients_highest_precision_ = QR_factorization.householderQ()*Mat<mpfr>::Identity(maxdim, mindim);
+					auto QR_factorization = Eigen::HouseholderQR<Mat<mpfr> >(s.coefficients_highest_precision_);
+					s.coefficients_highest_precision_ = QR_factorization.householderQ()*Mat<mpfr>::Identity(maxdim, mindim);
+				}
 				
 				if (need_transpose)
 					s.coefficients_highest_precision_.transposeInPlace();
-
-				DefaultPrecision(prev_precision);
 			}
 			else
 			{
@@ -262,16 +359,24 @@ namespace bertini {
 
 		}
 
+		// for serialization only
+		LinearSlice() = default;
+
 		friend class boost::serialization::access;
 
 		template <typename Archive>
 		void serialize(Archive& ar, const unsigned version) {
 			ar & precision_;
+			ar & num_dims_sliced_;
+			ar & is_homogeneous_;
 
 			ar & coefficients_highest_precision_;
+			ar & constants_highest_precision_;
 
 			ar & std::get<0>(coefficients_working_);
 			ar & std::get<1>(coefficients_working_);
+			ar & std::get<0>(constants_working_);
+			ar & std::get<1>(constants_working_);
 			ar & sliced_vars_;
 		}
 
@@ -279,6 +384,7 @@ namespace bertini {
 	};
 
 
+	inline
 	std::ostream& operator<<(std::ostream& out, LinearSlice const& s)
 	{
 		out << "linear slice on " << s.NumVariables() << " variables:\n";
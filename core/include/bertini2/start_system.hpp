@@ -166,6 +166,257 @@ namespace bertini
 			}
 
 		};
+
+
+
+
+
+
+		/**
+		\brief StartSystem for multihomogeneous polynomial systems.
+
+		For a target system whose variables come in several groups, affine or homogeneous, the number of paths from a total degree start system is usually far above the number of solutions.  The m-homogeneous start system respects the grouping.  If function \f$i\f$ has degree \f$d_{ij}\f$ in group \f$j\f$, the start function is the product, over the groups, of \f$d_{ij}\f$ random linear forms in the variables of group \f$j\f$.  Linear forms for affine groups have a random constant term, and linear forms for homogeneous groups do not.
+
+		A start point comes from choosing, for each function, one group and one of the linear forms for that group, so that each group is chosen as many times as its dimension (the number of variables in an affine group, one less for a homogeneous group).  The linear forms chosen for each group then form a small square linear system, whose solution is that group's part of the start point.  The number of start points is the m-homogeneous Bezout number, the sum over valid choices of groups of the product of the chosen degrees.
+
+		The valid choices of groups are enumerated at construction.  Start points are generated on demand by index (mpz_int), as for TotalDegree.
+
+		The target system must have no ungrouped variables and no path variable, must be polynomial, and must have as many functions as the sum of the dimensions of its variable groups.
+		*/
+		class MultiHomogeneous : public StartSystem
+		{
+		public:
+			MultiHomogeneous() = default;
+			virtual ~MultiHomogeneous() = default;
+
+			/**
+			 Constructor for making a multihomogeneous start system from a polynomial system
+
+			 \throws std::runtime_error, if the input target system is not square with respect to its variable groups, is not polynomial, has a path variable already, or has ungrouped variables.
+			*/
+			MultiHomogeneous(System const& s);
+
+
+			/**
+			Get the number of start points for this multihomogeneous start system.  This is the m-homogeneous Bezout number for the target system.
+			*/
+			mpz_int NumStartPoints() const override;
+
+
+			/**
+			Get the degree of each function in each variable group.  The outer index is the function, the inner the group, with groups in the order in which they were added.
+			*/
+			std::vector<std::vector<int> > const& DegreeMatrix() const
+			{
+				return degree_matrix_;
+			}
+
+
+			/**
+			Get the number of valid choices of groups, each of which contributes a block of start points.
+			*/
+			size_t NumGroupChoices() const
+			{
+				return group_choices_.size();
+			}
+
+			MultiHomogeneous& operator+=(System const& sys) = delete;
+
+		private:
+
+			/**
+			Get the ith start point, in double precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<dbl> GenerateStartPoint(dbl,mpz_int index) const override;
+
+			/**
+			Get the ith start point, in current default precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<mpfr> GenerateStartPoint(mpfr,mpz_int index) const override;
+
+			/**
+			Generate the ith start point, in the numeric type T.
+			*/
+			template<typename T>
+			Vec<T> GenerateStartPointT(mpz_int index) const;
+
+			/**
+			Make the linear form for group group_index with the given coefficients.  The constant term, for affine groups, is last.
+			*/
+			Nd LinearForm(unsigned group_index, std::vector<std::shared_ptr<node::Rational> > const& coefficients) const;
+
+			/**
+			Find all valid choices of groups for the functions, and the number of start points each gives.
+			*/
+			void EnumerateGroupChoices();
+
+
+			std::vector<VariableGroup> groups_; ///< the natural variables in each group, in FIFO order.
+			std::vector<bool> group_is_affine_; ///< whether each group is affine.  If not, it is homogeneous.
+			std::vector<unsigned> group_dimensions_; ///< the dimension of each group.  for affine, the number of variables, and for homogeneous, one less.
+
+			std::vector<std::vector<int> > degree_matrix_; ///< degree_matrix_[i][j] is the degree of function i in group j.
+
+			std::vector<std::vector<std::shared_ptr<node::Rational> > > linear_form_coefficients_; ///< the coefficients of all the linear forms, with the constant term last for affine groups.
+			std::vector<std::vector<size_t> > linear_form_offsets_; ///< linear_form_offsets_[i][j] is the index into linear_form_coefficients_ of the first linear form for function i in group j.
+
+			std::vector<std::vector<unsigned> > group_choices_; ///< each valid choice of group, for each function.
+			std::vector<mpz_int> cumulative_num_start_points_; ///< the number of start points given by choices up to and including each one.
+
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				ar & groups_;
+				ar & group_is_affine_;
+				ar & group_dimensions_;
+				ar & degree_matrix_;
+				ar & linear_form_coefficients_;
+				ar & linear_form_offsets_;
+				ar & group_choices_;
+				ar & cumulative_num_start_points_;
+			}
+
+		};
+
+
+
+
+
+		/**
+		\brief StartSystem for polynomial systems with a sparse linear-product structure.
+
+		Each start function is a product of random linear forms.  Function \f$i\f$ has a partition of (some of) the variables into parts, and for each part \f$P\f$ the product has \f$\deg_P f_i\f$ linear forms in the variables of \f$P\f$, each with a random constant term.  By default, a function whose degree is the sum of its degrees in the individual variables (such as a multilinear function) gets one part per variable appearing in it, and any other function gets a single part, consisting of the variables which actually appear in it.  Either way, a variable absent from a function is absent from its start function too.  Partitions can also be given explicitly, function by function, in which case this is the partitioned linear-product start system; m-homogeneous and total degree start systems are the special cases in which every function has the same partition.
+
+		A start point comes from choosing one linear form from each start function.  The chosen forms are a square linear system, which has a unique solution exactly when the functions can be matched to distinct variables, each to a variable in the part its form came from.  The number of start points is the number of choices for which this matching exists, which for sparse systems can be much less than the total degree.
+
+		The valid choices of parts are enumerated at construction.  Start points are generated on demand by index (mpz_int), as for TotalDegree.
+
+		As for TotalDegree, the target system must be square, polynomial, have one affine variable group, and have no path variable.
+		*/
+		class LinearProduct : public StartSystem
+		{
+		public:
+			LinearProduct() = default;
+			virtual ~LinearProduct() = default;
+
+			/**
+			 Constructor for making a linear-product start system from a polynomial system, with the default partitions.
+
+			 \throws std::runtime_error, if the input target system is not square, is not polynomial, has a path variable already, does not have exactly one variable group which is affine, or has a function in which no variable appears.
+			*/
+			LinearProduct(System const& s);
+
+
+			/**
+			 Constructor for making a linear-product start system from a polynomial system, with given partitions of the variables.
+
+			 \param s The target system.
+			 \param partitions For each function, the parts of its partition.  Parts must be disjoint subsets of the variables of s, and every variable appearing in a function must be in one of its parts.
+
+			 \throws std::runtime_error, for the same reasons as the other constructor, or if the partitions are not valid for the functions of s.
+			*/
+			LinearProduct(System const& s, std::vector<std::vector<VariableGroup> > const& partitions);
+
+
+			/**
+			Get the number of start points for this linear-product start system.  This is the linear-product root count for the target system.
+			*/
+			mpz_int NumStartPoints() const override;
+
+
+			/**
+			Get the degree of each function in each part of its partition.  The outer index is the function, the inner the part.
+			*/
+			std::vector<std::vector<int> > const& PartDegrees() const
+			{
+				return part_degrees_;
+			}
+
+
+			/**
+			Get the number of valid choices of parts, each of which contributes a block of start points.
+			*/
+			size_t NumPartChoices() const
+			{
+				return part_choices_.size();
+			}
+
+			LinearProduct& operator+=(System const& sys) = delete;
+
+		private:
+
+			/**
+			Get the ith start point, in double precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<dbl> GenerateStartPoint(dbl,mpz_int index) const override;
+
+			/**
+			Get the ith start point, in current default precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<mpfr> GenerateStartPoint(mpfr,mpz_int index) const override;
+
+			/**
+			Generate the ith start point, in the numeric type T.
+			*/
+			template<typename T>
+			Vec<T> GenerateStartPointT(mpz_int index) const;
+
+			/**
+			Check the system is suitable, and copy its variable structure.  Common to both constructors.
+			*/
+			void CheckAndCopyStructure(System const& s);
+
+			/**
+			Given the partitions, compute the degrees, make the start functions, and enumerate the valid choices of parts.
+			*/
+			void Construct(System const& s, std::vector<std::vector<VariableGroup> > const& partitions);
+
+			/**
+			Find all valid choices of parts for the functions, and the number of start points each gives.
+			*/
+			void EnumeratePartChoices();
+
+			/**
+			Whether the functions 0 through num_functions-1 can be matched to distinct variables, each in the part chosen for it.
+			*/
+			bool HaveMatching(std::vector<unsigned> const& choice, unsigned num_functions) const;
+
+
+			std::vector<std::vector<std::vector<unsigned> > > part_variable_indices_; ///< part_variable_indices_[i][k] is the indices, into the variable group, of the variables in part k of function i.
+			std::vector<std::vector<int> > part_degrees_; ///< part_degrees_[i][k] is the degree of function i in part k of its partition.
+
+			std::vector<std::vector<std::shared_ptr<node::Rational> > > linear_form_coefficients_; ///< the coefficients of all the linear forms, with the constant term last.
+			std::vector<std::vector<size_t> > linear_form_offsets_; ///< linear_form_offsets_[i][k] is the index into linear_form_coefficients_ of the first linear form for function i in part k.
+
+			std::vector<std::vector<unsigned> > part_choices_; ///< each valid choice of part, for each function.
+			std::vector<mpz_int> cumulative_num_start_points_; ///< the number of start points given by choices up to and including each one.
+
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				ar & part_variable_indices_;
+				ar & part_degrees_;
+				ar & linear_form_coefficients_;
+				ar & linear_form_offsets_;
+				ar & part_choices_;
+				ar & cumulative_num_start_points_;
+			}
+
+		};
 	}
 }
 
@@ -0,0 +1,151 @@
+//This file is part of Bertini 2.
+//
+//start_system/mixed_volume.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//start_system/mixed_volume.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with start_system/mixed_volume.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file start_system/mixed_volume.hpp
+
+\brief Mixed cells and mixed volumes of Newton polytopes, and the binomial systems they give, for polyhedral homotopies.
+*/
+
+#ifndef BERTINI_START_SYSTEM_MIXED_VOLUME_HPP
+#define BERTINI_START_SYSTEM_MIXED_VOLUME_HPP
+
+#include <utility>
+#include <vector>
+
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include "bertini2/mpfr_extensions.hpp"
+
+
+namespace bertini 
+{
+	namespace start_system{
+
+		namespace polyhedral{
+
+			using Exponent = std::vector<int>; ///< The exponents of a monomial, one per variable.
+			using Support = std::vector<Exponent>; ///< The exponents of the monomials of a polynomial.
+			using Lifting = std::vector<int>; ///< A lifting value for each point of a support.
+
+
+			/**
+			\brief A fine mixed cell of a regular mixed subdivision.
+
+			For \f$n\f$ supports in \f$n\f$ variables, with a generic lifting, a mixed cell is spanned by one edge from each support.  The lifted edges are the points at which the linear functional with inner normal \f$(\alpha,1)\f$ is minimized over each lifted support.
+			*/
+			struct MixedCell
+			{
+				std::vector<std::pair<unsigned, unsigned> > edges; ///< For each support, the indices of the two points spanning the cell's edge in it.
+				std::vector<mpq_rational> inner_normal; ///< The first n coordinates \f$\alpha\f$ of the inner normal, whose last coordinate is 1.
+				mpz_int volume; ///< The normalized volume of the cell, which is the number of solutions of its binomial system.
+
+			private:
+				friend class boost::serialization::access;
+
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version) {
+					ar & edges;
+					ar & inner_normal;
+					ar & volume;
+				}
+			};
+
+
+			/**
+			\brief Make a random integer lifting for each point of each support, drawn from the calling thread's random engine.
+
+			The lifting values become powers of the path variable in the cell homotopies, so they should be small, lest the homotopies be stiff.
+
+			\param supports The supports to lift.
+			\param max_value Lifting values are drawn uniformly from [0,max_value).
+			*/
+			std::vector<Lifting> RandomLifting(std::vector<Support> const& supports, int max_value = 32);
+
+
+			/**
+			\brief Compute the fine mixed cells of the mixed subdivision induced by a lifting.
+
+			Edges are enumerated depth-first, one support at a time.  A partial choice of edges is abandoned as soon as the edges are linearly dependent, or no inner normal makes all the chosen edges lower edges at once.  The latter is checked with a small linear program in double precision, and a choice is only abandoned if the duals of the linear program give a certificate of infeasibility which checks out in exact rational arithmetic.  The candidate edges of the first support are shared out between threads.  Each cell found is verified in exact rational arithmetic.
+
+			\param supports The supports, n of them, each with exponents of length n.
+			\param lifting The lifting values, one for each point of each support.
+			\param[out] cells The mixed cells.  Sorted by their edges.
+			\param num_threads The number of threads to use.  If 0, the hardware concurrency is used.
+			\return Whether the lifting was generic.  If not, some point other than an edge's endpoints attained a minimum, the cells may be wrong, and a new lifting should be drawn.
+
+			\throws std::runtime_error, if the number of supports does not match the number of variables, or the lifting does not match the supports.
+			*/
+			bool MixedCells(std::vector<Support> const& supports, std::vector<Lifting> const& lifting, std::vector<MixedCell> & cells, unsigned num_threads = 0);
+
+
+			/**
+			\brief Compute mixed cells for a random generic lifting.
+
+			Draws small liftings until one is generic, doubling the range of the lifting values after each lifting which is not.
+
+			\param supports The supports, n of them, each with exponents of length n.
+			\param[out] lifting The lifting used.
+			\param num_threads The number of threads to use.  If 0, the hardware concurrency is used.
+			\return The mixed cells.
+
+			\throws std::runtime_error, if no generic lifting is found after a number of tries.
+			*/
+			std::vector<MixedCell> MixedCells(std::vector<Support> const& supports, std::vector<Lifting> & lifting, unsigned num_threads = 0);
+
+
+			/**
+			\brief The mixed volume of the supports, the sum of the volumes of the mixed cells.
+			*/
+			mpz_int MixedVolume(std::vector<MixedCell> const& cells);
+
+
+			/**
+			\brief The mixed volume of the supports, computed from a random lifting.
+
+			This is the BKK bound on the number of isolated solutions in \f$(\mathbb{C}^*)^n\f$ of a system with the given supports.  Include the origin in every support for a bound on solutions in \f$\mathbb{C}^n\f$.
+			*/
+			mpz_int MixedVolume(std::vector<Support> const& supports, unsigned num_threads = 0);
+
+
+			/**
+			\brief Column-reduce an integer matrix to lower triangular form.
+
+			Finds a unimodular W with V W = L, L lower triangular.  The binomial system \f$x^V = \beta\f$ (row i of V the exponents in equation i) becomes, under the monomial change of variables \f$x_j = \prod_k y_k^{W_{jk}}\f$, the triangular system \f$y^L = \beta\f$, which has \f$\prod_k |L_{kk}| = |\det V|\f$ solutions.
+
+			\param V A square, nonsingular, integer matrix.
+			\param[out] L The lower triangular matrix.
+			\param[out] W The unimodular transform.
+			*/
+			void LowerTriangularize(std::vector<std::vector<mpz_int> > const& V, std::vector<std::vector<mpz_int> > & L, std::vector<std::vector<mpz_int> > & W);
+
+		} // re: namespace polyhedral
+	}
+}
+
+
+#endif
+
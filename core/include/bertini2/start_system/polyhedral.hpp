@@ -0,0 +1,182 @@
+//This file is part of Bertini 2.
+//
+//start_system/polyhedral.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//start_system/polyhedral.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with start_system/polyhedral.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file start_system/polyhedral.hpp
+
+\brief Defines the polyhedral start system, whose number of start points is the mixed volume of the target system.
+*/
+
+#ifndef BERTINI_START_SYSTEM_POLYHEDRAL_HPP
+#define BERTINI_START_SYSTEM_POLYHEDRAL_HPP
+
+#include "bertini2/start_system.hpp"
+#include "bertini2/start_system/mixed_volume.hpp"
+
+
+namespace bertini 
+{
+	namespace start_system{
+
+		/**
+		\brief StartSystem for sparse polynomial systems, with as many start points as the mixed volume.
+
+		The start system has the same monomials as the target system, together with a constant term in every function, and random coefficients.  By the BKK theorem, it has as many solutions as the mixed volume of its Newton polytopes, and the target system has at most that many isolated solutions.  For sparse systems this is often far below the total degree, so the homotopy from this start system to the target, \f$(1-t) f + \gamma t g\f$, tracks far fewer paths than the total degree homotopy, and few go to infinity.
+
+		The solutions of this start system are not known in closed form; they are found by polyhedral homotopies.  The mixed cells are computed at construction, from a random lifting of the supports.  Each mixed cell gives a binomial system with as many solutions as the cell's volume, which are computed exactly by a monomial change of variables, and a homotopy from the binomial system at path variable 1 to this start system at 0.  StartPoint(index) tracks the index-th path of the appropriate cell homotopy, so getting a start point costs one path.  The cell homotopies are also available, with their start points, for tracking in whatever manner you like, for example with an AMPTracker, or in parallel.
+
+		As for TotalDegree, the target system must be square, polynomial, have one affine variable group, and have no path variable.
+
+		The cell homotopies share variables with this system, so this system and its cell homotopies must be used from only one thread at a time.
+		*/
+		class Polyhedral : public StartSystem
+		{
+		public:
+			Polyhedral() = default;
+			virtual ~Polyhedral() = default;
+
+			/**
+			 Constructor for making a polyhedral start system from a polynomial system.
+
+			 \param s The target system.
+			 \param num_threads The number of threads to use for computing the mixed cells.  If 0, the hardware concurrency is used.
+
+			 \throws std::runtime_error, if the input target system is not square, is not polynomial, has a path variable already, has more than one variable group, or has any homogeneous variable groups.
+			*/
+			Polyhedral(System const& s, unsigned num_threads = 0);
+
+
+			/**
+			Get the number of start points for this polyhedral start system.  This is the mixed volume of the supports of the target system, each with the origin included.
+			*/
+			mpz_int NumStartPoints() const override;
+
+
+			/**
+			Get the supports of the functions, in terms of the natural variables.  Each includes the origin.
+			*/
+			std::vector<polyhedral::Support> const& Supports() const
+			{
+				return supports_;
+			}
+
+
+			/**
+			Get the mixed cells, whose volumes sum to the number of start points.
+			*/
+			std::vector<polyhedral::MixedCell> const& MixedCells() const
+			{
+				return cells_;
+			}
+
+
+			/**
+			\brief Get the homotopy for a mixed cell.
+
+			The homotopy is in the natural variables, with its own path variable.  At path variable 1 it is the cell's binomial system, after a change of coordinates, and at 0 it is this start system, dehomogenized.  Track from 1 to 0, starting from BinomialStartPoint.  Made on first request, then kept.
+
+			\param cell_index The index of the cell.
+			*/
+			System const& CellHomotopy(size_t cell_index) const;
+
+
+			/**
+			\brief Get the point from which to track the cell homotopy, to find the index-th start point.
+
+			\param index The index of the start point.
+			\param[out] cell_index The index of the cell, whose homotopy to track.
+			\return The solution of the cell's binomial system, in the natural variables.
+			*/
+			template<typename T>
+			Vec<T> BinomialStartPoint(mpz_int index, size_t & cell_index) const;
+
+
+			Polyhedral& operator+=(System const& sys) = delete;
+
+		private:
+
+			/**
+			Get the ith start point, in double precision, by tracking a path of a cell homotopy with a DoublePrecisionTracker.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<dbl> GenerateStartPoint(dbl,mpz_int index) const override;
+
+			/**
+			Get the ith start point, in current default precision, by tracking a path of a cell homotopy with an AMPTracker.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<mpfr> GenerateStartPoint(mpfr,mpz_int index) const override;
+
+			/**
+			Generate the ith start point, in the numeric type T.
+			*/
+			template<typename T>
+			Vec<T> GenerateStartPointT(mpz_int index) const;
+
+			/**
+			Make the homotopy for a mixed cell.
+			*/
+			std::shared_ptr<System> MakeCellHomotopy(size_t cell_index) const;
+
+
+			std::vector<polyhedral::Support> supports_; ///< the support of each function, including the origin.
+			std::vector<polyhedral::Lifting> lifting_; ///< the lifting values used to find the mixed cells.
+			std::vector<polyhedral::MixedCell> cells_; ///< the mixed cells.
+			std::vector<mpz_int> cumulative_num_start_points_; ///< the number of start points given by cells up to and including each one.
+
+			std::vector<std::vector<std::vector<mpz_int> > > cell_lower_; ///< for each cell, the lower triangular form of its binomial system's exponent matrix.
+			std::vector<std::vector<std::vector<mpz_int> > > cell_transform_; ///< for each cell, the unimodular change of variables which triangularizes its binomial system.
+
+			std::vector<std::vector<std::shared_ptr<node::Rational> > > coefficients_; ///< coefficients_[i][j] is the coefficient of monomial j of supports_[i] in function i.
+
+			std::shared_ptr<node::Variable> path_variable_; ///< the path variable for the cell homotopies.
+			mutable std::vector<std::shared_ptr<System> > cell_homotopies_; ///< the cell homotopies, made on demand.
+
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				ar & supports_;
+				ar & lifting_;
+				ar & cells_;
+				ar & cumulative_num_start_points_;
+				ar & cell_lower_;
+				ar & cell_transform_;
+				ar & coefficients_;
+				ar & path_variable_;
+				cell_homotopies_.resize(cells_.size());
+			}
+
+		};
+	}
+}
+
+
+#endif
+
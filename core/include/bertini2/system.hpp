@@ -37,7 +37,10 @@
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/export.hpp>
+#include <boost/serialization/version.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/deque.hpp>
@@ -50,8 +53,10 @@
 
 #include "bertini2/function_tree.hpp"
 #include "bertini2/patch.hpp"
+#include "bertini2/slice.hpp"
 
 #include "bertini2/limbo.hpp"
+#include "bertini2/detail/telemetry.hpp"
 
 
 
@@ -89,9 +94,18 @@ namespace bertini {
 		
 		/** 
 		\brief The copy operator
+
+		The copy shares the nodes of the function trees with the original, and so their stored values.  To evaluate on several threads at once, use Clone instead.
 		*/
 		System(System const& other);
 
+		/**
+		\brief Make a deep copy of the system, sharing no nodes with this one.
+
+		Every node reachable from the system -- variables, functions, subfunctions, parameters, and the Jacobian if the system has been differentiated -- is copied in one pass over the trees, with nodes shared within the system shared in the same way within the copy.  Variables are replaced by their copies everywhere, including the variable groups, the ordering, and the slices.  The copy and the original may be evaluated on different threads at the same time, so make one per worker.
+		*/
+		System Clone() const;
+
 		/** 
 		\brief The move copy operator
 		*/
@@ -118,6 +132,8 @@ namespace bertini {
 		/**
 		Change the precision of the entire system's functions, subfunctions, and all other nodes.
 
+		The temporaries of multiple precision evaluation are made at the default precision, so set that to match, with DefaultPrecision or a ScopedDefaultPrecision.  The default precision is shared by all threads, so systems evaluated on different threads at once must all work at it.
+
 		\param new_precision The new precision, in digits, to work in.  This only affects the mpfr types, not double.  To use low-precision (doubles), use that number type in the templated functions.
 		*/
 		void precision(unsigned new_precision) const;
@@ -132,9 +148,38 @@ namespace bertini {
 
 		/**
 		 \brief Compute and internally store the symbolic Jacobian of the system.
+
+		 If differentiation is lazy, this only makes room for the Jacobian, and each function is differentiated when its derivatives are first evaluated.  \see LazyDifferentiation
 		*/
 		void Differentiate() const;
 
+		/**
+		 \brief Compute and internally store the symbolic Jacobian of the system, differentiating the functions on several threads.
+
+		 The functions are differentiated independently, and handed out to the threads one at a time.  Differentiation only reads the function trees.  The nodes of the derivatives are made at the default precision, which is shared by all threads, so do not change it while differentiating.  The result is the same as from Differentiate(), and is computed in full even if differentiation is lazy.
+
+		 \param num_threads The number of threads to use.  If 1, all functions are differentiated on the calling thread.
+		*/
+		void Differentiate(unsigned num_threads) const;
+
+		/**
+		 \brief Set whether to differentiate each function only when its derivatives are first evaluated.
+
+		 Lazy differentiation spreads the cost of differentiating over the first evaluations of the Jacobian, and saves it entirely for functions whose derivatives are never evaluated.  Off by default.
+		*/
+		void LazyDifferentiation(bool lazy)
+		{
+			lazy_differentiation_ = lazy;
+		}
+
+		/**
+		 \brief Get whether differentiation is lazy.
+		*/
+		bool LazyDifferentiation() const
+		{
+			return lazy_differentiation_;
+		}
+
 
 		
 		
@@ -159,6 +204,8 @@ namespace bertini {
 				throw std::runtime_error(ss.str());
 			}
 
+			BERTINI_TELEMETRY_INCREMENT(telemetry::ByPrecision<T>(telemetry::Counter::SystemEvaluationsDouble, telemetry::Counter::SystemEvaluationsMultiple));
+
 			// the Reset() function call traverses the entire tree, resetting everything.
 			// TODO: it has the unfortunate side effect of resetting constant functions, too.
 			for (const auto& iter : functions_) 
@@ -170,6 +217,9 @@ namespace bertini {
 				(*iter)->EvalInPlace<T>(function_values(counter));
 			}
 
+			if (IsSliced())
+				EvalSlicesInPlace(function_values, std::get<Vec<T> >(current_variable_values_));
+
 			if (IsPatched())
 				patch_.EvalInPlace(function_values,
 									std::get<Vec<T> >(current_variable_values_));
@@ -360,6 +410,8 @@ namespace bertini {
 			{
 				throw std::runtime_error("trying to evaluate jacobian of system in place, but input J doesn't have right number of columns or rows");
 			}
+
+			BERTINI_TELEMETRY_INCREMENT(telemetry::ByPrecision<T>(telemetry::Counter::JacobianEvaluationsDouble, telemetry::Counter::JacobianEvaluationsMultiple));
 			
 			const auto& vars = Variables();
 
@@ -367,12 +419,19 @@ namespace bertini {
 				Differentiate();
 			else
 				for (const auto& iter : jacobian_) 
-					iter->Reset();
+					if (iter)
+						iter->Reset();
 
 			for (int ii = 0; ii < NumFunctions(); ++ii)
+			{
+				const auto& jac = FunctionJacobian(ii);
 				for (int jj = 0; jj < NumVariables(); ++jj)
-					jacobian_[ii]->EvalJInPlace<T>(J(ii,jj),vars[jj]);
+					jac->EvalJInPlace<T>(J(ii,jj),vars[jj]);
+			}
 				
+			if (IsSliced())
+				SliceJacobiansInPlace(J);
+
 			if (IsPatched())
 				patch_.JacobianInPlace(J,std::get<Vec<T> >(current_variable_values_));
 			
@@ -566,11 +625,11 @@ namespace bertini {
 
 			
 			for (int ii = 0; ii < NumFunctions(); ++ii)
-				ds_dt(ii) = jacobian_[ii]->EvalJ<T>(path_variable_);
+				ds_dt(ii) = FunctionJacobian(ii)->EvalJ<T>(path_variable_);
 
-			if (IsPatched())
-				for (int ii = 0; ii < NumTotalVariableGroups(); ++ii)
-					ds_dt(ii+NumFunctions()) = T(0);
+			// slices and patches do not depend on the path variable
+			for (int ii = NumFunctions(); ii < NumTotalFunctions(); ++ii)
+				ds_dt(ii) = T(0);
 			
 		}
 
@@ -646,7 +705,12 @@ namespace bertini {
 		}
 
 		/**
-		Get the total number of functions, including patches
+		Get the number of slice functions in this system, that is, the total dimension of the slices.
+		*/
+		size_t NumSliceFunctions() const;
+
+		/**
+		Get the total number of functions, including slices and patches.  The slice functions come after the system's functions, and the patches come last.
 		*/
 		size_t NumTotalFunctions() const;
 
@@ -986,6 +1050,27 @@ namespace bertini {
 		{
 			return variable_groups_[index];
 		}
+
+		/**
+		\brief Get a homogeneous variable group the class has defined.
+
+		It is up to you to ensure this group exists.
+		*/
+		VariableGroup const& HomVariableGroup(size_t index) const
+		{
+			return hom_variable_groups_[index];
+		}
+
+		/**
+		\brief Get the types of the variable groups, in the order in which they were added.
+
+		This is the FIFO ordering used to order the variables.
+		*/
+		std::vector<VariableGroupType> const& VariableGroupTypes() const
+		{
+			return time_order_of_variable_groups_;
+		}
+
 		/**
 		\brief Get the sizes of the variable groups, according to the current ordering
 		*/
@@ -1145,6 +1230,48 @@ namespace bertini {
 		{
 			patch_.RescalePointToFitInPlace(x);
 		}
+
+
+
+
+		/////////////
+		//
+		//  Functions regarding slices.
+		//
+		//////////////
+
+
+		/**
+		\brief Add a linear slice to the system.
+
+		The slice's functions are appended after the system's functions, and before the patches.  They are evaluated as a dense matrix-vector product, not as part of the function tree, so adding, removing, or moving slices never requires re-differentiation.  This makes slicing cheap enough to use freely for witness sets and moving slices.
+
+		The variables of the slice must be variables of the system, which is checked the first time the system is evaluated with the slice.
+
+		\param s The slice to add.  It is copied.
+		*/
+		void AddSlice(LinearSlice const& s);
+
+		/**
+		\brief Remove all slices from the system.
+		*/
+		void ClearSlices();
+
+		/**
+		\brief Get the slices of the system, in the order in which their functions appear.
+		*/
+		std::vector<LinearSlice> const& Slices() const
+		{
+			return slices_;
+		}
+
+		/**
+		\brief Query whether the system has any slices.
+		*/
+		bool IsSliced() const
+		{
+			return !slices_.empty();
+		}
 		/**
 		 \brief Overloaded operator for printing to an arbirtary out stream.
 		 */
@@ -1175,6 +1302,8 @@ namespace bertini {
 		\throws std::runtime_error, if the systems are not of compatible size -- either in number of functions, or variables.  Does not check the structure of the variables, just the numbers.
 		
 		\throws std::runtime_error, if the patches are not compatible.  The patches must be either the same, absent, or present in one system.  They propagate to the resulting system.
+
+		\throws std::runtime_error, if both systems are sliced.  The sum of two slices is not a slice, so the slices may be present in at most one system, and propagate to the resulting system.
 		*/
 		System& operator+=(System const& rhs);
 
@@ -1209,6 +1338,29 @@ namespace bertini {
 		friend const System operator*(Nd const&  N, System const& s);
 	private:
 
+		/**
+		\brief Differentiate one function, making its Jacobian node.
+		*/
+		Jac DifferentiateFunction(unsigned index) const;
+
+
+		/**
+		\brief Get the Jacobian node of a function, differentiating the function first if differentiation is lazy and it has not been differentiated yet.
+
+		Call only once the system is differentiated.
+		*/
+		Jac const& FunctionJacobian(unsigned index) const
+		{
+			auto& jac = jacobian_[index];
+			if (!jac)
+			{
+				jac = DifferentiateFunction(index);
+				jac->precision(precision_);
+			}
+			return jac;
+		}
+
+
 		/**
 		\brief Get the sizes according to the FIFO ordering.
 		*/
@@ -1221,6 +1373,46 @@ namespace bertini {
 		void AutoPatchFIFO();
 
 
+		/**
+		\brief Get the index of each variable of a slice, in the variable ordering of the system.
+
+		Computed once per variable ordering.
+
+		\throws std::runtime_error, if the slice is on a variable which is not a variable of the system.
+		*/
+		std::vector<unsigned> const& SliceVariableIndices(unsigned slice_index) const;
+
+
+		/**
+		\brief Evaluate all the slices at the current variable values, writing into the rows after the system's functions.
+		*/
+		template<typename Derived, typename T>
+		void EvalSlicesInPlace(Eigen::MatrixBase<Derived> & function_values, Vec<T> const& x) const
+		{
+			unsigned offset = NumFunctions();
+			for (unsigned ii = 0; ii < slices_.size(); ++ii)
+			{
+				slices_[ii].EvalInPlace(function_values, offset, x, SliceVariableIndices(ii));
+				offset += slices_[ii].Dimension();
+			}
+		}
+
+
+		/**
+		\brief Copy the coefficients of all the slices into the rows of a Jacobian after the system's functions.
+		*/
+		template<typename Derived>
+		void SliceJacobiansInPlace(Eigen::MatrixBase<Derived> & J) const
+		{
+			unsigned offset = NumFunctions();
+			for (unsigned ii = 0; ii < slices_.size(); ++ii)
+			{
+				slices_[ii].JacobianInPlace(J, offset, SliceVariableIndices(ii));
+				offset += slices_[ii].Dimension();
+			}
+		}
+
+
 
 		/**
 		\brief Dehomogenize a point according to the FIFO variable ordering.
@@ -1313,8 +1505,12 @@ namespace bertini {
 		class Patch patch_; ///< Patch on the variable groups.  Assumed to be in the same order as the time_order_of_variable_groups_ if the system uses FIFO ordering, or in same order as the AffHomUng variable groups if that is set.
 		bool is_patched_;	///< Indicator of whether the system has been patched.
 
+		std::vector<LinearSlice> slices_; ///< Linear slices, evaluated outside the function tree.  Their functions come after the system's functions, and before the patches.
+		mutable std::vector< std::vector<unsigned> > slice_variable_indices_; ///< For each slice, the index of each of its variables in the variable ordering.  Empty when it needs recomputing.
+
 		mutable std::vector< Jac > jacobian_; ///< The generated functions from differentiation.  Created when first call for a Jacobian matrix evaluation.
-		mutable bool is_differentiated_; ///< indicator for whether the jacobian tree has been populated.
+		mutable bool is_differentiated_; ///< indicator for whether the jacobian tree has been populated.  With lazy differentiation, entries of jacobian_ are null until first used.
+		bool lazy_differentiation_ = false; ///< Whether to differentiate each function only when first needed.
 
 
 		std::vector< VariableGroupType > time_order_of_variable_groups_;
@@ -1358,6 +1554,12 @@ namespace bertini {
 			ar & precision_;
 			ar & is_patched_;
 			ar & patch_;
+
+			if (version >= 1)
+			{
+				ar & slices_;
+				ar & lazy_differentiation_;
+			}
 		}
 
 	};
@@ -1374,6 +1576,8 @@ namespace bertini {
 	If both patched both must have same patch.  If not both are patched, then the patch will propagate to the returned system. 
 
 	If the two patches have differing variable orderings, the call to Concatenate will throw.
+
+	The slices of sys2 come after those of sys1, as its functions come after those of sys1.
 	*/
 	System Concatenate(System sys1, System const& sys2);
 	
@@ -1384,6 +1588,10 @@ namespace bertini {
 }
 
 
+// version 1 added the slices, and whether differentiation is lazy.
+BOOST_CLASS_VERSION(bertini::System, 1)
+
+
 
 
 
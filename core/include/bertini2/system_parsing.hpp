@@ -57,8 +57,14 @@
 #include <boost/spirit/include/support_istream_iterator.hpp>
 
 
+#include <atomic>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 
 
@@ -263,7 +269,13 @@ namespace bertini {
 			
 			
 			definition_.name("definition_");
-			definition_ = (encountered_functions_ > '=' > function_parser_ > ';') [phx::bind( [](const Fn & F, const Nd & N)
+			definition_ =
+			(eps(phx::cref(defer_definitions_)) >> encountered_functions_ >> '=' >> qi::raw[*(qi::char_ - ';')] >> ';') [phx::bind( [this](const Fn & F, boost::iterator_range<Iterator> const& body)
+																					 {
+																						 deferred_definitions_.push_back({F, std::string(body.begin(), body.end()), symbol_ordinals_.size()});
+																					 },_1, _2)]
+			|
+			(encountered_functions_ > '=' > function_parser_ > ';') [phx::bind( [](const Fn & F, const Nd & N)
 																					 {
 																						 F->SetRoot(N);
 																					 },_1, _2)] ;
@@ -338,6 +350,96 @@ namespace bertini {
 		
 		
 		
+
+		/**
+		 \brief Set whether to defer parsing the definitions of declared functions.
+
+		 When deferring, a definition such as `f = x*y + z;` of a previously declared function only has its text collected while parsing.  Call ParseDeferredDefinitions after parsing to parse the collected text, possibly on several threads, and set the functions.  Subfunctions, which may be used by later definitions, are always parsed immediately.
+		 */
+		void DeferDefinitions(bool defer)
+		{
+			defer_definitions_ = defer;
+		}
+
+
+		/**
+		 \brief Parse the definitions collected while deferring, and set the functions they define.
+
+		 The definitions are independent, so are handed out to the threads one at a time.  Each may only use the symbols encountered before it in the input, exactly as when parsing without deferring.  The numbers in the definitions are made at the default precision, which is shared by all threads, so do not change it while parsing.
+
+		 Parse errors are collected from all the threads, and reported together from the calling thread once all the definitions have been tried.
+
+		 \param num_threads The number of threads to use.  If 1, all the definitions are parsed on the calling thread.
+		 \throws std::runtime_error if any definition does not parse, describing every one which did not.
+		 */
+		void ParseDeferredDefinitions(unsigned num_threads = 1)
+		{
+			if (num_threads==0)
+				throw std::runtime_error("must use at least one thread to parse deferred definitions");
+
+			using BodyIterator = std::string::const_iterator;
+
+			std::atomic<size_t> next(0);
+			std::vector<std::string> errors(deferred_definitions_.size());
+
+			auto worker = [this, &next, &errors]()
+			{
+				std::ostringstream error_messages;
+				size_t num_visible_symbols = 0;
+				FunctionParser<BodyIterator> parser(&encountered_symbols_, error_messages,
+					[this, &num_visible_symbols](Nd const& symbol)
+					{
+						auto found = symbol_ordinals_.find(symbol.get());
+						return found==symbol_ordinals_.end() || found->second < num_visible_symbols;
+					});
+
+				for (auto ii = next++; ii < deferred_definitions_.size(); ii = next++)
+				{
+					const auto& definition = deferred_definitions_[ii];
+					num_visible_symbols = definition.num_visible_symbols;
+					error_messages.str("");
+
+					BodyIterator iter = definition.body.begin(), end = definition.body.end();
+
+					Nd root;
+					bool s = phrase_parse(iter, end, parser, boost::spirit::ascii::space, root);
+					if (!s || iter!=end)
+					{
+						auto message = error_messages.str();
+						while (!message.empty() && message.back()=='\n')
+							message.pop_back();
+
+						errors[ii] = "unable to parse definition of function " + definition.function->name();
+						if (!message.empty())
+							errors[ii] += ".  " + message;
+						continue;
+					}
+					definition.function->SetRoot(root);
+				}
+			};
+
+			if (num_threads==1)
+				worker();
+			else
+			{
+				std::vector<std::thread> workers;
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+					workers.emplace_back(worker);
+				for (auto& w : workers)
+					w.join();
+			}
+
+			deferred_definitions_.clear();
+
+			std::string all_errors;
+			for (const auto& e : errors)
+				if (!e.empty())
+					all_errors += (all_errors.empty() ? "" : "\n") + e;
+			if (!all_errors.empty())
+				throw std::runtime_error(all_errors);
+		}
+
+
 	private:
 		
 		// rule declarations.  these are member variables for the parser.
@@ -375,6 +477,20 @@ namespace bertini {
 		qi::symbols<char,Nd> special_numbers_;
 		
 		FunctionParser<Iterator> function_parser_;
+
+		/**
+		 \brief A definition whose parsing was deferred.
+		 */
+		struct DeferredDefinition
+		{
+			Fn function; ///< The function it defines.
+			std::string body; ///< The text of the definition, after the `=`.
+			size_t num_visible_symbols; ///< The number of variables and functions encountered before the definition.  It may use only these.
+		};
+
+		bool defer_definitions_ = false; ///< Whether to collect the text of definitions for ParseDeferredDefinitions, rather than parse it.
+		std::vector<DeferredDefinition> deferred_definitions_; ///< The definitions which were deferred, in the order they appeared.
+		std::unordered_map<Node const*, size_t> symbol_ordinals_; ///< The order in which each variable and function was encountered.
 		
 		/**
 		 To accompany the rule for making new functions when you encounter a new symbol.
@@ -385,6 +501,7 @@ namespace bertini {
 			F = std::make_shared<Function>(str);
 			encountered_symbols_.add(str, F);
 			encountered_functions_.add(str,F);
+			symbol_ordinals_.emplace(F.get(), symbol_ordinals_.size());
 		}
 		
 		/**
@@ -395,6 +512,7 @@ namespace bertini {
 		{
 			V = std::make_shared<Variable>(str);
 			encountered_symbols_.add(str, V);
+			symbol_ordinals_.emplace(V.get(), symbol_ordinals_.size());
 		}
 		
 		
@@ -424,6 +542,40 @@ namespace bertini {
 		using std::swap;
 		swap(sys,*this);
 	}
+
+
+
+	/**
+	\brief Parse a system in Bertini classic syntax, parsing the definitions of its functions on several threads.
+
+	For large systems, most of the input is the definitions of the functions, as in `f1 = (many terms);`.  These are collected during a first, cheap pass over the input, and then parsed in parallel.  The result is the same as from constructing a System from the string.
+
+	\param input The text of the system.
+	\param num_threads The number of threads on which to parse the definitions.
+	\return The parsed system.
+	*/
+	inline
+	System ParseSystem(std::string const& input, unsigned num_threads)
+	{
+		System sys;
+
+		SystemParser<std::string::const_iterator> S;
+		S.DeferDefinitions(true);
+
+		std::string::const_iterator iter = input.begin();
+		std::string::const_iterator end = input.end();
+
+		bool s = phrase_parse(iter, end, S,boost::spirit::ascii::space, sys);
+
+		if (!s || iter!=end)
+		{
+			throw std::runtime_error("unable to correctly parse string in construction of system");
+		}
+
+		S.ParseDeferredDefinitions(num_threads);
+
+		return sys;
+	}
 	
 }
 
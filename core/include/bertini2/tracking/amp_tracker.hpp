@@ -389,7 +389,7 @@ namespace bertini{
 				         );
 				#endif
 
-				NotifyObservers(Initializing<AMPTracker,mpfr>(*this,start_time, end_time, start_point));
+				Emit<Initializing<AMPTracker,mpfr>>(*this,start_time, end_time, start_point);
 
 				initial_precision_ = Precision(start_point(0));
 				DefaultPrecision(initial_precision_);
@@ -430,7 +430,7 @@ namespace bertini{
 			//                                dbl const& end_time,
 			// 							   Vec<dbl> const& start_point) const override
 			// {
-			// 	NotifyObservers(Initializing<AMPTracker,dbl>(*this,start_time, end_time, start_point));
+			// 	Emit<Initializing<AMPTracker,dbl>>(*this,start_time, end_time, start_point);
 
 			// 	// set up the master current time and the current step size
 			// 	initial_precision_ = Precision(DoublePrecision());
@@ -474,7 +474,7 @@ namespace bertini{
 					do {
 						if (current_precision_ > AMP_config_.maximum_precision)
 						{
-							NotifyObservers(SingularStartPoint<EmitterType>(*this));
+							Emit<SingularStartPoint<EmitterType>>(*this);
 							return SuccessCode::SingularStartPoint;
 						}
 
@@ -514,11 +514,25 @@ namespace bertini{
 			
 
 
+			/**
+			\brief Restore the default precision and the precision of the system to those of the path in progress.
+
+			Between calls to StepPath, other paths may have been tracked on the same thread, changing both.
+			*/
+			void PrepareToResume() const override
+			{
+				if (DefaultPrecision()!=current_precision_)
+					DefaultPrecision(current_precision_);
+				if (tracked_system_.precision()!=current_precision_)
+					tracked_system_.precision(current_precision_);
+			}
+
+
 			void PostTrackCleanup() const override
 			{
 				if (preserve_precision_)
 					ChangePrecision(initial_precision_);
-				NotifyObservers(TrackingEnded<EmitterType>(*this));
+				Emit<TrackingEnded<EmitterType>>(*this);
 			}
 
 			/**
@@ -606,7 +620,7 @@ namespace bertini{
 				assert(PrecisionSanityCheck() && "precision sanity check failed.  some internal variable is not in correct precision");
 				#endif
 
-				NotifyObservers(NewStep<EmitterType>(*this));
+				Emit<NewStep<EmitterType>>(*this);
 
 				Vec<ComplexType>& predicted_space = std::get<Vec<ComplexType> >(temporary_space_); // this will be populated in the Predict step
 				Vec<ComplexType>& current_space = std::get<Vec<ComplexType> >(current_space_); // the thing we ultimately wish to update
@@ -616,7 +630,7 @@ namespace bertini{
 				SuccessCode predictor_code = Predict<ComplexType, RealType>(predicted_space, current_space, current_time, delta_t);
 				if (predictor_code==SuccessCode::MatrixSolveFailureFirstPartOfPrediction)
 				{
-					NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType>(*this));
+					Emit<FirstStepPredictorMatrixSolveFailure<EmitterType>>(*this);
 					next_stepsize_ = current_stepsize_;
 
 					if (current_precision_==DoublePrecision())
@@ -630,19 +644,19 @@ namespace bertini{
 				}
 				else if (predictor_code==SuccessCode::MatrixSolveFailure)
 				{
-					NotifyObservers(PredictorMatrixSolveFailure<EmitterType>(*this));
+					Emit<PredictorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();// decrease stepsize, and adjust precision as necessary
 					return predictor_code;
 				}	
 				else if (predictor_code==SuccessCode::HigherPrecisionNecessary)
 				{	
-					NotifyObservers(PredictorHigherPrecisionNecessary<EmitterType>(*this));
+					Emit<PredictorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType, RealType>();
 					return predictor_code;
 				}
 
 
-				NotifyObservers(SuccessfulPredict<AMPTracker, ComplexType>(*this, predicted_space));
+				Emit<SuccessfulPredict<AMPTracker, ComplexType>>(*this, predicted_space);
 
 				Vec<ComplexType>& tentative_next_space = std::get<Vec<ComplexType> >(tentative_space_); // this will be populated in the Correct step
 
@@ -654,13 +668,13 @@ namespace bertini{
 
 				if (corrector_code==SuccessCode::MatrixSolveFailure || corrector_code==SuccessCode::FailedToConverge)
 				{
-					NotifyObservers(CorrectorMatrixSolveFailure<EmitterType>(*this));
+					Emit<CorrectorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();
 					return corrector_code;
 				}
 				else if (corrector_code == SuccessCode::HigherPrecisionNecessary)
 				{
-					NotifyObservers(CorrectorHigherPrecisionNecessary<EmitterType>(*this));
+					Emit<CorrectorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType, RealType>();
 					return corrector_code;
 				}
@@ -670,7 +684,7 @@ namespace bertini{
 					return corrector_code;
 				}
 
-				NotifyObservers(SuccessfulCorrect<AMPTracker, ComplexType>(*this, tentative_next_space));
+				Emit<SuccessfulCorrect<AMPTracker, ComplexType>>(*this, tentative_next_space);
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
@@ -993,7 +1007,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Tracker::IncrementBaseCountersSuccess();
-				NotifyObservers(SuccessfulStep<EmitterType>(*this));
+				Emit<SuccessfulStep<EmitterType>>(*this);
 			}
 
 			/**
@@ -1004,14 +1018,14 @@ namespace bertini{
 				Tracker::IncrementBaseCountersFail();
 				num_successful_steps_since_precision_decrease_ = 0;
 				num_successful_steps_since_stepsize_increase_ = 0;
-				NotifyObservers(FailedStep<EmitterType>(*this));
+				Emit<FailedStep<EmitterType>>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				Emit<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 
@@ -1054,6 +1068,8 @@ namespace bertini{
 			              				"underlying complex type and the type for comparisons must match");
 				static_assert(std::is_same<typename Derived::Scalar, ComplexType>::value, "scalar types must match");
 
+				BERTINI_TELEMETRY_TIME(telemetry::Phase::Prediction);
+
 				RealType& norm_J = std::get<RealType>(norm_J_);
 				RealType& norm_J_inverse = std::get<RealType>(norm_J_inverse_);
 				RealType& size_proportion = std::get<RealType>(size_proportion_);
@@ -1114,6 +1130,7 @@ namespace bertini{
 			              				typename Eigen::NumTraits<ComplexType>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
+				BERTINI_TELEMETRY_TIME(telemetry::Phase::Correction);
 
 				RealType& norm_J = std::get<RealType>(norm_J_);
 				RealType& norm_J_inverse = std::get<RealType>(norm_J_inverse_);
@@ -1301,10 +1318,11 @@ namespace bertini{
 				if (new_precision==current_precision_) // no op
 					return SuccessCode::Success;
 
-				NotifyObservers(PrecisionChanged<EmitterType>(*this,current_precision_,new_precision));
+				Emit<PrecisionChanged<EmitterType>>(*this,current_precision_,new_precision);
 				
 
 				bool upsampling_needed = new_precision > current_precision_;
+				BERTINI_TELEMETRY_INCREMENT(upsampling_needed ? telemetry::Counter::PrecisionIncreases : telemetry::Counter::PrecisionDecreases);
 				// reset the counter for estimating the condition number.  
 				num_steps_since_last_condition_number_computation_ = this->stepping_config_.frequency_of_CN_estimation;
 
@@ -193,6 +193,21 @@ namespace bertini{
 				const TrackerType & GetTracker() const
 				{return tracker_;}
 
+				/**
+				\brief Compute the derivative \f$dx/dt\f$ of the path at a sample.
+
+				A sample which was just tracked to or refined is the output of the tracker's Newton corrector, and the corrector's final factorization of the Jacobian is reused if it was converged to within the final tolerance.
+
+				\param[out] dx_dt The derivative at the sample.
+				\param sample The space value of the sample.
+				\param time The time of the sample.
+				*/
+				template<typename CT>
+				void ComputeDerivative(Vec<CT> & dx_dt, Vec<CT> const& sample, CT const& time) const
+				{
+					tracker_.PathDerivative(dx_dt, sample, time, tolerances_.final_tolerance);
+				}
+
 				template<typename CT>
 				const Vec<CT>& FinalApproximation() const 
 				{return std::get<Vec<CT> >(final_approximation_at_origin_);}
@@ -248,18 +263,18 @@ namespace bertini{
 					samples.push_back(x_endgame);
 					times.push_back(start_time);
 
-					auto num_vars = GetSystem().NumVariables();
 					//start at 1, because the input point is the 0th element.
 					for(int ii=1; ii < endgame_settings_.num_sample_points; ++ii)
 					{ 
 						times.emplace_back(times[ii-1] * RT(endgame_settings_.sample_factor));
-						samples.emplace_back(Vec<CT>(num_vars));
+						samples.extend_back(); // reuses the storage from the previous path, and is overwritten by tracking
 
 						auto tracking_success = tracker_.TrackPath(samples[ii],times[ii-1],times[ii],samples[ii-1]);
 						AsDerived().EnsureAtPrecision(times[ii],Precision(samples[ii]));
 
 						if (tracking_success!=SuccessCode::Success)
 							return tracking_success;
+						BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::EndgameSamples);
 					}
 
 					return SuccessCode::Success;
@@ -34,6 +34,7 @@
 #define BERTINI_BASE_TRACKER_HPP
 
 #include <algorithm>
+#include <limits>
 //#include "bertini2/tracking/step.hpp"
 #include "bertini2/tracking/ode_predictors.hpp"
 #include "bertini2/tracking/newton_corrector.hpp"
@@ -205,11 +206,39 @@ namespace bertini{
 									Vec<CT> const& start_point
 									) const
 			{	
+				SuccessCode initialization_code = InitializePath(start_time, endtime, start_point);
+				if (initialization_code!=SuccessCode::Success)
+					return initialization_code;
+
+				SuccessCode stepping_code = StepPath(std::numeric_limits<unsigned>::max());
+				if (stepping_code!=SuccessCode::Success)
+					return stepping_code;
+
+				FinalizePath(solution_at_endtime);
+				return SuccessCode::Success;
+			}
+
+
+
+
+			/**
+			\brief Begin tracking a path, without taking any steps.
+
+			This is the first of the three pieces of TrackPath, exposed so that a path can be tracked a few steps at a time.  After a successful initialization, call StepPath as many times as you like, and then FinalizePath once StepPath returns SuccessCode::Success.
+
+			\param start_time The time at which to start tracking.
+			\param endtime The time to track to.
+			\param start_point The intial space values for tracking.
+			\return SuccessCode::Success if the path is ready to be stepped, and the failure code otherwise.  On failure, the path is cleaned up and is not in progress.
+			*/
+			SuccessCode InitializePath(CT const& start_time, CT const& endtime,
+									Vec<CT> const& start_point) const
+			{
 				if (start_point.size()!=tracked_system_.NumVariables())
 					throw std::runtime_error("start point size must match the number of variables in the system to be tracked");
 
-				
-				
+				path_in_progress_ = false;
+
 				SuccessCode initialization_code = TrackerLoopInitialization(start_time, endtime, start_point);
 				if (initialization_code!=SuccessCode::Success)
 				{
@@ -217,12 +246,40 @@ namespace bertini{
 					return initialization_code;
 				}
 
-				// as precondition to this while loop, the correct container, either dbl or mpfr, must have the correct data.
-				while (!IsSymmRelDiffSmall(current_time_,endtime_, Eigen::NumTraits<CT>::epsilon()))
-				{	
+				path_in_progress_ = true;
+				return SuccessCode::Success;
+			}
+
+
+
+
+			/**
+			\brief Take at most a given number of iterations along the path in progress.
+
+			Failed steps count as iterations, so the number of iterations bounds the work done by this call.  The state of the path is held in the tracker between calls, so tracking can be resumed later, even after the ambient default precision has been changed by something else.
+
+			\param max_num_iterations The largest number of iterations to take before returning.
+			\return SuccessCode::Success if the path has reached the end time, SuccessCode::PathInProgress if the iteration budget ran out first, and a failure code otherwise.  On failure, the path is cleaned up and is no longer in progress.
+			*/
+			SuccessCode StepPath(unsigned max_num_iterations) const
+			{
+				if (!path_in_progress_)
+					throw std::runtime_error("cannot step a path which is not in progress.  call InitializePath first");
+
+				BERTINI_TELEMETRY_TIME(telemetry::Phase::Tracking);
+
+				PrepareToResume();
+
+				// as precondition to this loop, the correct container, either dbl or mpfr, must have the correct data.
+				for (unsigned ii = 0; ii < max_num_iterations; ++ii)
+				{
+					if (IsSymmRelDiffSmall(current_time_,endtime_, Eigen::NumTraits<CT>::epsilon()))
+						return SuccessCode::Success;
+
 					SuccessCode pre_iteration_code = PreIterationCheck();
 					if (pre_iteration_code!=SuccessCode::Success)
 					{
+						path_in_progress_ = false;
 						PostTrackCleanup();
 						return pre_iteration_code;
 					}
@@ -240,6 +297,7 @@ namespace bertini{
 					if (infinite_path_truncation_ && (CheckGoingToInfinity()==SuccessCode::GoingToInfinity))
 					{	
 						OnInfiniteTruncation();
+						path_in_progress_ = false;
 						PostTrackCleanup();
 						return SuccessCode::GoingToInfinity;
 					}
@@ -248,12 +306,54 @@ namespace bertini{
 					else
 						OnStepFail();
 
-				}// re: while
+				}// re: for
+
+				if (IsSymmRelDiffSmall(current_time_,endtime_, Eigen::NumTraits<CT>::epsilon()))
+					return SuccessCode::Success;
+				else
+					return SuccessCode::PathInProgress;
+			}
+
+
+
+
+			/**
+			\brief Finish a path which has reached its end time, producing the solution.
 
+			\param[out] solution_at_endtime The value of the solution at the end time.
+			*/
+			void FinalizePath(Vec<CT> & solution_at_endtime) const
+			{
+				if (!path_in_progress_)
+					throw std::runtime_error("cannot finalize a path which is not in progress");
+				if (!IsSymmRelDiffSmall(current_time_,endtime_, Eigen::NumTraits<CT>::epsilon()))
+					throw std::runtime_error("cannot finalize a path which has not reached its end time");
 
 				CopyFinalSolution(solution_at_endtime);
+				path_in_progress_ = false;
 				PostTrackCleanup();
-				return SuccessCode::Success;
+			}
+
+
+			/**
+			\brief Query whether a path has been initialized, and has neither failed nor been finalized.
+			*/
+			bool IsPathInProgress() const
+			{
+				return path_in_progress_;
+			}
+
+
+
+			/**
+			\brief Give this tracker its own predictor and corrector.
+
+			Copies of a tracker share the predictor and corrector of the original, including their precision and internal temporaries.  Call this on a copy before tracking with it independently of the original, such as when holding many paths in progress at once.
+			*/
+			void DetachWorkspace()
+			{
+				predictor_ = std::make_shared< predict::ExplicitRKPredictor >(*predictor_);
+				corrector_ = std::make_shared< correct::NewtonCorrector >(*corrector_);
 			}
 
 
@@ -307,6 +407,26 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Compute the derivative \f$dx/dt\f$ of the path through a point.
+
+			A point just produced by tracking or Refine was the output of Newton's method, whose final iteration already factored the Jacobian.  If the most recent correction converged to exactly this point and time, with a final step no longer than reuse_tolerance, that factorization is reused, and only \f$\partial H/\partial t\f$ is evaluated.  Otherwise the Jacobian is evaluated and factored too.  Either way the result is the same, up to the accuracy of the correction.
+
+			\return Whether the factorization from the tracker's Newton correction was reused.
+
+			\param[out] dx_dt The derivative of the path.
+			\param space The point on the path.
+			\param time The time at the point.
+			\param reuse_tolerance The longest final Newton step for which the factorization may be reused.
+			*/
+			template<typename C, typename R>
+			bool PathDerivative(Vec<C> & dx_dt, Vec<C> const& space, C const& time, R const& reuse_tolerance) const
+			{
+				static_assert(IsTemplateParameter<C,NeededTypes...>::value,"complex type for path derivative must be a used type for the tracker");
+				return corrector_->PathDerivative(dx_dt, tracked_system_, space, time, reuse_tolerance);
+			}
+
+
 			/**
 			\brief Change tracker to use a predictor
 
@@ -440,6 +560,15 @@ namespace bertini{
 
 
 
+			/**
+			\brief Function to be called before resuming stepping of a path.
+
+			Override this if your tracker depends on ambient state, such as the default precision, which may have been changed between calls to StepPath.
+			*/
+			virtual
+			void PrepareToResume() const
+			{}
+
 			/**
 			\brief Function to be called before exiting the tracker loop.
 			*/
@@ -518,6 +647,7 @@ namespace bertini{
 
 			bool infinite_path_truncation_ = true; /// Whether should check if the path is going to infinity while tracking.  On by default.
 			bool reinitialize_stepsize_ = true; ///< Whether should re-initialize the stepsize with each call to Trackpath.  On by default.
+			mutable bool path_in_progress_ = false; ///< Whether a path has been initialized, and not yet finished or failed.
 
 			// tracking the numbers of things
 			mutable unsigned num_total_steps_taken_; ///< The number of steps taken, including failures and successes.
@@ -107,7 +107,7 @@ Vec<ComplexT> result;
 //4. Track all points to 0.1
 for (unsigned ii = 0; ii < TD_start_sys.NumStartPoints(); ++ii)
 {
-    mpfr_float::default_precision(ambient_precision);
+    DefaultPrecision(ambient_precision);
     my_homotopy.precision(ambient_precision); // making sure our precision is all set up 
     auto start_point = TD_start_sys.StartPoint<ComplexT>(ii);
 
@@ -333,32 +333,35 @@ public:
 		auto& circle_samples = std::get<SampCont<CT> >(cauchy_samples_);
 
 		// the initial sample has already been added to the sample repo... so don't do that here, please
-		
-		const auto num_vars = this->GetSystem().NumVariables();
+
+		// starting_time may be an element of circle_times, which may grow below, so take what is needed from it now
+		using std::polar;
+		using bertini::polar;
+		const RT radius = abs(starting_time), angle = arg(starting_time);
+		const CT start_time = starting_time;
 
 		for (unsigned ii = 0; ii < this->EndgameSettings().num_sample_points; ++ii)
 		{
-			const Vec<CT>& current_sample = circle_samples.back();
-			const CT& current_time = circle_times.back();
-			assert(Precision(current_time)==Precision(current_sample) && "current time and sample for circle track must be of same precision");
-
 			//set up the time value for the next sample. 
-			using std::polar;
-			using bertini::polar;
-
-			RT radius = abs(starting_time), angle = arg(starting_time);
-
-			auto next_sample = Vec<CT>(num_vars);
-			auto next_time = (ii==this->EndgameSettings().num_sample_points-1) 
-								?
-							  starting_time
-								:
-							  polar(radius, (ii+1)*2*acos(static_cast<RT>(-1)) / (this->EndgameSettings().num_sample_points) + angle)
-							  ;
+			if (ii==this->EndgameSettings().num_sample_points-1)
+				circle_times.push_back(start_time);
+			else
+				circle_times.push_back(polar(radius, (ii+1)*2*acos(static_cast<RT>(-1)) / (this->EndgameSettings().num_sample_points) + angle));
+			circle_samples.extend_back(); // reuses the storage from a previous circle, and is overwritten by tracking
+
+			// the buffers may have grown, so only refer into them from here on
+			const auto n = circle_samples.size();
+			const Vec<CT>& current_sample = circle_samples[n-2];
+			const CT& current_time = circle_times[n-2];
+			Vec<CT>& next_sample = circle_samples[n-1];
+			CT& next_time = circle_times[n-1];
+			assert(Precision(current_time)==Precision(current_sample) && "current time and sample for circle track must be of same precision");
 
 			auto tracking_success = this->GetTracker().TrackPath(next_sample, current_time, next_time, current_sample);	
 			if (tracking_success != SuccessCode::Success)
 			{
+				circle_times.pop_back();
+				circle_samples.pop_back();
 				std::cout << "tracker fail in circle track, radius " << radius << ", type " << int(tracking_success) << std::endl;
 				return tracking_success;
 			}
@@ -368,14 +371,14 @@ public:
 			auto refinement_success = AsDerived().RefineSample(next_sample, next_sample, next_time);
 			if (refinement_success != SuccessCode::Success)
 			{
+				circle_times.pop_back();
+				circle_samples.pop_back();
 				std::cout << "refinement fail in circle track, type " << int(refinement_success) << std::endl;
 				return refinement_success;
 			}
 
 			AsDerived().EnsureAtPrecision(next_time,Precision(next_sample)); assert(Precision(next_time)==Precision(next_sample));
-
-			circle_times.push_back(next_time);
-			circle_samples.push_back(next_sample);
+			BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::EndgameSamples);
 
 			// down here next_sample and next_time should have the same precision.
 		}
@@ -676,9 +679,6 @@ public:
 			cau_samples.push_back(ps_samples.back()); // cauchy samples and times should be empty before this point. 
 			cau_times.push_back(ps_times.back());
 
-			auto next_time = ps_times.back();
-			auto next_sample = ps_samples.back();
-
 			// track around a circle once.  we'll use it to measure whether we believe we are in the eg operating zone, based on the ratio of ratios of norms of sample points around the circle
 			auto tracking_success = CircleTrack(cau_times.front(),cau_samples.front());
 
@@ -724,19 +724,8 @@ public:
 			}//end if (RatioEGOperatingZoneTest())
 			else 
 			{
-				//compute the time for the next sample point
-				AsDerived().EnsureAtPrecision(next_time,Precision(ps_samples.back()));
-				next_time = ps_times.back() * static_cast<RT>(this->EndgameSettings().sample_factor);
-
-				SuccessCode tracking_success = this->GetTracker().TrackPath(next_sample,ps_times.back(),next_time,ps_samples.back());
-				AsDerived().EnsureAtPrecision(next_time,Precision(next_sample));
-
-				ps_times.pop_front();
-				ps_samples.pop_front();
-
-				ps_times.push_back(next_time);
-				ps_samples.push_back(next_sample);
-
+				//advance to the next sample point
+				auto tracking_success = AdvancePSEGSamples<CT>();
 				if(tracking_success != SuccessCode::Success)
 					return tracking_success;
 			}
@@ -746,6 +735,45 @@ public:
 	}//end InitialCauchyLoops
 
 
+	/**
+		\brief Track the power series samples one step closer to the origin, by the sample factor, dropping the oldest.
+
+		The new sample is tracked straight into the sample buffer, in storage left by a dropped sample, so no vector is made.  If tracking fails, the samples are left as they were.
+
+		\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	SuccessCode AdvancePSEGSamples()
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+
+		auto& ps_times = std::get<TimeCont<CT> >(pseg_times_);
+		auto& ps_samples = std::get<SampCont<CT> >(pseg_samples_);
+
+		ps_times.push_back(ps_times.back() * static_cast<RT>(this->EndgameSettings().sample_factor));
+		ps_samples.extend_back(); // reuses the storage of a dropped sample, and is overwritten by tracking
+
+		// the buffers may have grown, so only refer into them from here on
+		const auto n = ps_samples.size();
+		AsDerived().EnsureAtPrecision(ps_times[n-1],Precision(ps_samples[n-2]));
+
+		auto tracking_success = this->GetTracker().TrackPath(ps_samples[n-1],ps_times[n-2],ps_times[n-1],ps_samples[n-2]);
+		if (tracking_success!=SuccessCode::Success)
+		{
+			ps_times.pop_back();
+			ps_samples.pop_back();
+			return tracking_success;
+		}
+
+		AsDerived().EnsureAtPrecision(ps_times.back(), Precision(ps_samples.back()));
+
+		ps_samples.pop_front();
+		ps_times.pop_front();
+		BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::EndgameSamples);
+		return SuccessCode::Success;
+	}
+
+
 	/**
 		\brief 	The Cauchy endgame will first find an initial approximation using the notion of the power series endgame. This function computes this approximation and returns a
 	SuccessCode to let us know if an error was encountered. 
@@ -788,25 +816,14 @@ public:
 
 		c_over_k.push_back(ComputeCOverK<CT>());
 
-		Vec<CT> next_sample;
-		CT next_time;
-
 		unsigned ii = 0;
 		//track until for more c_over_k estimates or until we reach a cutoff time. 
 		while ( (ii < cauchy_settings_.num_needed_for_stabilization) )
 		{	
-			next_time = ps_times.back() * static_cast<RT>(this->EndgameSettings().sample_factor);
-
-			auto tracking_success = this->GetTracker().TrackPath(next_sample,ps_times.back(),next_time,ps_samples.back());
+			auto tracking_success = AdvancePSEGSamples<CT>();
 			if (tracking_success!=SuccessCode::Success)
 				return tracking_success;
 
-			AsDerived().EnsureAtPrecision(next_time, Precision(next_sample));
-
-			ps_samples.pop_front();
-			ps_times.pop_front();
-			ps_samples.push_back(next_sample);
-			ps_times.push_back(next_time);
 			c_over_k.push_back(ComputeCOverK<CT>());
 
 			++ii;
@@ -816,21 +833,11 @@ public:
 		//have we stabilized yet? 
 		while(!CheckForCOverKStabilization(c_over_k) && abs(ps_times.back()) > cauchy_settings_.cycle_cutoff_time)
 		{
-			next_time = ps_times.back() * static_cast<RT>(this->EndgameSettings().sample_factor);
-
-			auto tracking_success = this->GetTracker().TrackPath(next_sample,ps_times.back(),next_time,ps_samples.back());
-
+			auto tracking_success = AdvancePSEGSamples<CT>();
 			if(tracking_success != SuccessCode::Success)
 				return tracking_success;
 
-			AsDerived().EnsureAtPrecision(next_time, Precision(next_sample));
-
 			c_over_k.pop_front();
-			ps_samples.pop_front();
-			ps_times.pop_front();
-
-			ps_samples.push_back(next_sample);	
-			ps_times.push_back(next_time);
 			c_over_k.push_back(ComputeCOverK<CT>());
 
 		}//end while
@@ -891,14 +898,9 @@ public:
 
 		auto num_sample_points = this->EndgameSettings().num_sample_points;
 		//Compute dx_dt for each sample.
-		SampCont<CT> pseg_derivatives;
+		SampCont<CT> pseg_derivatives(num_sample_points);
 		for(unsigned ii = 0; ii < num_sample_points; ++ii)
-		{	
-			// the inverse() call uses LU look at Eigen documentation on inverse in Eigen/LU.
-			pseg_derivatives.push_back(
-			                           -(this->GetSystem().Jacobian(ps_samples[ii],ps_times[ii]).inverse())*this->GetSystem().TimeDerivative(ps_samples[ii],ps_times[ii])
-			                           );
-		}
+			this->ComputeDerivative(pseg_derivatives[ii], ps_samples[ii], ps_times[ii]);
 
  		//Conversion to S-plane.
 		TimeCont<CT> s_times(num_sample_points);
@@ -1010,6 +1012,7 @@ public:
 			}
 			else if(CheckClosedLoop<CT>())
 			{
+				BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::EndgameLoopClosures);
 				return SuccessCode::Success;
 			}
 		} 
@@ -1049,6 +1052,8 @@ public:
 			throw std::runtime_error(err_msg.str());
 		}
 
+		BERTINI_TELEMETRY_TIME(telemetry::Phase::Endgame);
+
 		assert(Precision(start_time)==Precision(start_time) && ("CauchyEG Run time and point must be of matching precision"));
 
 		using RT = typename Eigen::NumTraits<CT>::Real;
@@ -1119,17 +1124,21 @@ public:
 			norm_of_dehom_of_prev_approx = norm_of_dehom_of_latest_approx;
 
 			next_time *= RT(this->EndgameSettings().sample_factor);
-			Vec<CT> next_sample;
-			auto tracking_success = this->GetTracker().TrackPath(next_sample,cau_times.back(),next_time,cau_samples.front());
+			ps_samples.extend_back(); // reuses the storage of a dropped sample, and is overwritten by tracking
+			auto tracking_success = this->GetTracker().TrackPath(ps_samples.back(),cau_times.back(),next_time,cau_samples.front());
 			if (tracking_success != SuccessCode::Success)
+			{
+				ps_samples.pop_back();
 				return tracking_success;
+			}
 
-			AsDerived().EnsureAtPrecision(next_time,Precision(next_sample));
+			AsDerived().EnsureAtPrecision(next_time,Precision(ps_samples.back()));
 
 			ps_times.push_back(next_time);  ps_times.pop_front();
-			ps_samples.push_back(next_sample); ps_samples.pop_front();
+			ps_samples.pop_front();
+			BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::EndgameSamples);
 
-			auto cauchy_samples_success = ComputeCauchySamples(next_time,next_sample);
+			auto cauchy_samples_success = ComputeCauchySamples(next_time,ps_samples.back());
 
 			//Added because of Griewank osborne test case where tracker returns GoingToInfinity.  
 			//The cauchy endgame should stop instead of attempting to continue. 
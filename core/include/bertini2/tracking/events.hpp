@@ -41,30 +41,32 @@ namespace bertini {
 	
 	/**
 	\brief Generic event for Tracking
+
+	Tracking events use bit indices 1 through 31.
 	*/
-	ADD_BERTINI_EVENT_TYPE(TrackingEvent,Event);
+	ADD_BERTINI_EVENT_TYPE(TrackingEvent,Event,1);
 
 	/**
 	\brief A successful step occurred
 	*/
-	ADD_BERTINI_EVENT_TYPE(SuccessfulStep,TrackingEvent);
+	ADD_BERTINI_EVENT_TYPE(SuccessfulStep,TrackingEvent,2);
 
 	/**
 	\brief A failed step occurred
 	*/
-	ADD_BERTINI_EVENT_TYPE(FailedStep,TrackingEvent);
+	ADD_BERTINI_EVENT_TYPE(FailedStep,TrackingEvent,3);
 
 	/**
 	\brief Taking a new step -- beginning of procedure for attempting to step forward
 	*/
-	ADD_BERTINI_EVENT_TYPE(NewStep,TrackingEvent);
+	ADD_BERTINI_EVENT_TYPE(NewStep,TrackingEvent,4);
 
 	/**
 	\brief The start point for the TrackPath call was singular
 
 	This is evidenced by step size shrinking too far, or running out of precision.
 	*/
-	ADD_BERTINI_EVENT_TYPE(SingularStartPoint,TrackingEvent);
+	ADD_BERTINI_EVENT_TYPE(SingularStartPoint,TrackingEvent,5);
 
 	/**
 	\brief The predict part of tracking step was successful.
@@ -73,6 +75,9 @@ namespace bertini {
 	class SuccessfulPredict : public TrackingEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		static constexpr EventMask Bit = EventBit(6);
+		static constexpr EventMask Mask = Bit | TrackingEvent<ObservedT>::Mask;
+
 		/**
 		\brief The constructor for a SuccessfulPredict Event.
 
@@ -96,6 +101,9 @@ namespace bertini {
 		const Vec<NumT>& resulting_point_;
 	};
 
+	template<class ObservedT, typename NumT> constexpr EventMask SuccessfulPredict<ObservedT,NumT>::Bit;
+	template<class ObservedT, typename NumT> constexpr EventMask SuccessfulPredict<ObservedT,NumT>::Mask;
+
 	/**
 	\brief The correct part of a time step was successful
 	*/
@@ -103,6 +111,9 @@ namespace bertini {
 	class SuccessfulCorrect : public TrackingEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		static constexpr EventMask Bit = EventBit(7);
+		static constexpr EventMask Mask = Bit | TrackingEvent<ObservedT>::Mask;
+
 		/**
 		\brief The constructor for a SuccessfulCorrect Event.
 
@@ -126,6 +137,9 @@ namespace bertini {
 		const Vec<NumT>& resulting_point_;
 	};
 
+	template<class ObservedT, typename NumT> constexpr EventMask SuccessfulCorrect<ObservedT,NumT>::Bit;
+	template<class ObservedT, typename NumT> constexpr EventMask SuccessfulCorrect<ObservedT,NumT>::Mask;
+
 	////////////
 	//
 	//  Precision events
@@ -133,12 +147,15 @@ namespace bertini {
 	/**
 	\brief A generic event involving precision
 	*/
-	ADD_BERTINI_EVENT_TYPE(PrecisionEvent,TrackingEvent);
+	ADD_BERTINI_EVENT_TYPE(PrecisionEvent,TrackingEvent,8);
 
 	template<class ObservedT>
 	class PrecisionChanged : public PrecisionEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		static constexpr EventMask Bit = EventBit(9);
+		static constexpr EventMask Mask = Bit | PrecisionEvent<ObservedT>::Mask;
+
 		/**
 		\brief The constructor for a PrecisionChanged Event.
 
@@ -169,6 +186,9 @@ namespace bertini {
 		const unsigned prev_, next_;
 	};
 
+	template<class ObservedT> constexpr EventMask PrecisionChanged<ObservedT>::Bit;
+	template<class ObservedT> constexpr EventMask PrecisionChanged<ObservedT>::Mask;
+
 	/**
 	\brief Precision increased during tracking
 	*/
@@ -176,6 +196,9 @@ namespace bertini {
 	class PrecisionIncreased : public PrecisionEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		static constexpr EventMask Bit = EventBit(10);
+		static constexpr EventMask Mask = Bit | PrecisionEvent<ObservedT>::Mask;
+
 		/**
 		\brief The constructor for a PrecisionIncreased Event.
 
@@ -190,6 +213,9 @@ namespace bertini {
 		PrecisionIncreased() = delete;
 	};
 
+	template<class ObservedT> constexpr EventMask PrecisionIncreased<ObservedT>::Bit;
+	template<class ObservedT> constexpr EventMask PrecisionIncreased<ObservedT>::Mask;
+
 	/**
 	\brief Precision decreased during tracking
 	*/
@@ -197,6 +223,9 @@ namespace bertini {
 	class PrecisionDecreased : public PrecisionEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		static constexpr EventMask Bit = EventBit(11);
+		static constexpr EventMask Mask = Bit | PrecisionEvent<ObservedT>::Mask;
+
 		/**
 		\brief The constructor for a PrecisionDecreased Event.
 
@@ -211,40 +240,43 @@ namespace bertini {
 		PrecisionDecreased() = delete;
 	};
 
+	template<class ObservedT> constexpr EventMask PrecisionDecreased<ObservedT>::Bit;
+	template<class ObservedT> constexpr EventMask PrecisionDecreased<ObservedT>::Mask;
+
 	/**
 	\brief A step failed, because precision needs to increase
 	*/
-	ADD_BERTINI_EVENT_TYPE(HigherPrecisionNecessary,PrecisionEvent);
+	ADD_BERTINI_EVENT_TYPE(HigherPrecisionNecessary,PrecisionEvent,12);
 
 	/**
 	\brief Prediction failed, because precision needs to increase
 	*/
-	ADD_BERTINI_EVENT_TYPE(PredictorHigherPrecisionNecessary,HigherPrecisionNecessary);
+	ADD_BERTINI_EVENT_TYPE(PredictorHigherPrecisionNecessary,HigherPrecisionNecessary,13);
 
 	/**
 	\brief Correction failed, because precision needs to increase
 	*/
-	ADD_BERTINI_EVENT_TYPE(CorrectorHigherPrecisionNecessary,HigherPrecisionNecessary);
+	ADD_BERTINI_EVENT_TYPE(CorrectorHigherPrecisionNecessary,HigherPrecisionNecessary,14);
 
 	/**
 	\brief Linear algebra declared a failure
 	*/
-	ADD_BERTINI_EVENT_TYPE(MatrixSolveFailure,PrecisionEvent);
+	ADD_BERTINI_EVENT_TYPE(MatrixSolveFailure,PrecisionEvent,15);
 
 	/**
 	\brief Linear algebra declared a failure, during prediction
 	*/
-	ADD_BERTINI_EVENT_TYPE(PredictorMatrixSolveFailure,MatrixSolveFailure);
+	ADD_BERTINI_EVENT_TYPE(PredictorMatrixSolveFailure,MatrixSolveFailure,16);
 
 	/**
 	\brief Linear algebra declared a failure, during the first step of a multi-point prediction.  
 	*/
-	ADD_BERTINI_EVENT_TYPE(FirstStepPredictorMatrixSolveFailure,MatrixSolveFailure);
+	ADD_BERTINI_EVENT_TYPE(FirstStepPredictorMatrixSolveFailure,MatrixSolveFailure,17);
 
 	/**
 	\brief Linear algebra declared a failure, during correction
 	*/
-	ADD_BERTINI_EVENT_TYPE(CorrectorMatrixSolveFailure,MatrixSolveFailure);
+	ADD_BERTINI_EVENT_TYPE(CorrectorMatrixSolveFailure,MatrixSolveFailure,18);
 	////////////
 	//
 	//  Stepsize events
@@ -252,21 +284,21 @@ namespace bertini {
 	/**
 	\brief Stepsize is changing
 	*/
-	ADD_BERTINI_EVENT_TYPE(StepsizeEvent,TrackingEvent);
+	ADD_BERTINI_EVENT_TYPE(StepsizeEvent,TrackingEvent,19);
 
 	/**
 	\brief Stepsize decreased
 
 	This means that the step failed, and decreasing step size was the best thing to do.
 	*/
-	ADD_BERTINI_EVENT_TYPE(StepsizeDecreased,StepsizeEvent);
+	ADD_BERTINI_EVENT_TYPE(StepsizeDecreased,StepsizeEvent,20);
 
 	/**
 	\brief Stepsize increased. 
 
 	This means steps have been successful lately.
 	*/
-	ADD_BERTINI_EVENT_TYPE(StepsizeIncreased,StepsizeEvent);
+	ADD_BERTINI_EVENT_TYPE(StepsizeIncreased,StepsizeEvent,21);
 
 
 	///////////
@@ -276,17 +308,17 @@ namespace bertini {
 	/**
 	\brief Made a call to TrackPath
 	*/
-	ADD_BERTINI_EVENT_TYPE(TrackingStarted,TrackingEvent);
+	ADD_BERTINI_EVENT_TYPE(TrackingStarted,TrackingEvent,22);
 
 	/**
 	\brief Tracking is stopping for whatever reason.
 	*/
-	ADD_BERTINI_EVENT_TYPE(TrackingEnded, TrackingEvent);
+	ADD_BERTINI_EVENT_TYPE(TrackingEnded,TrackingEvent,23);
 
 	/**
 	\brief Tracking terminated because the path was going to infinity.
 	*/
-	ADD_BERTINI_EVENT_TYPE(InfinitePathTruncation, TrackingEvent);
+	ADD_BERTINI_EVENT_TYPE(InfinitePathTruncation,TrackingEvent,24);
 
 	/**
 	\brief TrackPath is initializing the tracker.
@@ -295,6 +327,9 @@ namespace bertini {
 	class Initializing : public TrackingEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		static constexpr EventMask Bit = EventBit(25);
+		static constexpr EventMask Mask = Bit | TrackingEvent<ObservedT>::Mask;
+
 
 		/**
 		\brief Constructor for an Initializing Event
@@ -336,6 +371,9 @@ namespace bertini {
 		const NumT& end_time_;
 		const Vec<NumT>& start_point_;
 	};
+
+	template<class ObservedT, typename NumT> constexpr EventMask Initializing<ObservedT,NumT>::Bit;
+	template<class ObservedT, typename NumT> constexpr EventMask Initializing<ObservedT,NumT>::Mask;
 }// re: namespace tracking
 }// re: namespace bertini
 
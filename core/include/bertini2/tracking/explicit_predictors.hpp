@@ -809,6 +809,10 @@ namespace bertini{
 					if (std::is_same<typename Derived::Scalar, mpfr>::value)
 						PrecisionSanityCheck();
 
+					BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::PredictorStages);
+					BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::LUFactorizations);
+					BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::LinearSolves);
+
 					if(stage == 0)
 					{
 						Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
@@ -125,7 +125,7 @@ namespace bertini{
 
 			void PostTrackCleanup() const override
 			{
-				this->NotifyObservers(TrackingEnded<EmitterType>(*this));
+				this->template Emit<TrackingEnded<EmitterType>>(*this);
 			}
 
 			/**
@@ -165,7 +165,7 @@ namespace bertini{
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
-				this->NotifyObservers(NewStep<EmitterType >(*this));
+				this->template Emit<NewStep<EmitterType>>(*this);
 
 				Vec<CT>& predicted_space = std::get<Vec<CT> >(this->temporary_space_); // this will be populated in the Predict step
 				Vec<CT>& current_space = std::get<Vec<CT> >(this->current_space_); // the thing we ultimately wish to update
@@ -176,7 +176,7 @@ namespace bertini{
 
 				if (predictor_code!=SuccessCode::Success)
 				{
-					this->NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType >(*this));
+					this->template Emit<FirstStepPredictorMatrixSolveFailure<EmitterType>>(*this);
 
 					this->next_stepsize_ = this->stepping_config_.step_size_fail_factor*this->current_stepsize_;
 
@@ -185,7 +185,7 @@ namespace bertini{
 					return predictor_code;
 				}
 
-				this->NotifyObservers(SuccessfulPredict<EmitterType , CT>(*this, predicted_space));
+				this->template Emit<SuccessfulPredict<EmitterType, CT>>(*this, predicted_space);
 
 				Vec<CT>& tentative_next_space = std::get<Vec<CT> >(this->tentative_space_); // this will be populated in the Correct step
 
@@ -202,7 +202,7 @@ namespace bertini{
 				}
 				else if (corrector_code!=SuccessCode::Success)
 				{
-					this->NotifyObservers(CorrectorMatrixSolveFailure<EmitterType >(*this));
+					this->template Emit<CorrectorMatrixSolveFailure<EmitterType>>(*this);
 
 					this->next_stepsize_ = this->stepping_config_.step_size_fail_factor*this->current_stepsize_;
 					UpdateStepsize();
@@ -211,7 +211,7 @@ namespace bertini{
 				}
 
 				
-				this->NotifyObservers(SuccessfulCorrect<EmitterType , CT>(*this, tentative_next_space));
+				this->template Emit<SuccessfulCorrect<EmitterType, CT>>(*this, tentative_next_space);
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
@@ -256,7 +256,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Base::IncrementBaseCountersSuccess();
-				this->NotifyObservers(SuccessfulStep<EmitterType >(*this));
+				this->template Emit<SuccessfulStep<EmitterType>>(*this);
 			}
 
 			/**
@@ -266,14 +266,14 @@ namespace bertini{
 			{
 				Base::IncrementBaseCountersFail();
 				this->num_successful_steps_since_stepsize_increase_ = 0;
-				this->NotifyObservers(FailedStep<EmitterType >(*this));
+				this->template Emit<FailedStep<EmitterType>>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				this->NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				this->template Emit<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 			//////////////
@@ -301,6 +301,8 @@ namespace bertini{
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
+				BERTINI_TELEMETRY_TIME(telemetry::Phase::Prediction);
+
 				RT& norm_J = std::get<RT>(this->norm_J_);
 				RT& norm_J_inverse = std::get<RT>(this->norm_J_inverse_);
 				RT& size_proportion = std::get<RT>(this->size_proportion_);
@@ -339,6 +341,7 @@ namespace bertini{
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
+				BERTINI_TELEMETRY_TIME(telemetry::Phase::Correction);
 
 				RT& norm_J = std::get<RT>(this->norm_J_);
 				RT& norm_J_inverse = std::get<RT>(this->norm_J_inverse_);
@@ -479,7 +482,7 @@ namespace bertini{
 			                               BaseComplexType const& end_time,
 										   Vec<BaseComplexType> const& start_point) const override
 			{
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template Emit<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
@@ -566,7 +569,7 @@ namespace bertini{
 				}
 
 
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template Emit<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
@@ -580,6 +583,19 @@ namespace bertini{
 				return SuccessCode::Success;
 			}
 
+			/**
+			\brief Restore the default precision and the precision of the system to the fixed precision of this tracker.
+
+			Between calls to StepPath, other paths may have been tracked on the same thread, changing both.
+			*/
+			void PrepareToResume() const override
+			{
+				if (DefaultPrecision()!=precision_)
+					DefaultPrecision(precision_);
+				if (tracked_system_.precision()!=precision_)
+					tracked_system_.precision(precision_);
+			}
+
 			bool PrecisionSanityCheck() const
 			{	
 				return tracked_system_.precision() == precision_ &&
@@ -111,11 +111,166 @@ template<typename CT>
 	//As we multiply the previous result we will construct the highest term down to the last term.
 	for (unsigned ii=num_sample_points-1; ii >= 1; --ii)
 	{
-		Result = ((Result*(target_time - time_differences(ii)) + space_differences(2*ii, 2*ii)) * (target_time - time_differences(ii-1)) + space_differences(2*ii-1, 2*ii-1)).eval();  
+		Result = ((Result*(target_time - time_differences(2*ii)) + space_differences(2*ii, 2*ii)) * (target_time - time_differences(2*ii-1)) + space_differences(2*ii-1, 2*ii-1)).eval();  
 	}
 	
 	// Last term in hermite polynomial.
 	return (Result * (target_time - time_differences(0)) + space_differences(0,0)).eval(); 
 } //re: HermiteInterpolateAndSolve
 
+
+
+
+/**
+\class HermiteInterpolant
+
+\brief A Hermite interpolant which is built up one sample at a time, over a sliding window of the most recent samples.
+
+HermiteInterpolateAndSolve builds the whole table of divided differences every time it is called.  The endgames add one sample at a time, though, and only ever want the most recent few.  This type keeps just the newest row of the table, \f$f[z_{M-j},\dots,z_M]\f$ for \f$j = 0,\dots,2n-1\f$, where the nodes \f$z\f$ are the sample times, each repeated for the derivative.  Adding a sample computes two new rows from the old one, costing \f$O(n \cdot \text{dim})\f$ rather than the \f$O(n^2 \cdot \text{dim})\f$ of a fresh table, and allocates nothing once the first sample has sized the storage.
+
+Because divided differences are symmetric in their nodes, the newest row is the set of coefficients of the Newton form of the interpolant with the nodes taken newest first.  Truncating it gives the interpolant through only the most recent samples, so samples older than the window simply fall off the end of the row.
+
+\tparam CT The complex number type.
+*/
+template<typename CT>
+class HermiteInterpolant
+{
+public:
+
+	/**
+	\brief Make an interpolant holding at most a given number of samples.
+	*/
+	HermiteInterpolant(unsigned max_num_samples = 0) : max_num_samples_(max_num_samples)
+	{}
+
+	/**
+	\brief Set the number of most recent samples to keep, and forget all samples.
+	*/
+	void MaxNumSamples(unsigned max_num_samples)
+	{
+		max_num_samples_ = max_num_samples;
+		Clear();
+	}
+
+	/**
+	\brief Get the number of most recent samples kept.
+	*/
+	unsigned MaxNumSamples() const
+	{
+		return max_num_samples_;
+	}
+
+	/**
+	\brief The number of samples currently interpolated, at most MaxNumSamples.
+	*/
+	unsigned NumSamples() const
+	{
+		return num_nodes_/2;
+	}
+
+	/**
+	\brief Forget all samples.  The storage is kept for reuse.
+	*/
+	void Clear()
+	{
+		num_nodes_ = 0;
+	}
+
+	/**
+	\brief Add a sample, dropping the oldest if there are already MaxNumSamples.
+
+	\param time The time of the sample.  Must differ from the times of the other samples.
+	\param sample The space value at the time.
+	\param derivative The derivative of the space value with respect to time.
+	*/
+	void AddSample(CT const& time, Vec<CT> const& sample, Vec<CT> const& derivative)
+	{
+		if (max_num_samples_==0)
+			throw std::runtime_error("HermiteInterpolant must be allowed at least one sample");
+
+		if (num_nodes_==0)
+		{
+			differences_.resize(sample.size(), 2*max_num_samples_);
+			previous_.resize(sample.size(), 2*max_num_samples_);
+			nodes_.resize(2*max_num_samples_);
+		}
+
+		AddNode(time, sample, nullptr);
+		AddNode(time, sample, &derivative);
+	}
+
+	/**
+	\brief Evaluate the interpolant through the most recent samples.
+
+	\param[out] result The value of the interpolant at the target time.
+	\param target_time The time at which to evaluate.
+	\param num_samples The number of most recent samples to use.
+	*/
+	void Evaluate(Vec<CT> & result, CT const& target_time, unsigned num_samples) const
+	{
+		if (num_samples==0 || 2*num_samples > num_nodes_)
+			throw std::runtime_error("requested evaluation of HermiteInterpolant using more samples than it has");
+
+		result = differences_.col(2*num_samples-1);
+		for (int jj = 2*num_samples-2; jj >= 0; --jj)
+		{
+			CT factor = target_time - nodes_(jj);
+			result *= factor;
+			result += differences_.col(jj);
+		}
+	}
+
+	/**
+	\brief Evaluate the interpolant through the most recent samples.
+
+	\param target_time The time at which to evaluate.
+	\param num_samples The number of most recent samples to use.
+	*/
+	Vec<CT> Evaluate(CT const& target_time, unsigned num_samples) const
+	{
+		Vec<CT> result;
+		Evaluate(result, target_time, num_samples);
+		return result;
+	}
+
+private:
+
+	/**
+	\brief Put a node at the front of the list, and compute its row of divided differences from the previous row.
+
+	\param derivative If not null, the node repeats the previous node, and this is the first divided difference.
+	*/
+	void AddNode(CT const& z, Vec<CT> const& value, Vec<CT> const* derivative)
+	{
+		const unsigned capacity = 2*max_num_samples_;
+
+		for (unsigned ii = num_nodes_ < capacity ? num_nodes_ : capacity-1; ii > 0; --ii)
+			std::swap(nodes_(ii), nodes_(ii-1));
+		nodes_(0) = z;
+
+		previous_.swap(differences_);
+		num_nodes_ = num_nodes_ < capacity ? num_nodes_+1 : capacity;
+
+		differences_.col(0) = value;
+		unsigned first = 1;
+		if (derivative)
+		{
+			differences_.col(1) = *derivative;
+			first = 2;
+		}
+
+		for (unsigned jj = first; jj < num_nodes_; ++jj)
+		{
+			CT denominator = z - nodes_(jj);
+			differences_.col(jj) = (differences_.col(jj-1) - previous_.col(jj-1)) / denominator;
+		}
+	}
+
+	unsigned max_num_samples_; ///< The number of most recent samples kept.
+	unsigned num_nodes_ = 0; ///< The number of nodes held, twice the number of samples.
+	Vec<CT> nodes_; ///< The nodes, newest first.  Each sample time appears twice.
+	Mat<CT> differences_; ///< Column j is the divided difference of the newest j+1 nodes.
+	Mat<CT> previous_; ///< The same, before the newest node was added.
+};
+
 }}  // re: namespaces
@@ -86,6 +86,7 @@ namespace bertini{
 					Precision(std::get< Mat<mpfr> >(J_temp_), new_precision);
 
 					std::get< Eigen::PartialPivLU<Mat<mpfr>> >(LU_) = Eigen::PartialPivLU<Mat<mpfr>>(numTotalFunctions_);
+					std::get< ConvergedPoint<mpfr> >(converged_).valid = false;
 
 					current_precision_ = new_precision;				
 				}
@@ -112,6 +113,50 @@ namespace bertini{
 					std::get< Vec<mpfr> >(f_temp_).resize(numTotalFunctions_);
 					std::get< Vec<dbl> >(step_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr> >(step_temp_).resize(numTotalFunctions_);
+					std::get< ConvergedPoint<dbl> >(converged_).valid = false;
+					std::get< ConvergedPoint<mpfr> >(converged_).valid = false;
+				}
+
+
+				/**
+				 \brief Compute the derivative \f$dx/dt = -J^{-1} \partial H/\partial t\f$ of a path through a point.
+
+				 If the most recent call to Correct converged to exactly this point and time, the factorization of the Jacobian from its final iteration is reused, saving an evaluation of the Jacobian and its factorization.  That factorization is at the iterate before the returned point, so it is only reused if the final Newton step was no longer than reuse_tolerance.  Otherwise the Jacobian is evaluated and factored at the point.
+
+				 \return Whether the factorization from Newton's method was reused.
+
+				 \param[out] dx_dt The derivative of the path.
+				 \param S The system being tracked.
+				 \param space The point on the path.
+				 \param time The time at the point.
+				 \param reuse_tolerance The longest final Newton step for which the factorization may be reused.
+				 */
+				template<typename ComplexType, typename RealType>
+				bool PathDerivative(Vec<ComplexType> & dx_dt,
+									System const& S,
+									Vec<ComplexType> const& space,
+									ComplexType const& time,
+									RealType const& reuse_tolerance)
+				{
+					Vec<ComplexType>& dh_dt = std::get< Vec<ComplexType> >(f_temp_);
+					S.TimeDerivativeInPlace(dh_dt, space, time);
+
+					const auto& converged = std::get< ConvergedPoint<ComplexType> >(converged_);
+					if (converged.valid && converged.step_norm <= reuse_tolerance && converged.time==time 
+					    && Precision(converged.space)==Precision(space) && converged.space==space)
+					{
+						dx_dt = -std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_).solve(dh_dt);
+						BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::LinearSolves);
+						return true;
+					}
+
+					// leave LU_ alone, so the converged factorization stays valid
+					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
+					S.JacobianInPlace(J_temp_ref, space, time);
+					dx_dt = -J_temp_ref.lu().solve(dh_dt);
+					BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::LUFactorizations);
+					BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::LinearSolves);
+					return false;
 				}
 
 				
@@ -155,6 +200,7 @@ namespace bertini{
 					#endif
 					
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
+					std::get< ConvergedPoint<ComplexType> >(converged_).valid = false;
 					
 					next_space = current_space;
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
@@ -167,7 +213,7 @@ namespace bertini{
 						next_space += step_ref;
 						
 						if ( (step_ref.norm() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
-							return SuccessCode::Success;
+							return Converged(next_space, current_time, step_ref.norm());
 					}
 					
 					return SuccessCode::FailedToConverge;
@@ -214,6 +260,7 @@ namespace bertini{
 					#endif
 					
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
+					std::get< ConvergedPoint<ComplexType> >(converged_).valid = false;
 					
 					next_space = current_space;
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
@@ -229,7 +276,7 @@ namespace bertini{
 						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
 						
 						if ( (step_ref.norm() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
-							return SuccessCode::Success;
+							return Converged(next_space, current_time, step_ref.norm());
 						
 						auto norm_J_inverse = LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm();
 						if (!amp::CriterionB(J_temp_ref.norm(), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, step_ref.norm(), AMP_config))
@@ -288,6 +335,7 @@ namespace bertini{
 					#endif
 					
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
+					std::get< ConvergedPoint<ComplexType> >(converged_).valid = false;
 					
 					next_space = current_space;
 					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
@@ -311,7 +359,7 @@ namespace bertini{
 						
 						
 						if ( (norm_delta_z < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
-							return SuccessCode::Success;
+							return Converged(next_space, current_time, norm_delta_z);
 						
 						if (!amp::CriterionB(norm_J, norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, norm_delta_z, AMP_config))
 							return SuccessCode::HigherPrecisionNecessary;
@@ -353,14 +401,18 @@ namespace bertini{
 					
 					Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
 					
+					BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::NewtonIterations);
+
 					S.EvalInPlace(f_temp_ref, current_space, current_time);
 					S.JacobianInPlace(J_temp_ref, current_space, current_time);
 					LU_ref = J_temp_ref.lu();
+					BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::LUFactorizations);
 					
 					if (LUPartialPivotDecompositionSuccessful(LU_ref.matrixLU())!=MatrixSuccessCode::Success)
 						return SuccessCode::MatrixSolveFailure;
 					
 					newton_step = LU_ref.solve(-f_temp_ref);
+					BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::LinearSolves);
 					
 					return SuccessCode::Success;
 					
@@ -368,6 +420,35 @@ namespace bertini{
 				
 
 				
+				/**
+				 \brief Record the point to which Newton's method converged, so the factorization in LU_ can be reused there.
+
+				 \return SuccessCode::Success, for convenience.
+				 */
+				template<typename ComplexType, typename Derived, typename RealType>
+				SuccessCode Converged(Eigen::MatrixBase<Derived> const& next_space, ComplexType const& current_time, RealType const& step_norm)
+				{
+					auto& converged = std::get< ConvergedPoint<ComplexType> >(converged_);
+					converged.space = next_space;
+					converged.time = current_time;
+					converged.step_norm = step_norm;
+					converged.valid = true;
+					return SuccessCode::Success;
+				}
+
+
+				/**
+				 \brief The point to which the most recent call to Correct converged.  LU_ holds the factorization of the Jacobian at the iterate before it.
+				 */
+				template<typename ComplexType>
+				struct ConvergedPoint
+				{
+					bool valid = false; ///< Whether the most recent call to Correct, in this type, converged.
+					Vec<ComplexType> space; ///< The point returned.
+					ComplexType time; ///< The time at which Newton's method was run.
+					typename Eigen::NumTraits<ComplexType>::Real step_norm; ///< The length of the final Newton step.
+				};
+
 				///////////////////////////
 				//
 				// Private Data Members
@@ -382,6 +463,7 @@ namespace bertini{
 				std::tuple< Mat<dbl>, Mat<mpfr> > J_temp_; // Variable to hold temporary evaluation of the Jacobian
 				
 				std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr>> > LU_; // The LU factorization from the Newton iterates
+				std::tuple< ConvergedPoint<dbl>, ConvergedPoint<mpfr> > converged_; // Where the most recent correction converged, for reusing LU_
 				
 				unsigned current_precision_;
 
@@ -61,6 +61,11 @@ namespace bertini {
 				precisions_.push_back(t.CurrentPrecision());
 			}
 
+			virtual EventMask ObservedEvents() const override
+			{
+				return EventBits<TrackingEvent<EmitterT>>();
+			}
+
 		public:
 			const std::vector<unsigned>& Precisions() const
 			{
@@ -96,6 +101,11 @@ namespace bertini {
 				path_.push_back(t.CurrentPoint());
 			}
 
+			virtual EventMask ObservedEvents() const override
+			{
+				return EventBits<EventT<EmitterT>>();
+			}
+
 		public:
 			const std::vector<Vec<mpfr> >& Path() const
 			{
@@ -229,6 +239,11 @@ namespace bertini {
 					std::cout << "observed step failure" << std::endl;
 			}
 
+			virtual EventMask ObservedEvents() const override
+			{
+				return EventBits<FailedStep<EmitterT>>();
+			}
+
 			virtual void Visit(TrackerT const& t) override
 			{}
 		};
@@ -0,0 +1,459 @@
+//This file is part of Bertini 2.
+//
+//parallel_cauchy_endgame.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parallel_cauchy_endgame.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parallel_cauchy_endgame.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file parallel_cauchy_endgame.hpp
+
+\brief Contains the ParallelCauchyEndgame type, which tracks the loops of the Cauchy endgame on several threads.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bertini2/random.hpp"
+#include "bertini2/tracking/cauchy_endgame.hpp"
+
+namespace bertini {  namespace tracking  { namespace endgame  {
+
+/**
+\class ParallelCauchyEndgame
+
+\brief Runs the Cauchy endgame with the loops around the origin spread over several threads.
+
+The loops at a single radius must be tracked one after another, because each starts where the previous one ended.  But the Cauchy endgame tracks a whole sequence of circles, at radii shrinking geometrically by the sample factor, and the points at which those circles start are found by tracking radially toward the origin, which is cheap compared to the circles themselves.  So while the approximation from one circle is being checked, the circles at the next few radii are already being tracked, speculatively, by other workers.  Approximations are consumed strictly in order of decreasing radius, with the same stopping criteria as CauchyEndgame::Run, so the result is the one the serial endgame would compute from the same circles.  Circles tracked past the one at which the endgame stops are discarded.
+
+Each worker is an endgame, with its own tracker, and the trackers must track distinct Systems which do not share nodes, because evaluation of a System is not re-entrant.  The first endgame leads: it computes the initial power series approximation and first circle, and tracks the radial path; the others track circles.  All endgames should have the same settings.  With only one endgame, Run is exactly CauchyEndgame::Run.
+
+\tparam EndgameT The type of Cauchy endgame to run on each worker, e.g. EndgameSelector<DoublePrecisionTracker>::Cauchy.
+
+## Example
+
+\code
+using EGT = EndgameSelector<DoublePrecisionTracker>::Cauchy;
+
+// one system, tracker, and endgame per worker
+std::vector<std::shared_ptr<EGT>> endgames;
+for (unsigned ii = 0; ii < num_workers; ++ii)
+	endgames.push_back(std::make_shared<EGT>(*trackers[ii]));
+
+ParallelCauchyEndgame<EGT> parallel_endgame(endgames);
+auto code = parallel_endgame.Run(t_endgame_boundary, x_endgame_boundary);
+auto solution = parallel_endgame.FinalApproximation<dbl>();
+\endcode
+
+Each circle, and each segment of the radial path, draws its random numbers from its own stream, made from a seed drawn from the calling thread's engine at the start of Run.  So the result depends on the random state of the caller, but not on which worker tracked what.
+
+The default precision is shared by all threads (see DefaultPrecision), and an adaptive precision endgame changes it as it works, so AMP endgames may only be used with one worker.
+*/
+template<class EndgameT>
+class ParallelCauchyEndgame
+{
+	/**
+	\brief A circle around the origin, at one radius, and the approximation computed from it.
+	*/
+	template<typename CT>
+	struct Circle
+	{
+		SuccessCode radial_code = SuccessCode::Success; ///< The code from tracking radially to the start of the circle.
+		SuccessCode circle_code = SuccessCode::Success; ///< The code from tracking around the circle.
+		SuccessCode approximation_code = SuccessCode::Success; ///< The code from computing the approximation.
+		CT time; ///< The time at which the circle starts.
+		unsigned cycle_number = 0; ///< The number of loops taken to close the circle.
+		Vec<CT> approximation; ///< The Cauchy approximation at the origin from this circle.
+		std::exception_ptr error; ///< Any exception thrown while working on this circle.
+		bool done = false; ///< Whether the worker has finished with this circle.
+	};
+
+public:
+
+	/**
+	\brief Make a parallel Cauchy endgame, with one worker per endgame.
+
+	\param endgames The endgames, one per worker.  The first is the lead.  Their trackers must track distinct Systems.
+	\throws std::runtime_error if there are no endgames, if two track the same System, or if there are several adaptive precision endgames.
+	*/
+	ParallelCauchyEndgame(std::vector<std::shared_ptr<EndgameT>> const& endgames) : endgames_(endgames)
+	{
+		if (endgames_.empty())
+			throw std::runtime_error("ParallelCauchyEndgame requires at least one endgame");
+
+		if (TrackerTraits<typename EndgameT::TrackerType>::IsAdaptivePrec && endgames_.size() > 1)
+			throw std::runtime_error("adaptive precision endgames change the process-wide default precision, so ParallelCauchyEndgame may only use one of them");
+
+		for (unsigned ii = 0; ii < endgames_.size(); ++ii)
+			for (unsigned jj = ii+1; jj < endgames_.size(); ++jj)
+				if (&endgames_[ii]->GetSystem() == &endgames_[jj]->GetSystem())
+					throw std::runtime_error("endgames for ParallelCauchyEndgame must track distinct systems, as system evaluation is not re-entrant");
+	}
+
+
+	/**
+	\brief The number of worker threads, including the lead.
+	*/
+	unsigned NumWorkers() const
+	{
+		return endgames_.size();
+	}
+
+
+	/**
+	\brief Get the endgame belonging to a worker.  Worker 0 is the lead.
+	*/
+	EndgameT & GetEndgame(unsigned worker_index)
+	{
+		return *endgames_.at(worker_index);
+	}
+
+
+	/**
+	\brief The cycle number of the circle from which the final approximation was computed.
+	*/
+	unsigned CycleNumber() const
+	{
+		return cycle_number_;
+	}
+
+
+	/**
+	\brief The approximation of the endpoint from the most recent Run.
+	*/
+	template<typename CT>
+	const Vec<CT>& FinalApproximation() const
+	{
+		return std::get<Vec<CT> >(final_approximation_at_origin_);
+	}
+
+
+	/**
+	\brief The number of circles started during the most recent Run, including the initial one and any started speculatively and discarded.
+	*/
+	unsigned NumCirclesTracked() const
+	{
+		return num_circles_tracked_;
+	}
+
+
+	/**
+	\brief The number of circles whose approximations were used during the most recent Run, including the initial one.
+	*/
+	unsigned NumCirclesUsed() const
+	{
+		return num_circles_used_;
+	}
+
+
+	/**
+	\brief Run the Cauchy endgame, with the circles tracked in parallel.
+
+	\param start_time The time at which to start the endgame.
+	\param start_point An approximate solution to the homotopy at start_time.
+	\return The same codes as CauchyEndgame::Run.
+
+	\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	SuccessCode Run(CT const& start_time, Vec<CT> const& start_point)
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+		using std::abs;
+
+		auto& lead = *endgames_.front();
+		Vec<CT>& final_approx = std::get<Vec<CT> >(final_approximation_at_origin_);
+
+		if (NumWorkers()==1)
+		{
+			auto code = lead.Run(start_time, start_point);
+			final_approx = lead.template FinalApproximation<CT>();
+			cycle_number_ = lead.CycleNumber();
+			num_circles_tracked_ = num_circles_used_ = 0;
+			return code;
+		}
+
+		if (start_point.size()!=lead.GetSystem().NumVariables())
+		{
+			std::stringstream err_msg;
+			err_msg << "number of variables in start point for ParallelCauchyEndgame, " << start_point.size() << ", must match the number of variables in the system, " << lead.GetSystem().NumVariables();
+			throw std::runtime_error(err_msg.str());
+		}
+
+		lead.template ClearTimesAndSamples<CT>();
+		lead.CycleNumber(0);
+		num_circles_tracked_ = num_circles_used_ = 0;
+
+		CT origin(0,0);
+		Vec<CT> prev_approx, latest_approx;
+
+		auto initial_ps_success = lead.InitialPowerSeriesApproximation(start_time, start_point, origin, prev_approx);
+		if (initial_ps_success != SuccessCode::Success)
+			return initial_ps_success;
+
+		auto extrapolation_success = lead.template ComputeCauchyApproximationOfXAtT0<CT>(latest_approx);
+		if (extrapolation_success != SuccessCode::Success)
+			return extrapolation_success;
+
+		num_circles_tracked_ = num_circles_used_ = 1;
+		cycle_number_ = lead.CycleNumber();
+		CT circle_time = lead.template GetCauchyTimes<CT>().front();
+
+		// the radial path starts where the first circle did
+		const std::uint64_t random_seed = ThreadRandomEngine()();
+		RadialPath<CT> radial(lead, circle_time, lead.template GetCauchySamples<CT>().front(), random_seed);
+
+		const auto& security = lead.SecuritySettings();
+		RT norm_of_dehom_of_prev_approx, norm_of_dehom_of_latest_approx;
+		if (security.level <= 0)
+			norm_of_dehom_of_prev_approx = radial.Dehomogenize(prev_approx).norm();
+
+		std::mutex mutex;
+		std::condition_variable changed;
+		std::deque<Circle<CT>> circles; // circle k is at index k-1, with the initial circle being circle 0
+		unsigned num_consumed = 0;
+		bool stop = false;
+		const unsigned lookahead = NumWorkers()-1;
+
+		auto worker_loop = [&](unsigned worker_index)
+		{
+			auto& endgame = *endgames_[worker_index];
+			while (true)
+			{
+				Circle<CT>* circle;
+				unsigned k;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					changed.wait(lock, [&]{return stop || circles.size() < num_consumed + lookahead;});
+					if (stop)
+						return;
+					circles.emplace_back();
+					circle = &circles.back();
+					k = circles.size();
+				}
+
+				try
+				{
+					ScopedRandomStream random_stream(random_seed, k);
+					Vec<CT> circle_start;
+					circle->radial_code = radial.Point(k, circle->time, circle_start);
+					if (circle->radial_code == SuccessCode::Success)
+					{
+						circle->circle_code = endgame.ComputeCauchySamples(circle->time, circle_start);
+						circle->cycle_number = endgame.CycleNumber();
+						if (circle->circle_code == SuccessCode::Success)
+							circle->approximation_code = endgame.template ComputeCauchyApproximationOfXAtT0<CT>(circle->approximation);
+					}
+				}
+				catch (...)
+				{
+					circle->error = std::current_exception();
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					circle->done = true;
+				}
+				changed.notify_all();
+			}
+		};
+
+		// stops and joins the workers however Run is left, letting circles in flight finish
+		struct WorkerStopper
+		{
+			std::mutex & mutex;
+			std::condition_variable & changed;
+			bool & stop;
+			std::vector<std::thread> workers;
+
+			~WorkerStopper()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					stop = true;
+				}
+				changed.notify_all();
+				for (auto& w : workers)
+					w.join();
+			}
+		} stopper{mutex, changed, stop, {}};
+
+		for (unsigned ii = 1; ii < NumWorkers(); ++ii)
+			stopper.workers.emplace_back(worker_loop, ii);
+
+		while (true)
+		{
+			if (security.level <= 0)
+				norm_of_dehom_of_latest_approx = radial.Dehomogenize(latest_approx).norm();
+
+			RT approximate_error = (latest_approx - prev_approx).norm();
+
+			if (approximate_error < lead.Tolerances().final_tolerance)
+			{
+				final_approx = latest_approx;
+				return SuccessCode::Success;
+			}
+			else if (abs(circle_time) < lead.EndgameSettings().min_track_time)
+			{
+				final_approx = latest_approx;
+				return SuccessCode::FailedToConverge;
+			}
+			else if (security.level <= 0 &&
+			   norm_of_dehom_of_prev_approx   > security.max_norm &&
+			   norm_of_dehom_of_latest_approx > security.max_norm  )
+			{
+				final_approx = latest_approx;
+				return SuccessCode::SecurityMaxNormReached;
+			}
+
+			prev_approx = latest_approx;
+			norm_of_dehom_of_prev_approx = norm_of_dehom_of_latest_approx;
+
+			Circle<CT>* circle;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				changed.wait(lock, [&]{return circles.size() > num_consumed && circles[num_consumed].done;});
+				circle = &circles[num_consumed];
+				num_circles_tracked_ = 1 + circles.size();
+			}
+
+			if (circle->error)
+				std::rethrow_exception(circle->error);
+
+			if (circle->radial_code != SuccessCode::Success)
+				return circle->radial_code;
+
+			circle_time = circle->time;
+			if (circle->circle_code == SuccessCode::GoingToInfinity)
+				return SuccessCode::GoingToInfinity;
+			else if (circle->circle_code != SuccessCode::Success && abs(circle_time) < lead.EndgameSettings().min_track_time)
+			{
+				final_approx = latest_approx;
+				return SuccessCode::MinTrackTimeReached;
+			}
+			else if (circle->circle_code != SuccessCode::Success)
+			{
+				final_approx = latest_approx;
+				return circle->circle_code;
+			}
+
+			if (circle->approximation_code != SuccessCode::Success)
+				return circle->approximation_code;
+
+			latest_approx = circle->approximation;
+			cycle_number_ = circle->cycle_number;
+			++num_circles_used_;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				++num_consumed;
+			}
+			changed.notify_all();
+		}
+	}
+
+private:
+
+	/**
+	\brief The path toward the origin along which the circles start, tracked on demand with the lead's tracker.
+
+	Point may be called concurrently by many workers.  The path is extended one segment at a time, each segment shrinking the time by the sample factor, and the points computed so far are kept.
+	*/
+	template<typename CT>
+	class RadialPath
+	{
+	public:
+		RadialPath(EndgameT & lead, CT const& start_time, Vec<CT> const& start_point, std::uint64_t random_seed) : lead_(lead), random_seed_(random_seed)
+		{
+			times_.push_back(start_time);
+			points_.push_back(start_point);
+		}
+
+		/**
+		\brief Get the point at which circle k starts, tracking further along the path if needed.
+
+		\param k The index of the circle.  Circle 0 starts at the start of the path.
+		\param[out] time The time of the point.
+		\param[out] point The space value of the point.
+		\return The code from tracking, which is SuccessCode::Success unless the path failed before reaching circle k.
+		*/
+		SuccessCode Point(unsigned k, CT & time, Vec<CT> & point)
+		{
+			using RT = typename Eigen::NumTraits<CT>::Real;
+			using bertini::Precision;
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			while (times_.size() <= k && code_ == SuccessCode::Success)
+			{
+				CT next_time = times_.back() * RT(lead_.EndgameSettings().sample_factor);
+				ScopedRandomStream random_stream(random_seed_, times_.size(), 1);
+				Vec<CT> next_point;
+				code_ = lead_.GetTracker().TrackPath(next_point, times_.back(), next_time, points_.back());
+				if (code_ != SuccessCode::Success)
+					break;
+				lead_.EnsureAtPrecision(next_time, Precision(next_point));
+				times_.push_back(next_time);
+				points_.push_back(next_point);
+			}
+
+			if (times_.size() <= k)
+				return code_;
+
+			time = times_[k];
+			point = points_[k];
+			return SuccessCode::Success;
+		}
+
+		/**
+		\brief Dehomogenize a point using the lead's system.  Locked, as the lead's system may be in use by the radial path.
+		*/
+		Vec<CT> Dehomogenize(Vec<CT> const& x)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return lead_.GetSystem().DehomogenizePoint(x);
+		}
+
+	private:
+		EndgameT & lead_; ///< The endgame whose tracker tracks the path.
+		std::uint64_t random_seed_; ///< The seed of the random streams of the segments.
+		std::mutex mutex_; ///< Protects the path, and the lead's system.
+		std::vector<CT> times_; ///< The times of the points computed so far.
+		std::vector<Vec<CT>> points_; ///< The points computed so far.
+		SuccessCode code_ = SuccessCode::Success; ///< The code from the most recent segment.
+	};
+
+
+	std::vector<std::shared_ptr<EndgameT>> endgames_; ///< One endgame per worker.  The first is the lead.
+	std::tuple<Vec<dbl>, Vec<mpfr>> final_approximation_at_origin_; ///< The result of the most recent Run.
+	unsigned cycle_number_ = 0; ///< The cycle number of the circle of the final approximation.
+	unsigned num_circles_tracked_ = 0; ///< The number of circles started during the most recent Run.
+	unsigned num_circles_used_ = 0; ///< The number of circles used during the most recent Run.
+};
+
+
+}}} // namespaces
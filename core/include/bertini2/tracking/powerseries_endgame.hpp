@@ -117,7 +117,7 @@ Vec<ComplexT> result;
 //4. Track all points to 0.1
 for (unsigned ii = 0; ii < TD_start_sys.NumStartPoints(); ++ii)
 {
-    mpfr_float::default_precision(ambient_precision);
+    DefaultPrecision(ambient_precision);
     my_homotopy.precision(ambient_precision); // making sure our precision is all set up 
     auto start_point = TD_start_sys.StartPoint<ComplexT>(ii);
 
@@ -221,6 +221,28 @@ protected:
 	*/
 	mutable Vec<BCT> rand_vector;
 
+	/**
+	\brief The Hermite interpolant for one candidate cycle number, in the s-plane for that candidate, together with how far through the samples it has got.
+	*/
+	template<typename CT>
+	struct CycleCandidate
+	{
+		HermiteInterpolant<CT> interpolant; ///< Interpolates the samples before end, with times \f$s = t^{1/c}\f$.
+		unsigned end = 0; ///< One past the index of the most recent sample added to the interpolant.
+	};
+
+	/**
+	\brief One interpolant per candidate cycle number, indexed by candidate-1.
+
+	These persist across calls to AdvanceTime, so that testing the candidates after a new sample arrives costs one new row of divided differences per candidate, rather than a whole table each.  They are invalidated whenever the samples are replaced or change precision.
+	*/
+	mutable std::tuple< std::vector<CycleCandidate<UsedNumTs> >... > cycle_candidates_;
+
+	/**
+	\brief The precision of the samples from which the cycle candidates were built.
+	*/
+	mutable unsigned cycle_candidate_precision_ = 0;
+
 public:
 
 	auto UpperBoundOnCycleNumber() const { return upper_bound_on_cycle_number_;}
@@ -238,13 +260,27 @@ public:
 	{
 		std::get<TimeCont<CT> >(times_).clear(); 
 		std::get<SampCont<CT> >(samples_).clear();
+		ClearCycleCandidates<CT>();
+	}
+
+	/**
+	\brief Forget the interpolants for the candidate cycle numbers, because the samples they were built from have changed.
+	*/
+	template<typename CT>
+	void ClearCycleCandidates() const
+	{
+		for (auto& candidate : std::get<std::vector<CycleCandidate<CT> > >(cycle_candidates_))
+		{
+			candidate.interpolant.Clear();
+			candidate.end = 0;
+		}
 	}
 
 	/**
 	\brief Function to set the times used for the Power Series endgame.
 	*/	
 	template<typename CT>
-	void SetTimes(TimeCont<CT> times_to_set) { std::get<TimeCont<CT> >(times_) = times_to_set;}
+	void SetTimes(TimeCont<CT> times_to_set) { std::get<TimeCont<CT> >(times_) = times_to_set; ClearCycleCandidates<CT>();}
 
 	/**
 	\brief Function to get the times used for the Power Series endgame.
@@ -256,7 +292,7 @@ public:
 	\brief Function to set the space values used for the Power Series endgame.
 	*/	
 	template<typename CT>
-	void SetSamples(SampCont<CT> samples_to_set) { std::get<SampCont<CT> >(samples_) = samples_to_set;}
+	void SetSamples(SampCont<CT> samples_to_set) { std::get<SampCont<CT> >(samples_) = samples_to_set; ClearCycleCandidates<CT>();}
 
 	/**
 	\brief Function to get the space values used for the Power Series endgame.
@@ -383,9 +419,9 @@ public:
 		ComputeBoundOnCycleNumber<CT>();
 
 
-		SampCont<CT> samples = std::get<SampCont<CT> >(samples_); // take a copy...  replace this asap with something that doesn't copy the data...
-			const auto& times   = std::get<TimeCont<CT> >(times_);
-			const auto& derivatives = std::get<SampCont<CT> >(derivatives_);
+		const auto& samples = std::get<SampCont<CT> >(samples_);
+		const auto& times   = std::get<TimeCont<CT> >(times_);
+		const auto& derivatives = std::get<SampCont<CT> >(derivatives_);
 
 		assert((samples.size() == times.size()) && "must have same number of times and samples");
 
@@ -396,45 +432,32 @@ public:
 
 		assert((samples.size() >= this->EndgameSettings().num_sample_points) && "must have sufficiently many sample points");
 
-		
-		const Vec<CT> most_recent_sample = samples.back();  // take a copy of the vector
-		samples.pop_back();// again, this should be replaced by something that doesn't need a copy of the samples
-		const CT most_recent_time = times.back();
-
 		//Now we actually compute the Cycle Number
 
-		//num_used_points is (num_sample_points-1)
-		//because we are using the most current sample to do an 
-		//exhaustive search for the best cycle number. 
-		//if there are less samples than num_sample_points return samples.size() otherwise return num_sample_points.
-		
+		//we use all but the most recent sample
+		//to do an exhaustive search for the cycle number best predicting it.
+		//if there are less samples than num_sample_points use them all, otherwise use num_sample_points.
+		const auto num_previous_samples = samples.size()-1;
+		const Vec<CT> & most_recent_sample = samples.back();
+		const CT & most_recent_time = times.back();
 
-		unsigned num_used_points = samples.size() < this->EndgameSettings().num_sample_points 
+		unsigned num_used_points = num_previous_samples < this->EndgameSettings().num_sample_points 
 									?
-								   samples.size() : this->EndgameSettings().num_sample_points ;
-
-		unsigned offset = samples.size() - num_used_points;
-		auto min_found_difference = Eigen::NumTraits<RT>::highest();
+								   num_previous_samples : this->EndgameSettings().num_sample_points ;
 
-		TimeCont<CT> s_times(num_used_points);
-		SampCont<CT> s_derivatives(num_used_points);
+		AdvanceCycleCandidates<CT>(upper_bound_on_cycle_number_, num_previous_samples);
 
+		const auto& candidates = std::get<std::vector<CycleCandidate<CT> > >(cycle_candidates_);
+		auto min_found_difference = Eigen::NumTraits<RT>::highest();
+		Vec<CT> prediction;
 
 		for(unsigned int candidate = 1; candidate <= upper_bound_on_cycle_number_; ++candidate)
 		{			
 			BOOST_LOG_TRIVIAL(severity_level::trace) << "testing cycle candidate " << candidate;
 
-			for(unsigned int ii=0; ii<num_used_points; ++ii)// using the last sample to predict to. 
-			{   using std::pow;
-				s_times[ii] = pow(times[ii+offset],1/static_cast<RT>(candidate));
-				s_derivatives[ii] = derivatives[ii+offset] * (candidate * pow(times[ii+offset], static_cast<RT>(candidate-1)/candidate));
-			}
-
-			RT curr_diff = (HermiteInterpolateAndSolve(
-			                      pow(most_recent_time,static_cast<RT>(1)/candidate), // the target time
-			                      num_used_points,s_times,samples,s_derivatives) // the input data
-			                 - 
-			                 most_recent_sample).norm();
+			using std::pow;
+			candidates[candidate-1].interpolant.Evaluate(prediction, pow(most_recent_time,static_cast<RT>(1)/candidate), num_used_points);
+			RT curr_diff = (prediction - most_recent_sample).norm();
 
 			if (curr_diff < min_found_difference)
 			{
@@ -449,6 +472,73 @@ public:
 	}//end ComputeCycleNumber
 
 
+	/**
+	\brief Bring the interpolants for the candidate cycle numbers up to date.
+
+	Each candidate's interpolant is made to hold the samples before a given index, at most num_sample_points of them, in its own s-plane, \f$s = t^{1/c}\f$, with derivatives \f$dx/ds = c\, t^{(c-1)/c}\, dx/dt\f$.  Only the samples not yet in an interpolant are added.  The logarithm of each new sample time is computed once and shared by all candidates.
+
+	\param max_candidate The largest candidate cycle number to bring up to date.  Candidates 1 through this one are done.
+	\param end One past the index of the most recent sample to interpolate.
+
+	\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	void AdvanceCycleCandidates(unsigned max_candidate, unsigned end) const
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+		using std::exp; using std::log;
+
+		const auto& samples = std::get<SampCont<CT> >(samples_);
+		const auto& times   = std::get<TimeCont<CT> >(times_);
+		const auto& derivatives = std::get<SampCont<CT> >(derivatives_);
+		auto& candidates = std::get<std::vector<CycleCandidate<CT> > >(cycle_candidates_);
+
+		auto precision = Precision(samples.back());
+		if (precision!=cycle_candidate_precision_)
+		{
+			ClearCycleCandidates<CT>();
+			cycle_candidate_precision_ = precision;
+		}
+
+		if (candidates.size() < max_candidate)
+			candidates.resize(max_candidate);
+
+		const unsigned window = this->EndgameSettings().num_sample_points;
+		const unsigned begin = end > window ? end - window : 0;
+
+		unsigned first_needed = end;
+		for (unsigned ii = 0; ii < max_candidate; ++ii)
+		{
+			auto& candidate = candidates[ii];
+			if (candidate.interpolant.MaxNumSamples()!=window || candidate.end > end || candidate.end < begin)
+			{
+				candidate.interpolant.MaxNumSamples(window);
+				candidate.end = begin;
+			}
+			if (candidate.end < first_needed)
+				first_needed = candidate.end;
+		}
+
+		Vec<CT> s_derivative;
+		for (unsigned jj = first_needed; jj < end; ++jj)
+		{
+			CT log_t = log(times[jj]);
+			for (unsigned ii = 0; ii < max_candidate; ++ii)
+			{
+				auto& candidate = candidates[ii];
+				if (candidate.end!=jj)
+					continue;
+
+				const RT c(ii+1);
+				CT s = exp(log_t/c);
+				s_derivative = derivatives[jj] * (c * times[jj] / s);
+				candidate.interpolant.AddSample(s, samples[jj], s_derivative);
+				++candidate.end;
+			}
+		}
+	}
+
+
 	/**
 		\brief Compute a set of derivatives using internal data to the endgame.
 
@@ -476,13 +566,12 @@ public:
 			this->GetSystem().precision(max_precision);
 		}
 
+		ClearCycleCandidates<CT>();
+
 		//Compute dx_dt for each sample.
 		derivatives.clear(); derivatives.resize(samples.size());
 		for(unsigned ii = 0; ii < samples.size(); ++ii)
-		{	
-			// uses LU look at Eigen documentation on inverse in Eigen/LU.
-		 	derivatives[ii] = -(this->GetSystem().Jacobian(samples[ii],times[ii]).inverse())*(this->GetSystem().TimeDerivative(samples[ii],times[ii]));
-		}
+		 	this->ComputeDerivative(derivatives[ii], samples[ii], times[ii]);
 	}
 	/**
 	\brief This function computes an approximation of the space value at the time time_t0. 
@@ -524,23 +613,14 @@ public:
 
 			ComputeCycleNumber<CT>();
 		auto c = this->CycleNumber();
-		// Conversion to S-plane.
-
-		
-		auto offset = samples.size() - num_sample_points;
-
-		TimeCont<CT> s_times(num_sample_points);
-		SampCont<CT> s_derivatives(num_sample_points);
+		if (c==0)
+			throw std::runtime_error("cycle number is 0 while computing approximation of root at target time");
 
-		for(unsigned ii = 0; ii < num_sample_points; ++ii){
-			if (c==0)
-				throw std::runtime_error("cycle number is 0 while computing approximation of root at target time");
+		// the interpolant for the cycle number, in the s-plane, brought up to date with the most recent sample
+		AdvanceCycleCandidates<CT>(c, samples.size());
+		const auto& interpolant = std::get<std::vector<CycleCandidate<CT> > >(cycle_candidates_)[c-1].interpolant;
 
-			s_times[ii] = pow(times[ii+offset],static_cast<RT>(1)/c);
-			s_derivatives[ii] = derivatives[ii+offset]*( c*pow(times[ii+offset],static_cast<RT>(c-1)/c ));
-		}
-
-		result = HermiteInterpolateAndSolve(pow(t0,static_cast<RT>(1)/c), num_sample_points, s_times, samples, s_derivatives);
+		interpolant.Evaluate(result, pow(t0,static_cast<RT>(1)/c), num_sample_points);
 		return SuccessCode::Success;
 	}//end ComputeApproximationOfXAtT0
 
@@ -568,7 +648,6 @@ public:
 		auto& times   = std::get<TimeCont<CT> >(times_);
 		auto& derivatives  = std::get<SampCont<CT> >(derivatives_);
 
-		Vec<CT> next_sample;
 		CT next_time = times.back() * this->EndgameSettings().sample_factor; //setting up next time value.
 
   		if (abs(next_time) < this->EndgameSettings().min_track_time)
@@ -580,16 +659,23 @@ public:
 
 
   		BOOST_LOG_TRIVIAL(severity_level::trace) << "tracking to t = " << next_time << ", default precision: " << DefaultPrecision() << "\n";
-		SuccessCode tracking_success = this->GetTracker().TrackPath(next_sample,times.back(),next_time,samples.back());
+		times.push_back(next_time);
+		samples.extend_back(); // reuses the storage of a dropped sample, and is overwritten by tracking
+
+		// the buffers may have grown, so only refer into them from here on
+		const auto n = samples.size();
+		SuccessCode tracking_success = this->GetTracker().TrackPath(samples[n-1],times[n-2],times[n-1],samples[n-2]);
 		if (tracking_success != SuccessCode::Success)
+		{
+			times.pop_back();
+			samples.pop_back();
 			return tracking_success;
+		}
 
-		AsDerived().EnsureAtPrecision(next_time,Precision(next_sample));
-		
-		times.push_back(next_time);
-		samples.push_back(next_sample);
+		AsDerived().EnsureAtPrecision(times.back(),Precision(samples.back()));
+		BERTINI_TELEMETRY_INCREMENT(telemetry::Counter::EndgameSamples);
 
-		auto refine_success = AsDerived().RefineSample(samples.back(), next_sample,  times.back());
+		auto refine_success = AsDerived().RefineSample(samples.back(), samples.back(), times.back());
 		if (refine_success != SuccessCode::Success)
 		{
 			BOOST_LOG_TRIVIAL(severity_level::trace) << "refining failed, code " << int(refine_success);
@@ -600,7 +686,8 @@ public:
  		auto max_precision = AsDerived().EnsureAtUniformPrecision(times, samples, derivatives);
 		this->GetSystem().precision(max_precision);
 
-		derivatives.push_back(-(this->GetSystem().Jacobian(samples.back(),times.back()).inverse())*(this->GetSystem().TimeDerivative(samples.back(),times.back())));
+		// the sample was just refined, so this reuses the refinement's factorization of the Jacobian
+		this->ComputeDerivative(derivatives.extend_back(), samples.back(), times.back());
 
  		return SuccessCode::Success;
 	}
@@ -631,6 +718,8 @@ public:
 			throw std::runtime_error(err_msg.str());
 		}
 
+		BERTINI_TELEMETRY_TIME(telemetry::Phase::Endgame);
+
 		BOOST_LOG_TRIVIAL(severity_level::trace) << "\n\nPSEG(), default precision: " << DefaultPrecision() << "\n\n";
 		BOOST_LOG_TRIVIAL(severity_level::trace) << "start point precision: " << Precision(start_point(0)) << "\n\n";
 
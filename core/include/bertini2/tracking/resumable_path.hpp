@@ -0,0 +1,229 @@
+//This file is part of Bertini 2.
+//
+//resumable_path.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//resumable_path.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with resumable_path.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file resumable_path.hpp
+
+\brief Contains the ResumablePath type, a path which can be tracked a few steps at a time.
+*/
+
+#pragma once
+
+#include "bertini2/tracking/tracker.hpp"
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\class ResumablePath
+
+		\brief A single path, together with the tracker state needed to track it a few iterations at a time.
+
+		A scheduler holding many of these can interleave the paths on one thread, advancing cheap ones first and preempting ones which are burning steps.  Each path owns a copy of the tracker it was made from, with its own predictor and corrector, so the paths do not interfere with each other.  The copy is made at construction, so set up the tracker (and attach any observers) before making paths from it.
+
+		Tracking does not start until the first call to Advance, so constructing many paths is cheap.
+
+		## Example
+
+		\code
+		AMPTracker tracker(sys);
+		// set up the tracker...
+
+		std::vector<ResumablePath<AMPTracker>> paths;
+		for (unsigned ii = 0; ii < num_paths; ++ii)
+			paths.emplace_back(tracker, t_start, t_end, start_points[ii]);
+
+		bool any_in_progress = true;
+		while (any_in_progress)
+		{
+			any_in_progress = false;
+			for (auto& p : paths)
+				if (p.Advance(10)==SuccessCode::PathInProgress)
+					any_in_progress = true;
+		}
+		\endcode
+
+		\tparam TrackerT The type of tracker to use.  Must be copy constructible.
+		*/
+		template<class TrackerT>
+		class ResumablePath
+		{
+			using BaseComplexType = typename TrackerTraits<TrackerT>::BaseComplexType;
+			using CT = BaseComplexType;
+
+		public:
+
+			/**
+			\brief Make a path, copying the tracker to use for it.
+
+			\param tracker The set-up tracker, of which to make a copy.
+			\param start_time The time at which to start tracking.
+			\param endtime The time to track to.
+			\param start_point The intial space values for tracking.
+			*/
+			ResumablePath(TrackerT const& tracker, CT const& start_time, CT const& endtime, Vec<CT> const& start_point) :
+				tracker_(tracker), start_time_(start_time), endtime_(endtime), start_point_(start_point)
+			{
+				tracker_.DetachWorkspace();
+			}
+
+
+			/**
+			\brief Track the path for at most a given number of iterations.
+
+			The first call initializes the path.  Once the path has finished, further calls do nothing, and return the final code again.
+
+			\param max_num_iterations The largest number of tracker iterations to take during this call.
+			\return SuccessCode::PathInProgress if there is more to do, SuccessCode::Success if the path reached the end time, and the failure code otherwise.
+			*/
+			SuccessCode Advance(unsigned max_num_iterations)
+			{
+				if (IsFinished())
+					return status_;
+
+				if (!started_)
+				{
+					started_ = true;
+					SuccessCode initialization_code = tracker_.InitializePath(start_time_, endtime_, start_point_);
+					if (initialization_code!=SuccessCode::Success)
+						return status_ = initialization_code;
+				}
+
+				status_ = tracker_.StepPath(max_num_iterations);
+
+				if (status_==SuccessCode::Success)
+					tracker_.FinalizePath(solution_);
+
+				return status_;
+			}
+
+
+			/**
+			\brief Track the path until it is finished, for whatever reason.
+
+			\return The final code for the path.
+			*/
+			SuccessCode Finish()
+			{
+				return Advance(std::numeric_limits<unsigned>::max());
+			}
+
+
+			/**
+			\brief Query whether the path is done, either successfully or not.
+			*/
+			bool IsFinished() const
+			{
+				return status_!=SuccessCode::PathInProgress;
+			}
+
+
+			/**
+			\brief Get the most recent code for the path.
+
+			This is SuccessCode::PathInProgress until the path finishes.
+			*/
+			SuccessCode Status() const
+			{
+				return status_;
+			}
+
+
+			/**
+			\brief Get the current time of the path.  Before the path is started, this is the start time.
+			*/
+			CT CurrentTime() const
+			{
+				if (!started_)
+					return start_time_;
+				return tracker_.CurrentTime();
+			}
+
+
+			/**
+			\brief Get the current precision in which the path is being tracked.
+			*/
+			unsigned CurrentPrecision() const
+			{
+				if (!started_)
+					return Precision(start_point_(0));
+				return tracker_.CurrentPrecision();
+			}
+
+
+			/**
+			\brief Get the number of steps taken, including successes and failures.
+			*/
+			unsigned NumTotalStepsTaken() const
+			{
+				if (!started_)
+					return 0;
+				return tracker_.NumTotalStepsTaken();
+			}
+
+
+			/**
+			\brief Get the solution at the end time.  Only meaningful once the path has finished successfully.
+			*/
+			Vec<CT> const& Solution() const
+			{
+				if (status_!=SuccessCode::Success)
+					throw std::runtime_error("requesting solution from a path which has not successfully finished");
+				return solution_;
+			}
+
+
+			/**
+			\brief Get the start point of the path.
+			*/
+			Vec<CT> const& StartPoint() const
+			{
+				return start_point_;
+			}
+
+
+			/**
+			\brief Get a const reference to the tracker used for this path.
+			*/
+			TrackerT const& GetTracker() const
+			{
+				return tracker_;
+			}
+
+		private:
+
+			TrackerT tracker_; ///< This path's own copy of the tracker.
+			CT start_time_; ///< The time at which the path starts.
+			CT endtime_; ///< The time to which the path is tracked.
+			Vec<CT> start_point_; ///< The point from which the path starts.
+			Vec<CT> solution_; ///< The solution at the end time, populated on success.
+
+			bool started_ = false; ///< Whether the path has been initialized.
+			SuccessCode status_ = SuccessCode::PathInProgress; ///< The most recent code from tracking.
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
@@ -0,0 +1,283 @@
+//This file is part of Bertini 2.
+//
+//tracking/ring_buffer.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//tracking/ring_buffer.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with tracking/ring_buffer.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file ring_buffer.hpp
+
+\brief Contains the RingBuffer type, the container for space and time samples in the endgames.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace bertini{
+
+	namespace tracking{
+
+		/**
+		\class RingBuffer
+
+		\brief A double-ended queue of samples, which reuses its storage.
+
+		The endgames push new samples onto the back and drop old ones off the front, many times per path, and for many paths.  With a std::deque, each push allocates a new vector, and for multiple precision each entry of that vector allocates too.  A RingBuffer instead keeps its slots around: pushing copy-assigns into a slot which already holds a vector of the right size, so the limbs are reused, and popping or clearing only moves the ends of the ring.  The endgames go further, and track each new sample straight into a slot made with extend_back(), so once the storage has grown to the size it needs, sample vectors are neither made nor copied.  This does not make the sampling loop allocation-free: times are still plain values, and multiple precision arithmetic makes its own temporaries.
+
+		The interface is the subset of std::deque used by the endgames.  Storage grows by doubling, and is never released.
+
+		\tparam T The type of sample held, Vec<CT> for space samples or CT for times.
+		*/
+		template<typename T>
+		class RingBuffer
+		{
+			template<typename BufferT, typename ValueT>
+			class Iterator
+			{
+			public:
+				using iterator_category = std::random_access_iterator_tag;
+				using value_type = T;
+				using difference_type = std::ptrdiff_t;
+				using pointer = ValueT*;
+				using reference = ValueT&;
+
+				Iterator(BufferT* buffer, std::size_t index) : buffer_(buffer), index_(index)
+				{}
+
+				reference operator*() const { return (*buffer_)[index_]; }
+				pointer operator->() const { return &(*buffer_)[index_]; }
+				reference operator[](difference_type n) const { return (*buffer_)[index_+n]; }
+
+				Iterator& operator++() { ++index_; return *this; }
+				Iterator operator++(int) { Iterator temp(*this); ++index_; return temp; }
+				Iterator& operator--() { --index_; return *this; }
+				Iterator operator--(int) { Iterator temp(*this); --index_; return temp; }
+				Iterator& operator+=(difference_type n) { index_ += n; return *this; }
+				Iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+				Iterator operator+(difference_type n) const { return Iterator(buffer_, index_+n); }
+				Iterator operator-(difference_type n) const { return Iterator(buffer_, index_-n); }
+				difference_type operator-(Iterator const& other) const { return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_); }
+
+				bool operator==(Iterator const& other) const { return index_==other.index_; }
+				bool operator!=(Iterator const& other) const { return index_!=other.index_; }
+				bool operator<(Iterator const& other) const { return index_<other.index_; }
+				bool operator>(Iterator const& other) const { return index_>other.index_; }
+				bool operator<=(Iterator const& other) const { return index_<=other.index_; }
+				bool operator>=(Iterator const& other) const { return index_>=other.index_; }
+
+			private:
+				BufferT* buffer_;
+				std::size_t index_;
+			};
+
+		public:
+
+			using value_type = T;
+			using size_type = std::size_t;
+			using reference = T&;
+			using const_reference = T const&;
+			using iterator = Iterator<RingBuffer, T>;
+			using const_iterator = Iterator<const RingBuffer, const T>;
+
+			RingBuffer() = default;
+
+			/**
+			\brief Make a buffer holding n default-constructed elements.
+			*/
+			explicit RingBuffer(size_type n) : slots_(n), size_(n)
+			{}
+
+			/**
+			Copies only the held elements, not the spare slots.
+			*/
+			RingBuffer(RingBuffer const& other)
+			{
+				slots_.reserve(other.size());
+				for (const auto& x : other)
+					slots_.push_back(x);
+				size_ = other.size();
+			}
+
+			/**
+			Copy-assigns into the existing slots, so assigning samples of the same shape allocates nothing.
+			*/
+			RingBuffer& operator=(RingBuffer const& other)
+			{
+				if (this!=&other)
+				{
+					clear();
+					for (const auto& x : other)
+						push_back(x);
+				}
+				return *this;
+			}
+
+			RingBuffer(RingBuffer &&) = default;
+			RingBuffer& operator=(RingBuffer &&) = default;
+
+
+			size_type size() const { return size_; }
+			bool empty() const { return size_==0; }
+
+			/**
+			\brief The number of elements which can be held before the storage grows.
+			*/
+			size_type capacity() const { return slots_.size(); }
+
+			reference operator[](size_type n) { return slots_[Slot(n)]; }
+			const_reference operator[](size_type n) const { return slots_[Slot(n)]; }
+
+			reference front() { return slots_[head_]; }
+			const_reference front() const { return slots_[head_]; }
+			reference back() { return slots_[Slot(size_-1)]; }
+			const_reference back() const { return slots_[Slot(size_-1)]; }
+
+			iterator begin() { return iterator(this, 0); }
+			iterator end() { return iterator(this, size_); }
+			const_iterator begin() const { return const_iterator(this, 0); }
+			const_iterator end() const { return const_iterator(this, size_); }
+			const_iterator cbegin() const { return begin(); }
+			const_iterator cend() const { return end(); }
+
+
+			/**
+			\brief Append a copy of a value, assigning into a spare slot if there is one.
+
+			The value may be an element of this buffer.
+			*/
+			void push_back(T const& value)
+			{
+				if (size_ < capacity())
+				{
+					slots_[Slot(size_)] = value;
+					++size_;
+					return;
+				}
+
+				T copy(value); // value may live in slots_, which is about to move
+				Grow(size_+1);
+				slots_[Slot(size_)] = copy;
+				++size_;
+			}
+
+			/**
+			\brief Append a value made from the arguments.
+
+			Provided for compatibility with std::deque.  The value is made and then assigned into a slot, so this does not avoid the construction of a temporary.
+			*/
+			template<typename... Args>
+			void emplace_back(Args&&... args)
+			{
+				push_back(T(std::forward<Args>(args)...));
+			}
+
+			/**
+			\brief Append an element, reusing whatever value its slot last held.
+
+			This is the allocation-free way to make room for a value which is about to be written, such as the output of tracking a path.  The contents of the new element are unspecified, though it is default-constructed if the storage had to grow.
+
+			\return A reference to the new back element.
+			*/
+			reference extend_back()
+			{
+				if (size_ == capacity())
+					Grow(size_+1);
+				++size_;
+				return back();
+			}
+
+			void pop_front()
+			{
+				head_ = (head_+1) % capacity();
+				--size_;
+			}
+
+			void pop_back()
+			{
+				--size_;
+			}
+
+			/**
+			\brief Forget all elements.  The storage is kept for reuse.
+			*/
+			void clear()
+			{
+				head_ = 0;
+				size_ = 0;
+			}
+
+			/**
+			\brief Change the number of elements.
+
+			Unlike std::deque, elements added in slots which already existed keep whatever value they last held.  They are default-constructed only when the storage grows.
+			*/
+			void resize(size_type n)
+			{
+				if (n > capacity())
+					Grow(n);
+				size_ = n;
+			}
+
+			/**
+			\brief Make sure n elements can be held without growing.
+			*/
+			void reserve(size_type n)
+			{
+				if (n > capacity())
+					Grow(n);
+			}
+
+		private:
+
+			size_type Slot(size_type n) const
+			{
+				auto s = head_ + n;
+				return s < capacity() ? s : s - capacity();
+			}
+
+			/**
+			\brief Grow to at least a given capacity, by doubling, and straighten the ring out so that the head is in slot 0.
+			*/
+			void Grow(size_type min_capacity)
+			{
+				size_type new_capacity = capacity() > 0 ? 2*capacity() : 4;
+				while (new_capacity < min_capacity)
+					new_capacity *= 2;
+
+				std::vector<T> new_slots(new_capacity);
+				for (size_type ii = 0; ii < capacity(); ++ii)
+					std::swap(new_slots[ii], slots_[Slot(ii)]);
+
+				slots_.swap(new_slots);
+				head_ = 0;
+			}
+
+			std::vector<T> slots_; ///< The storage.  Slots outside the held range keep their values, for reuse.
+			size_type head_ = 0; ///< The slot holding the front element.
+			size_type size_ = 0; ///< The number of elements held.
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
@@ -35,14 +35,16 @@
 #include "bertini2/eigen_extensions.hpp"
 
 #include "bertini2/system.hpp"
+#include "bertini2/tracking/ring_buffer.hpp"
 
 namespace bertini
 {
 	namespace tracking{
 
 		// aliases for the types used to contain space and time samples, and random vectors for the endgames.
-		template<typename T> using SampCont = std::deque<Vec<T> >;
-		template<typename T> using TimeCont = std::deque<T>;
+		// these are ring buffers, so that an endgame reuses the storage for its samples from path to path.
+		template<typename T> using SampCont = RingBuffer<Vec<T> >;
+		template<typename T> using TimeCont = RingBuffer<T>;
 		
 		
 		enum class PrecisionType
@@ -212,6 +214,7 @@ namespace bertini
 			MinTrackTimeReached,
 			SecurityMaxNormReached,
 			CycleNumTooHigh,
+			PathInProgress,
 
 		};
 
@@ -341,10 +344,11 @@ namespace bertini
 
 			template<typename T>
 			struct PostProcessing{
-				T real_threshold;
-				T endpoint_finite_threshold;
-				T final_tol_multiplier;
-				T final_tol_times_mult;
+				T real_threshold = T(1)/T(100000000); ///< An endpoint is real if the imaginary part of each coordinate is at most this.
+				T endpoint_finite_threshold = T(100000); ///< An endpoint is finite if its dehomogenized norm is at most this.
+				T final_tol_multiplier = T(10); ///< Multiplies the final tolerance, to decide when endpoints are the same.
+				T final_tol_times_mult = T(1)/T(10000000000); ///< Endpoints closer than this are the same.
+				T condition_number_threshold = T(100000000); ///< An endpoint is singular if its condition number exceeds this.
 			};
 
 
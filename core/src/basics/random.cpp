@@ -0,0 +1,72 @@
+//This file is part of Bertini 2.
+//
+//random.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//random.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with random.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file random.cpp
+
+\brief Seeding of the per-thread random number engines.
+*/
+
+#include "bertini2/random.hpp"
+
+#include <atomic>
+
+#include <boost/random/seed_seq.hpp>
+
+namespace bertini {
+
+	namespace {
+		std::atomic<std::uint64_t> base_seed(RandomEngine::default_seed);
+		std::atomic<std::uint64_t> num_seeded_threads(0);
+	}
+
+	RandomEngine MakeRandomEngine(std::uint64_t seed, std::uint64_t stream, std::uint64_t substream)
+	{
+		boost::random::seed_seq seq{
+			static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32),
+			static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32),
+			static_cast<std::uint32_t>(substream), static_cast<std::uint32_t>(substream >> 32)};
+		return RandomEngine(seq);
+	}
+
+	std::uint64_t DefaultRandomSeed()
+	{
+		return base_seed;
+	}
+
+	void DefaultRandomSeed(std::uint64_t seed)
+	{
+		base_seed = seed;
+		SeedThreadRandomEngine(seed);
+	}
+
+	namespace detail {
+		RandomEngine MakeThreadRandomEngine()
+		{
+			return MakeRandomEngine(base_seed, num_seeded_threads++);
+		}
+	}
+
+} // namespace bertini
@@ -0,0 +1,162 @@
+//This file is part of Bertini 2.
+//
+//telemetry.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//telemetry.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with telemetry.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+// telemetry.cpp:  the registry of per-thread telemetry counters, for computational core of Bertini2
+
+
+#include "bertini2/detail/telemetry.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace bertini {
+
+	namespace telemetry {
+
+		const char* Name(Counter c)
+		{
+			switch (c)
+			{
+				case Counter::SystemEvaluationsDouble: return "system_evaluations_double";
+				case Counter::SystemEvaluationsMultiple: return "system_evaluations_multiple";
+				case Counter::JacobianEvaluationsDouble: return "jacobian_evaluations_double";
+				case Counter::JacobianEvaluationsMultiple: return "jacobian_evaluations_multiple";
+				case Counter::LUFactorizations: return "lu_factorizations";
+				case Counter::LinearSolves: return "linear_solves";
+				case Counter::NewtonIterations: return "newton_iterations";
+				case Counter::PredictorStages: return "predictor_stages";
+				case Counter::PrecisionIncreases: return "precision_increases";
+				case Counter::PrecisionDecreases: return "precision_decreases";
+				case Counter::EndgameSamples: return "endgame_samples";
+				case Counter::EndgameLoopClosures: return "endgame_loop_closures";
+				default: return "unknown_counter";
+			}
+		}
+
+		const char* Name(Phase p)
+		{
+			switch (p)
+			{
+				case Phase::Tracking: return "tracking";
+				case Phase::Prediction: return "prediction";
+				case Phase::Correction: return "correction";
+				case Phase::Endgame: return "endgame";
+				default: return "unknown_phase";
+			}
+		}
+
+
+		namespace {
+
+			/**
+			\brief All the blocks of counters, for live threads and for reuse, and the totals of finished threads.
+			*/
+			struct Registry
+			{
+				std::mutex mutex;
+				std::vector<std::unique_ptr<detail::ThreadCounters>> blocks; ///< Every block ever made.  Never shrinks, so pointers stay valid.
+				std::vector<detail::ThreadCounters*> free_blocks; ///< Blocks of finished threads, zeroed, ready for reuse.
+				Snapshot retired; ///< The totals of finished threads.
+			};
+
+			Registry& GetRegistry()
+			{
+				static Registry registry;
+				return registry;
+			}
+
+			void AccumulateInto(Snapshot & total, detail::ThreadCounters const& block)
+			{
+				for (unsigned ii = 0; ii < NumCounters; ++ii)
+					total.counts[ii] += block.counts[ii].load(std::memory_order_relaxed);
+				for (unsigned ii = 0; ii < NumPhases; ++ii)
+				{
+					total.phase_nanoseconds[ii] += block.phase_nanoseconds[ii].load(std::memory_order_relaxed);
+					total.phase_entries[ii] += block.phase_entries[ii].load(std::memory_order_relaxed);
+				}
+			}
+
+		} // re: anonymous namespace
+
+
+		namespace detail {
+
+			ThreadCounters* AcquireThreadCounters()
+			{
+				auto& registry = GetRegistry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+
+				if (!registry.free_blocks.empty())
+				{
+					auto block = registry.free_blocks.back();
+					registry.free_blocks.pop_back();
+					return block;
+				}
+
+				registry.blocks.push_back(std::make_unique<ThreadCounters>());
+				return registry.blocks.back().get();
+			}
+
+			void ReleaseThreadCounters(ThreadCounters* counters)
+			{
+				auto& registry = GetRegistry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+
+				AccumulateInto(registry.retired, *counters);
+				counters->Zero();
+				registry.free_blocks.push_back(counters);
+			}
+
+		} // re: namespace detail
+
+
+		Snapshot TakeSnapshot()
+		{
+			auto& registry = GetRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+
+			// free blocks are zero, so summing every block counts exactly the live threads
+			Snapshot total = registry.retired;
+			for (const auto& block : registry.blocks)
+				AccumulateInto(total, *block);
+			return total;
+		}
+
+		void Reset()
+		{
+			auto& registry = GetRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+
+			registry.retired = Snapshot();
+			for (auto& block : registry.blocks)
+				block->Zero();
+		}
+
+	} // re: namespace telemetry
+} // re: namespace bertini
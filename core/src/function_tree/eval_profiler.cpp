@@ -0,0 +1,185 @@
+//This file is part of Bertini 2.
+//
+//eval_profiler.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//eval_profiler.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with eval_profiler.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "bertini2/function_tree/eval_profiler.hpp"
+#include "bertini2/function_tree.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+namespace bertini {
+namespace node {
+
+	namespace {
+
+		/**
+		\brief The label of a node in the call tree.  Semicolons and line breaks separate frames and stacks in the folded format, so are replaced.
+		*/
+		std::string Label(Node const& n, Variable const* diff_variable)
+		{
+			std::stringstream ss;
+			if (auto j = dynamic_cast<Jacobian const*>(&n))
+			{
+				ss << j->name();
+				if (diff_variable)
+					ss << "/d" << diff_variable->name();
+			}
+			else if (auto f = dynamic_cast<Function const*>(&n))
+				ss << f->name();
+			else
+				ss << n;
+
+			auto label = ss.str();
+			std::replace(label.begin(), label.end(), ';', ',');
+			std::replace(label.begin(), label.end(), '\n', ' ');
+			return label;
+		}
+
+		void Accumulate(EvalProfile::Entry & e, std::uint64_t const calls[2], std::uint64_t const nanoseconds[2])
+		{
+			e.calls_double += calls[0];
+			e.calls_multiple += calls[1];
+			e.seconds_double += nanoseconds[0] * 1e-9;
+			e.seconds_multiple += nanoseconds[1] * 1e-9;
+		}
+	}
+
+
+	EvalProfile::EvalProfile()
+	{
+		Clear();
+	}
+
+
+	void EvalProfile::Clear()
+	{
+		frames_.clear();
+		frames_.emplace_back();
+		frames_.front().parent = 0;
+		current_ = 0;
+	}
+
+
+	void EvalProfile::Enter(Node const& n, Variable const* diff_variable)
+	{
+		auto key = std::make_pair(&n, diff_variable);
+		auto found = frames_[current_].children.find(key);
+		if (found!=frames_[current_].children.end())
+		{
+			current_ = found->second;
+			return;
+		}
+
+		std::size_t index = frames_.size();
+		frames_.emplace_back();
+		frames_.back().label = Label(n, diff_variable);
+		frames_.back().parent = current_;
+		frames_[current_].children.emplace(key, index);
+		current_ = index;
+	}
+
+
+	void EvalProfile::Exit(bool multiple_precision, std::uint64_t nanoseconds)
+	{
+		auto& f = frames_[current_];
+		++f.calls[multiple_precision];
+		f.nanoseconds[multiple_precision] += nanoseconds;
+		current_ = f.parent;
+	}
+
+
+	std::uint64_t EvalProfile::SelfNanoseconds(Frame const& f) const
+	{
+		std::uint64_t total = f.nanoseconds[0] + f.nanoseconds[1];
+		std::uint64_t beneath = 0;
+		for (const auto& c : f.children)
+			beneath += frames_[c.second].nanoseconds[0] + frames_[c.second].nanoseconds[1];
+		// clock granularity can make the children appear to take longer than the parent
+		return total > beneath ? total - beneath : 0;
+	}
+
+
+	std::vector<EvalProfile::Entry> EvalProfile::Roots() const
+	{
+		std::map<std::string, Entry> by_label;
+		for (const auto& c : frames_.front().children)
+		{
+			const auto& f = frames_[c.second];
+			auto& e = by_label[f.label];
+			e.expression = f.label;
+			Accumulate(e, f.calls, f.nanoseconds);
+			e.self_seconds += SelfNanoseconds(f) * 1e-9;
+		}
+
+		std::vector<Entry> roots;
+		for (auto& l : by_label)
+			roots.push_back(std::move(l.second));
+		std::stable_sort(roots.begin(), roots.end(), [](Entry const& a, Entry const& b){return a.Seconds() > b.Seconds();});
+		return roots;
+	}
+
+
+	std::vector<EvalProfile::Entry> EvalProfile::Nodes() const
+	{
+		std::map<std::string, Entry> by_label;
+		for (std::size_t ii = 1; ii < frames_.size(); ++ii)
+		{
+			const auto& f = frames_[ii];
+			auto& e = by_label[f.label];
+			e.expression = f.label;
+			Accumulate(e, f.calls, f.nanoseconds);
+			e.self_seconds += SelfNanoseconds(f) * 1e-9;
+		}
+
+		std::vector<Entry> nodes;
+		for (auto& l : by_label)
+			nodes.push_back(std::move(l.second));
+		std::stable_sort(nodes.begin(), nodes.end(), [](Entry const& a, Entry const& b){return a.self_seconds > b.self_seconds;});
+		return nodes;
+	}
+
+
+	void EvalProfile::WriteFoldedStacks(std::ostream & out) const
+	{
+		for (const auto& c : frames_.front().children)
+			WriteFoldedStacks(out, c.second, "");
+	}
+
+
+	void EvalProfile::WriteFoldedStacks(std::ostream & out, std::size_t frame_index, std::string const& path) const
+	{
+		const auto& f = frames_[frame_index];
+		auto here = path.empty() ? f.label : path + ";" + f.label;
+
+		auto self = SelfNanoseconds(f);
+		if (self > 0)
+			out << here << ' ' << self << '\n';
+
+		for (const auto& c : f.children)
+			WriteFoldedStacks(out, c.second, here);
+	}
+
+} // re: namespace node
+} // re: namespace bertini
@@ -54,3 +54,16 @@ BOOST_CLASS_EXPORT(bertini::node::PowerOperator)
 BOOST_CLASS_EXPORT(bertini::node::IntegerPowerOperator)
 BOOST_CLASS_EXPORT(bertini::node::SqrtOperator)
 BOOST_CLASS_EXPORT(bertini::node::ExpOperator)
+
+
+
+namespace bertini {
+	namespace node {
+
+		void Differential::CloneChildren(NodeCloneMap & already_cloned)
+		{
+			differential_variable_ = std::dynamic_pointer_cast<const Variable>(differential_variable_->Clone(already_cloned));
+		}
+
+	} // re: namespace node
+} // re: namespace bertini
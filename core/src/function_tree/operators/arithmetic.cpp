@@ -32,6 +32,32 @@
 namespace bertini{
 	namespace node{
 		using ::pow;
+
+		namespace {
+			// the Minkowski sum of two supports, for products.
+			std::set<std::vector<int> > MinkowskiSum(std::set<std::vector<int> > const& A, std::set<std::vector<int> > const& B)
+			{
+				std::set<std::vector<int> > result;
+				for (const auto& a : A)
+					for (const auto& b : B)
+					{
+						std::vector<int> c(a);
+						for (unsigned ii = 0; ii < c.size(); ++ii)
+							c[ii] += b[ii];
+						result.insert(c);
+					}
+				return result;
+			}
+
+			// the Minkowski sum of a support with itself, power times.
+			std::set<std::vector<int> > MinkowskiPower(std::set<std::vector<int> > const& A, int power, size_t num_vars)
+			{
+				std::set<std::vector<int> > result{std::vector<int>(num_vars,0)};
+				for (int ii = 0; ii < power; ++ii)
+					result = MinkowskiSum(result, A);
+				return result;
+			}
+		}
 		
 		///////////////////////
 		//
@@ -138,6 +164,18 @@ namespace bertini{
 			return deg;
 		}
 
+
+		std::set<std::vector<int> > SumOperator::Support(VariableGroup const& vars) const
+		{
+			std::set<std::vector<int> > supp;
+			for (const auto& iter : children_)
+			{
+				auto term_supp = iter->Support(vars);
+				supp.insert(term_supp.begin(), term_supp.end());
+			}
+			return supp;
+		}
+
 		void SumOperator::Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar)
 		{
 			
@@ -530,6 +568,20 @@ namespace bertini{
 		}
 
 
+		std::set<std::vector<int> > MultOperator::Support(VariableGroup const& vars) const
+		{
+			std::set<std::vector<int> > supp{std::vector<int>(vars.size(),0)};
+			for (auto iter = children_.begin(); iter!=children_.end(); ++iter)
+			{
+				if (*(children_mult_or_div_.begin() + (iter-children_.begin())))
+					supp = MinkowskiSum(supp, (*iter)->Support(vars));
+				else if ((*iter)->Degree(vars)!=0)
+					throw std::runtime_error("asking for support of non-polynomial node");
+			}
+			return supp;
+		}
+
+
 
 		void MultOperator::Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar)
 		{
@@ -722,6 +774,26 @@ namespace bertini{
 		}
 
 
+		std::set<std::vector<int> > PowerOperator::Support(VariableGroup const& vars) const
+		{
+			if (exponent_->Degree(vars)!=0)
+				throw std::runtime_error("asking for support of non-polynomial node");
+
+			auto base_deg = base_->Degree(vars);
+			if (base_deg==0)
+				return {std::vector<int>(vars.size(),0)};
+
+			auto exp_val = exponent_->Eval<dbl>();
+			if (fabs(imag(exp_val)) > 10*std::numeric_limits<double>::epsilon()
+			    || fabs(real(exp_val) - std::round(real(exp_val))) > 10*std::numeric_limits<double>::epsilon()
+			    || real(exp_val) < 0
+			    || base_deg < 0)
+				throw std::runtime_error("asking for support of non-polynomial node");
+
+			return MinkowskiPower(base_->Support(vars), static_cast<int>(std::round(real(exp_val))), vars.size());
+		}
+
+
 
 		void PowerOperator::Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar)
 		{
@@ -851,6 +923,19 @@ namespace bertini{
 				return exponent_*base_deg;
 			
 		}
+
+
+		std::set<std::vector<int> > IntegerPowerOperator::Support(VariableGroup const& vars) const
+		{
+			if (exponent_ < 0)
+			{
+				if (child_->Degree(vars)!=0)
+					throw std::runtime_error("asking for support of non-polynomial node");
+				return {std::vector<int>(vars.size(),0)};
+			}
+
+			return MinkowskiPower(child_->Support(vars), exponent_, vars.size());
+		}
 		
 
 		
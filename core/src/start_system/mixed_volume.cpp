@@ -0,0 +1,594 @@
+//This file is part of Bertini 2.
+//
+//start_system/mixed_volume.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//start_system/mixed_volume.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with start_system/mixed_volume.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "bertini2/start_system/mixed_volume.hpp"
+#include "bertini2/random.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+#include <Eigen/Dense>
+#include <boost/random/uniform_int_distribution.hpp>
+
+
+namespace bertini {
+
+	namespace start_system {
+
+		namespace polyhedral {
+
+			namespace {
+
+				using Row = std::vector<mpq_rational>;
+				using Edge = std::pair<unsigned, unsigned>;
+
+
+				// reduce a row against an echelon basis, and add it if it's independent of the rows already there.
+				bool AddIfIndependent(std::vector<std::pair<unsigned, Row> > & echelon, Row row)
+				{
+					for (const auto& e : echelon)
+					{
+						if (row[e.first]==0)
+							continue;
+
+						mpq_rational factor = row[e.first]/e.second[e.first];
+						for (unsigned jj = 0; jj < row.size(); ++jj)
+							row[jj] -= factor*e.second[jj];
+					}
+
+					for (unsigned jj = 0; jj < row.size(); ++jj)
+						if (row[jj]!=0)
+						{
+							echelon.emplace_back(jj, std::move(row));
+							return true;
+						}
+					return false;
+				}
+
+
+				// solve A x = b exactly, by Gaussian elimination.  returns false if A is singular.
+				bool SolveExact(std::vector<Row> A, Row b, Row & x, mpq_rational & det)
+				{
+					auto n = A.size();
+					det = 1;
+					for (unsigned col = 0; col < n; ++col)
+					{
+						unsigned pivot = col;
+						while (pivot < n && A[pivot][col]==0)
+							++pivot;
+						if (pivot==n)
+							return false;
+
+						if (pivot!=col)
+						{
+							std::swap(A[pivot], A[col]);
+							std::swap(b[pivot], b[col]);
+							det = -det;
+						}
+						det *= A[col][col];
+
+						for (unsigned rr = col+1; rr < n; ++rr)
+						{
+							if (A[rr][col]==0)
+								continue;
+							mpq_rational factor = A[rr][col]/A[col][col];
+							for (unsigned cc = col; cc < n; ++cc)
+								A[rr][cc] -= factor*A[col][cc];
+							b[rr] -= factor*b[col];
+						}
+					}
+
+					x.resize(n);
+					for (int rr = n-1; rr >= 0; --rr)
+					{
+						mpq_rational s = b[rr];
+						for (unsigned cc = rr+1; cc < n; ++cc)
+							s -= A[rr][cc]*x[cc];
+						x[rr] = s/A[rr][rr];
+					}
+					return true;
+				}
+
+
+				// whether y >= 0, with y^T A = 0 and y^T b = 1, for some y near the approximate y_approx, and supported where it is positive.
+				// such a y is a Farkas certificate that A z >= b has no solution.  A and b must be integer valued, and the check is exact.
+				bool CertifiesInfeasible(Eigen::MatrixXd const& A, Eigen::VectorXd const& b, Eigen::VectorXd const& y_approx, double tol)
+				{
+					const auto n = A.cols();
+
+					std::vector<long> support;
+					for (long rr = 0; rr < A.rows(); ++rr)
+						if (y_approx(rr) > tol)
+							support.push_back(rr);
+					if (support.empty())
+						return false;
+
+					// the system [A_S^T; b_S^T] y_S = e_{n+1}, reduced to row echelon form
+					const auto k = support.size();
+					std::vector<Row> M(n+1, Row(k+1));
+					for (unsigned cc = 0; cc < k; ++cc)
+					{
+						for (long vv = 0; vv < n; ++vv)
+							M[vv][cc] = std::lround(A(support[cc],vv));
+						M[n][cc] = std::lround(b(support[cc]));
+					}
+					M[n][k] = 1;
+
+					std::vector<unsigned> pivot_columns;
+					unsigned rank = 0;
+					for (unsigned cc = 0; cc < k && rank <= n; ++cc)
+					{
+						unsigned pivot = rank;
+						while (pivot <= n && M[pivot][cc]==0)
+							++pivot;
+						if (pivot > n)
+							continue;
+
+						std::swap(M[pivot], M[rank]);
+						for (unsigned rr = 0; rr <= n; ++rr)
+						{
+							if (rr==rank || M[rr][cc]==0)
+								continue;
+							mpq_rational factor = M[rr][cc]/M[rank][cc];
+							for (unsigned jj = cc; jj <= k; ++jj)
+								M[rr][jj] -= factor*M[rank][jj];
+						}
+						pivot_columns.push_back(cc);
+						++rank;
+					}
+
+					// inconsistent, so no such y on this support
+					for (unsigned rr = rank; rr <= n; ++rr)
+						if (M[rr][k]!=0)
+							return false;
+
+					// the free entries keep their approximate values, scaled so y^T b is about 1, which are positive, and the pivot entries are solved for
+					const double scale = 1/b.dot(y_approx);
+					std::vector<bool> is_pivot(k, false);
+					for (auto cc : pivot_columns)
+						is_pivot[cc] = true;
+
+					for (unsigned rr = 0; rr < rank; ++rr)
+					{
+						mpq_rational value = M[rr][k];
+						for (unsigned cc = pivot_columns[rr]+1; cc < k; ++cc)
+							if (!is_pivot[cc] && M[rr][cc]!=0)
+								value -= M[rr][cc]*mpq_rational(scale*y_approx(support[cc]));
+						if (value/M[rr][pivot_columns[rr]] < 0)
+							return false;
+					}
+					return true;
+				}
+
+
+				// whether there is a z with A z >= b.  a small dense phase one simplex method, with Bland's rule.
+				// this is only used for pruning, so when in doubt it says feasible.  in particular, it only says infeasible if it can prove it exactly.
+				bool IsFeasible(Eigen::MatrixXd const& A, Eigen::VectorXd const& b)
+				{
+					const auto m = A.rows(), n = A.cols();
+					if (m==0)
+						return true;
+
+					const double scale = 1 + std::max(A.cwiseAbs().maxCoeff(), b.cwiseAbs().maxCoeff());
+					const double tol = 1e-9*scale;
+
+					// columns are z+, z-, surplus, artificial, then right hand side.
+					const auto num_cols = 2*n + 2*m;
+					Eigen::MatrixXd T = Eigen::MatrixXd::Zero(m+1, num_cols+1);
+					std::vector<long> basis(m);
+					Eigen::VectorXd sign(m);
+					for (long rr = 0; rr < m; ++rr)
+					{
+						sign(rr) = b(rr) < 0 ? -1 : 1;
+						T.row(rr).segment(0,n) = sign(rr)*A.row(rr);
+						T.row(rr).segment(n,n) = -sign(rr)*A.row(rr);
+						T(rr, 2*n + rr) = -sign(rr);
+						T(rr, 2*n + m + rr) = 1;
+						T(rr, num_cols) = sign(rr)*b(rr);
+						basis[rr] = 2*n + m + rr;
+					}
+
+					// minimize the sum of the artificial variables.
+					for (long rr = 0; rr < m; ++rr)
+						T.row(m) -= T.row(rr);
+					for (long rr = 0; rr < m; ++rr)
+						T(m, 2*n + m + rr) = 0;
+
+					const long max_iterations = 50*(m + num_cols);
+					for (long iteration = 0; iteration < max_iterations; ++iteration)
+					{
+						long enter = -1;
+						for (long jj = 0; jj < num_cols; ++jj)
+							if (T(m,jj) < -tol)
+							{
+								enter = jj;
+								break;
+							}
+						if (enter < 0)
+						{
+							if (-T(m, num_cols) <= 1e2*tol)
+								return true;
+
+							// the duals of the sign-adjusted rows are 1 less the reduced costs of the artificial variables
+							Eigen::VectorXd y(m);
+							for (long rr = 0; rr < m; ++rr)
+								y(rr) = sign(rr)*(1 - T(m, 2*n + m + rr));
+							return !CertifiesInfeasible(A, b, y, tol);
+						}
+
+						long leave = -1;
+						double best_ratio = 0;
+						for (long rr = 0; rr < m; ++rr)
+						{
+							if (T(rr,enter) <= tol)
+								continue;
+							double ratio = T(rr,num_cols)/T(rr,enter);
+							if (leave < 0 || ratio < best_ratio - tol || (ratio <= best_ratio + tol && basis[rr] < basis[leave]))
+							{
+								leave = rr;
+								best_ratio = ratio;
+							}
+						}
+						if (leave < 0) // can't happen for a phase one problem, but just in case
+							return true;
+
+						T.row(leave) /= T(leave,enter);
+						for (long rr = 0; rr <= m; ++rr)
+							if (rr!=leave && T(rr,enter)!=0)
+								T.row(rr) -= T(rr,enter)*T.row(leave);
+						basis[leave] = enter;
+					}
+
+					return true;
+				}
+
+
+
+				// depth-first enumeration of mixed cells.
+				class CellEnumerator
+				{
+				public:
+					CellEnumerator(std::vector<Support> const& supports, std::vector<Lifting> const& lifting) : supports_(supports), lifting_(lifting), n_(supports.size())
+					{
+						// an edge of a cell must at least be a lower edge of its own lifted support
+						candidates_.resize(n_);
+						for (unsigned ii = 0; ii < n_; ++ii)
+							for (unsigned p = 0; p < supports_[ii].size(); ++p)
+								for (unsigned q = p+1; q < supports_[ii].size(); ++q)
+									if (Compatible({ii}, {Edge(p,q)}))
+										candidates_[ii].emplace_back(p,q);
+					}
+
+					std::vector<Edge> const& Candidates(unsigned support_index) const
+					{
+						return candidates_[support_index];
+					}
+
+
+					// continue the search, with edges chosen for the first chosen.size() supports.
+					void Recurse(std::vector<Edge> & chosen, std::vector<std::pair<unsigned, Row> > const& echelon, std::vector<MixedCell> & cells, std::atomic<bool> & generic) const
+					{
+						auto ii = chosen.size();
+						if (ii==n_)
+						{
+							MixedCell cell;
+							if (MakeCell(chosen, cell, generic))
+								cells.push_back(cell);
+							return;
+						}
+
+						for (const auto& edge : candidates_[ii])
+						{
+							auto extended_echelon = echelon;
+							if (!AddIfIndependent(extended_echelon, Direction(ii, edge)))
+								continue;
+
+							chosen.push_back(edge);
+							std::vector<unsigned> which(chosen.size());
+							for (unsigned jj = 0; jj < which.size(); ++jj)
+								which[jj] = jj;
+
+							if (Compatible(which, chosen))
+								Recurse(chosen, extended_echelon, cells, generic);
+							chosen.pop_back();
+						}
+					}
+
+
+					// the direction of an edge, as a rational row
+					Row Direction(unsigned support_index, Edge const& edge) const
+					{
+						const auto& a = supports_[support_index];
+						Row row(n_);
+						for (unsigned jj = 0; jj < n_; ++jj)
+							row[jj] = a[edge.second][jj] - a[edge.first][jj];
+						return row;
+					}
+
+				private:
+
+					// whether some inner normal makes each of the edges a lower edge of the corresponding lifted support.
+					bool Compatible(std::vector<unsigned> const& which_supports, std::vector<Edge> const& edges) const
+					{
+						unsigned num_rows = 0;
+						for (auto ii : which_supports)
+							num_rows += supports_[ii].size() + 1;
+
+						Eigen::MatrixXd A(num_rows, n_);
+						Eigen::VectorXd b(num_rows);
+
+						unsigned row = 0;
+						for (unsigned kk = 0; kk < which_supports.size(); ++kk)
+						{
+							const auto& a = supports_[which_supports[kk]];
+							const auto& w = lifting_[which_supports[kk]];
+							auto p = edges[kk].first, q = edges[kk].second;
+
+							// <a - a_p, alpha> >= w_p - w_a, for every point.  for q, this is one half of the equality.
+							for (unsigned jj = 0; jj < a.size(); ++jj)
+							{
+								for (unsigned vv = 0; vv < n_; ++vv)
+									A(row,vv) = a[jj][vv] - a[p][vv];
+								b(row) = w[p] - w[jj];
+								++row;
+							}
+
+							// and the other half of the equality for q
+							for (unsigned vv = 0; vv < n_; ++vv)
+								A(row,vv) = a[p][vv] - a[q][vv];
+							b(row) = w[q] - w[p];
+							++row;
+						}
+
+						return IsFeasible(A, b);
+					}
+
+
+					// solve for the inner normal exactly, and verify.
+					bool MakeCell(std::vector<Edge> const& chosen, MixedCell & cell, std::atomic<bool> & generic) const
+					{
+						std::vector<Row> M(n_);
+						Row r(n_);
+						for (unsigned ii = 0; ii < n_; ++ii)
+						{
+							M[ii] = Direction(ii, chosen[ii]);
+							r[ii] = lifting_[ii][chosen[ii].first] - lifting_[ii][chosen[ii].second];
+						}
+
+						Row alpha;
+						mpq_rational det;
+						if (!SolveExact(M, r, alpha, det))
+							return false;
+
+						for (unsigned ii = 0; ii < n_; ++ii)
+						{
+							const auto& a = supports_[ii];
+							const auto& w = lifting_[ii];
+
+							auto value = [&](unsigned jj)
+							{
+								mpq_rational v = w[jj];
+								for (unsigned vv = 0; vv < n_; ++vv)
+									v += a[jj][vv]*alpha[vv];
+								return v;
+							};
+
+							mpq_rational minimum = value(chosen[ii].first);
+							for (unsigned jj = 0; jj < a.size(); ++jj)
+							{
+								if (jj==chosen[ii].first || jj==chosen[ii].second)
+									continue;
+
+								auto v = value(jj);
+								if (v < minimum)
+									return false;
+								if (v==minimum)
+								{
+									generic = false;
+									return false;
+								}
+							}
+						}
+
+						cell.edges = chosen;
+						cell.inner_normal = alpha;
+						// det is an integer, being the determinant of an integer matrix
+						mpq_rational abs_det = abs(det);
+						cell.volume = numerator(abs_det);
+						return true;
+					}
+
+
+					std::vector<Support> const& supports_;
+					std::vector<Lifting> const& lifting_;
+					unsigned n_;
+					std::vector<std::vector<Edge> > candidates_; ///< the lower edges of each lifted support.
+				};
+
+			} // re: anonymous namespace
+
+
+
+			std::vector<Lifting> RandomLifting(std::vector<Support> const& supports, int max_value)
+			{
+				auto& generator = ThreadRandomEngine();
+				boost::random::uniform_int_distribution<int> distribution(0, max_value-1);
+
+				std::vector<Lifting> lifting(supports.size());
+				for (unsigned ii = 0; ii < supports.size(); ++ii)
+				{
+					lifting[ii].resize(supports[ii].size());
+					for (auto& w : lifting[ii])
+						w = distribution(generator);
+				}
+				return lifting;
+			}
+
+
+
+			bool MixedCells(std::vector<Support> const& supports, std::vector<Lifting> const& lifting, std::vector<MixedCell> & cells, unsigned num_threads)
+			{
+				auto n = supports.size();
+				cells.clear();
+
+				if (lifting.size()!=n)
+					throw std::runtime_error("number of liftings must match number of supports, computing mixed cells");
+
+				for (unsigned ii = 0; ii < n; ++ii)
+				{
+					if (lifting[ii].size()!=supports[ii].size())
+						throw std::runtime_error("lifting must have one value per point of support, computing mixed cells");
+					for (const auto& a : supports[ii])
+						if (a.size()!=n)
+							throw std::runtime_error("number of supports must match number of variables, computing mixed cells");
+				}
+
+				if (n==0)
+					return true;
+
+				CellEnumerator enumerator(supports, lifting);
+				std::atomic<bool> generic(true);
+
+				if (num_threads==0)
+					num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+				// share out the edges of the first support between the threads
+				const auto& first_edges = enumerator.Candidates(0);
+				std::atomic<unsigned> next_edge(0);
+				std::vector<std::vector<MixedCell> > cells_per_thread(num_threads);
+
+				auto work = [&](unsigned thread_index)
+				{
+					unsigned edge_index;
+					while ((edge_index = next_edge++) < first_edges.size())
+					{
+						std::vector<std::pair<unsigned, Row> > echelon;
+						AddIfIndependent(echelon, enumerator.Direction(0, first_edges[edge_index]));
+
+						std::vector<Edge> chosen{first_edges[edge_index]};
+						enumerator.Recurse(chosen, echelon, cells_per_thread[thread_index], generic);
+					}
+				};
+
+				if (num_threads==1)
+					work(0);
+				else
+				{
+					std::vector<std::thread> threads;
+					for (unsigned ii = 0; ii < num_threads; ++ii)
+						threads.emplace_back(work, ii);
+					for (auto& t : threads)
+						t.join();
+				}
+
+				for (auto& c : cells_per_thread)
+					cells.insert(cells.end(), c.begin(), c.end());
+				std::sort(cells.begin(), cells.end(), [](MixedCell const& a, MixedCell const& b){return a.edges < b.edges;});
+
+				return generic;
+			}
+
+
+
+			std::vector<MixedCell> MixedCells(std::vector<Support> const& supports, std::vector<Lifting> & lifting, unsigned num_threads)
+			{
+				const unsigned max_num_tries = 10;
+
+				std::vector<MixedCell> cells;
+				int max_value = 32;
+				for (unsigned ii = 0; ii < max_num_tries; ++ii, max_value *= 2)
+				{
+					lifting = RandomLifting(supports, max_value);
+					if (MixedCells(supports, lifting, cells, num_threads))
+						return cells;
+				}
+
+				throw std::runtime_error("unable to find a generic lifting, computing mixed cells");
+			}
+
+
+
+			mpz_int MixedVolume(std::vector<MixedCell> const& cells)
+			{
+				mpz_int volume = 0;
+				for (const auto& c : cells)
+					volume += c.volume;
+				return volume;
+			}
+
+
+
+			mpz_int MixedVolume(std::vector<Support> const& supports, unsigned num_threads)
+			{
+				std::vector<Lifting> lifting;
+				return MixedVolume(MixedCells(supports, lifting, num_threads));
+			}
+
+
+
+			void LowerTriangularize(std::vector<std::vector<mpz_int> > const& V, std::vector<std::vector<mpz_int> > & L, std::vector<std::vector<mpz_int> > & W)
+			{
+				auto n = V.size();
+				L = V;
+				W.assign(n, std::vector<mpz_int>(n, 0));
+				for (unsigned ii = 0; ii < n; ++ii)
+					W[ii][ii] = 1;
+
+				auto swap_columns = [&](unsigned a, unsigned b)
+				{
+					for (unsigned ii = 0; ii < n; ++ii)
+					{
+						std::swap(L[ii][a], L[ii][b]);
+						std::swap(W[ii][a], W[ii][b]);
+					}
+				};
+
+				// Euclid's algorithm along each row, by column operations.  the rows above are already zero to the right of the diagonal, so stay that way.
+				for (unsigned rr = 0; rr < n; ++rr)
+				{
+					for (unsigned cc = rr+1; cc < n; ++cc)
+						while (L[rr][cc]!=0)
+						{
+							mpz_int q = L[rr][rr] / L[rr][cc];
+							for (unsigned ii = 0; ii < n; ++ii)
+							{
+								L[ii][rr] -= q*L[ii][cc];
+								W[ii][rr] -= q*W[ii][cc];
+							}
+							swap_columns(rr, cc);
+						}
+
+					if (L[rr][rr]==0)
+						throw std::runtime_error("singular matrix in LowerTriangularize");
+				}
+			}
+
+		} // re: namespace polyhedral
+	} // re: namespace start_system
+} // re: namespace bertini
+
@@ -0,0 +1,379 @@
+//This file is part of Bertini 2.
+//
+//start_system/polyhedral.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//start_system/polyhedral.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with start_system/polyhedral.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+#include "bertini2/start_system/polyhedral.hpp"
+#include "bertini2/tracking/tracker.hpp"
+
+#include <type_traits>
+
+
+BOOST_CLASS_EXPORT(bertini::start_system::Polyhedral);
+
+
+namespace bertini {
+
+	namespace start_system {
+
+		namespace {
+
+			// the monomial with given exponents, or nullptr for the constant monomial
+			std::shared_ptr<node::Node> Monomial(VariableGroup const& v, polyhedral::Exponent const& a)
+			{
+				std::shared_ptr<node::Node> m = nullptr;
+				for (unsigned jj = 0; jj < a.size(); ++jj)
+				{
+					if (a[jj]==0)
+						continue;
+
+					std::shared_ptr<node::Node> factor = v[jj];
+					if (a[jj]!=1)
+						factor = pow(factor, a[jj]);
+					m = m ? m*factor : factor;
+				}
+				return m;
+			}
+
+
+			// the kth of the |d| solutions of y^d = z
+			template<typename T>
+			T Root(T const& z, int d, int k)
+			{
+				using std::abs; using std::arg; using std::pow; using std::acos; using std::cos; using std::sin;
+				using RT = typename Eigen::NumTraits<T>::Real;
+
+				T w = d < 0 ? T(1)/z : z;
+				d = d < 0 ? -d : d;
+
+				RT pi = acos(RT(-1));
+				RT modulus = pow(RT(abs(w)), RT(1)/d);
+				RT angle = (RT(arg(w)) + 2*pi*k)/d;
+				return T(modulus*cos(angle), modulus*sin(angle));
+			}
+
+
+			inline
+			void SetPrecision(Vec<dbl> & v, unsigned prec)
+			{}
+
+			inline
+			void SetPrecision(Vec<mpfr> & v, unsigned prec)
+			{
+				for (unsigned ii = 0; ii < v.size(); ++ii)
+					v(ii).precision(prec);
+			}
+
+
+			// track from 1 to 0, then polish with Newton's method at 0
+			template<typename TrackerT, typename T>
+			Vec<T> TrackCellPath(System const& H, Vec<T> const& start)
+			{
+				using RT = typename Eigen::NumTraits<T>::Real;
+
+				TrackerT tracker(H);
+				tracking::config::Stepping<RT> stepping;
+				tracking::config::Newton newton;
+				tracker.Setup(tracking::config::Predictor::RK4,
+				              RT(1e-6),
+				              RT(1e8),
+				              stepping,
+				              newton);
+
+				Vec<T> result;
+				auto code = tracker.TrackPath(result, T(1), T(0), start);
+				if (code!=tracking::SuccessCode::Success)
+					throw std::runtime_error("failed to track path of polyhedral cell homotopy");
+
+				for (unsigned ii = 0; ii < 3; ++ii)
+				{
+					Vec<T> f = H.Eval(result, T(0));
+					Mat<T> J = H.Jacobian(result, T(0));
+					result -= J.lu().solve(f);
+				}
+				return result;
+			}
+		}
+
+
+
+		// constructor for Polyhedral start system, from any other *suitable* system.
+		Polyhedral::Polyhedral(System const& s, unsigned num_threads)
+		{
+			if (s.NumHomVariableGroups() > 0)
+				throw std::runtime_error("a homogeneous variable group is present.  currently unallowed");
+
+			if (s.NumTotalFunctions() != s.NumVariables())
+				throw std::runtime_error("attempting to construct polyhedral start system from non-square target system");
+
+			if (s.HavePathVariable())
+				throw std::runtime_error("attempting to construct polyhedral start system, but target system has path varible declared already");
+
+			if (s.NumVariableGroups() != 1)
+				throw std::runtime_error("more than one affine variable group.  currently unallowed");
+
+			if (!s.IsPolynomial())
+				throw std::runtime_error("attempting to construct polyhedral start system from non-polynomial target system");
+
+			CopyVariableStructure(s);
+
+			// by hypothesis, the system has a single variable group.
+			VariableGroup v = this->AffineVariableGroup(0);
+
+			// the origin is added to each support, so the mixed volume counts solutions in C^n, not just the torus.
+			for (unsigned ii = 0; ii < s.NumFunctions(); ++ii)
+			{
+				auto supp = s.Function(ii)->Support(v);
+				supp.insert(polyhedral::Exponent(v.size(), 0));
+				supports_.emplace_back(supp.begin(), supp.end());
+			}
+
+			cells_ = polyhedral::MixedCells(supports_, lifting_, num_threads);
+
+			mpz_int running_total = 0;
+			for (const auto& cell : cells_)
+			{
+				running_total += cell.volume;
+				cumulative_num_start_points_.push_back(running_total);
+
+				// the binomial system for the cell is x^(a_p - a_q) = -c_q/c_p, one equation per support.
+				std::vector<std::vector<mpz_int> > V(v.size(), std::vector<mpz_int>(v.size()));
+				for (unsigned ii = 0; ii < v.size(); ++ii)
+					for (unsigned jj = 0; jj < v.size(); ++jj)
+						V[ii][jj] = supports_[ii][cell.edges[ii].first][jj] - supports_[ii][cell.edges[ii].second][jj];
+
+				std::vector<std::vector<mpz_int> > L, W;
+				polyhedral::LowerTriangularize(V, L, W);
+				cell_lower_.push_back(L);
+				cell_transform_.push_back(W);
+			}
+
+			coefficients_.resize(s.NumFunctions());
+			for (unsigned ii = 0; ii < s.NumFunctions(); ++ii)
+			{
+				std::shared_ptr<node::Node> f = nullptr;
+				for (const auto& a : supports_[ii])
+				{
+					coefficients_[ii].push_back(std::make_shared<node::Rational>(node::Rational::Rand()));
+
+					auto m = Monomial(v, a);
+					std::shared_ptr<node::Node> term = m ? coefficients_[ii].back()*m : coefficients_[ii].back();
+					f = f ? f+term : term;
+				}
+				AddFunction(f);
+			}
+
+			path_variable_ = std::make_shared<node::Variable>("polyhedral_path_variable");
+			cell_homotopies_.resize(cells_.size());
+
+			if (s.IsHomogeneous())
+				Homogenize();
+
+			if (s.IsPatched())
+				CopyPatches(s);
+		}// polyhedral constructor
+
+
+
+		mpz_int Polyhedral::NumStartPoints() const
+		{
+			if (cumulative_num_start_points_.empty())
+				return 0;
+			return cumulative_num_start_points_.back();
+		}
+
+
+
+		std::shared_ptr<System> Polyhedral::MakeCellHomotopy(size_t cell_index) const
+		{
+			const auto& cell = cells_[cell_index];
+			const auto& alpha = cell.inner_normal;
+			auto n = supports_.size();
+
+			// the power of t on each monomial, after the change of variables x = y t^alpha.  zero on the cell's edges.
+			std::vector<std::vector<mpq_rational> > exponents(n);
+			mpq_rational min_positive = 0;
+			for (unsigned ii = 0; ii < n; ++ii)
+			{
+				auto lifted_value = [&](unsigned jj)
+				{
+					mpq_rational value = lifting_[ii][jj];
+					for (unsigned vv = 0; vv < n; ++vv)
+						value += supports_[ii][jj][vv]*alpha[vv];
+					return value;
+				};
+
+				mpq_rational minimum = lifted_value(cell.edges[ii].first);
+				for (unsigned jj = 0; jj < supports_[ii].size(); ++jj)
+				{
+					mpq_rational e = lifted_value(jj) - minimum;
+					exponents[ii].push_back(e);
+					if (e > 0 && (min_positive==0 || e < min_positive))
+						min_positive = e;
+				}
+			}
+
+			// reparametrizing t, so the smallest positive power is 1, keeps the homotopy differentiable at t=0.
+			auto H = std::make_shared<System>();
+			VariableGroup v = this->AffineVariableGroup(0);
+			H->AddVariableGroup(v);
+			H->AddPathVariable(path_variable_);
+
+			auto t = 1 - path_variable_;
+			for (unsigned ii = 0; ii < n; ++ii)
+			{
+				std::shared_ptr<node::Node> f = nullptr;
+				for (unsigned jj = 0; jj < supports_[ii].size(); ++jj)
+				{
+					auto m = Monomial(v, supports_[ii][jj]);
+					std::shared_ptr<node::Node> term = m ? coefficients_[ii][jj]*m : coefficients_[ii][jj];
+
+					if (exponents[ii][jj] > 0)
+					{
+						mpq_rational e = exponents[ii][jj]/min_positive;
+						if (denominator(e)==1)
+							term = term*pow(t, numerator(e).convert_to<int>());
+						else
+							term = term*pow(t, e);
+					}
+
+					f = f ? f+term : term;
+				}
+				H->AddFunction(f);
+			}
+
+			return H;
+		}
+
+
+
+		System const& Polyhedral::CellHomotopy(size_t cell_index) const
+		{
+			if (cell_index >= cells_.size())
+				throw std::out_of_range("in Polyhedral::CellHomotopy, cell index exceeds number of cells");
+
+			if (!cell_homotopies_[cell_index])
+				cell_homotopies_[cell_index] = MakeCellHomotopy(cell_index);
+			return *cell_homotopies_[cell_index];
+		}
+
+
+
+		template<typename T>
+		Vec<T> Polyhedral::BinomialStartPoint(mpz_int index, size_t & cell_index) const
+		{
+			if (index < 0 || index >= NumStartPoints())
+				throw std::out_of_range("in Polyhedral::BinomialStartPoint, index exceeds number of start points");
+
+			auto cell_iter = std::upper_bound(cumulative_num_start_points_.begin(), cumulative_num_start_points_.end(), index);
+			cell_index = cell_iter - cumulative_num_start_points_.begin();
+
+			mpz_int index_in_cell = index;
+			if (cell_index > 0)
+				index_in_cell -= cumulative_num_start_points_[cell_index-1];
+
+			const auto& cell = cells_[cell_index];
+			const auto& L = cell_lower_[cell_index];
+			const auto& W = cell_transform_[cell_index];
+			auto n = supports_.size();
+
+			std::vector<mpz_int> num_roots(n);
+			for (unsigned rr = 0; rr < n; ++rr)
+				num_roots[rr] = abs(L[rr][rr]);
+			auto root_indices = IndexToSubscript(index_in_cell, num_roots);
+
+			// solve the triangular system y^L = -c_q/c_p, one variable at a time
+			Vec<T> y(n);
+			for (unsigned rr = 0; rr < n; ++rr)
+			{
+				T rhs = -coefficients_[rr][cell.edges[rr].second]->Eval<T>() / coefficients_[rr][cell.edges[rr].first]->Eval<T>();
+				for (unsigned kk = 0; kk < rr; ++kk)
+					rhs /= pow(y(kk), L[rr][kk].convert_to<int>());
+				y(rr) = Root(rhs, L[rr][rr].convert_to<int>(), root_indices[rr].convert_to<int>());
+			}
+
+			// then undo the monomial change of variables
+			Vec<T> x(n);
+			for (unsigned jj = 0; jj < n; ++jj)
+			{
+				x(jj) = T(1);
+				for (unsigned kk = 0; kk < n; ++kk)
+					x(jj) *= pow(y(kk), W[jj][kk].convert_to<int>());
+			}
+			return x;
+		}
+
+		template Vec<dbl> Polyhedral::BinomialStartPoint<dbl>(mpz_int index, size_t & cell_index) const;
+		template Vec<mpfr> Polyhedral::BinomialStartPoint<mpfr>(mpz_int index, size_t & cell_index) const;
+
+
+
+		template<typename T>
+		Vec<T> Polyhedral::GenerateStartPointT(mpz_int index) const
+		{
+			using TrackerT = typename std::conditional<std::is_same<T,dbl>::value, tracking::DoublePrecisionTracker, tracking::AMPTracker>::type;
+
+			size_t cell_index;
+			auto binomial_solution = BinomialStartPoint<T>(index, cell_index);
+			const auto& H = CellHomotopy(cell_index);
+
+			auto prev_precision = DefaultPrecision();
+			auto natural_values = TrackCellPath<TrackerT>(H, binomial_solution);
+
+			// the AMPTracker may leave things in a higher precision
+			DefaultPrecision(prev_precision);
+			H.precision(prev_precision);
+			SetPrecision(natural_values, prev_precision);
+
+			Vec<T> start_point(NumVariables());
+			unsigned offset = 0;
+			if (NumHomVariables() > 0)
+			{
+				start_point(0) = T(1);
+				offset = 1;
+			}
+			for (unsigned ii = 0; ii < natural_values.size(); ++ii)
+				start_point(ii+offset) = natural_values(ii);
+
+			if (IsPatched())
+				RescalePointToFitPatchInPlace(start_point);
+
+			return start_point;
+		}
+
+
+
+		Vec<dbl> Polyhedral::GenerateStartPoint(dbl,mpz_int index) const
+		{
+			return GenerateStartPointT<dbl>(index);
+		}
+
+
+		Vec<mpfr> Polyhedral::GenerateStartPoint(mpfr,mpz_int index) const
+		{
+			return GenerateStartPointT<mpfr>(index);
+		}
+
+	} // re: namespace start_system
+} // re: namespace bertini
+
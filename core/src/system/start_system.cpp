@@ -23,9 +23,12 @@
 // daniel brake, university of notre dame
 
 #include "start_system.hpp"
+#include <functional>
 
 
 BOOST_CLASS_EXPORT(bertini::start_system::TotalDegree);
+BOOST_CLASS_EXPORT(bertini::start_system::MultiHomogeneous);
+BOOST_CLASS_EXPORT(bertini::start_system::LinearProduct);
 
 
 namespace bertini {
@@ -151,6 +154,521 @@ namespace bertini {
 			return start_point;
 		}
 
+		// constructor for MultiHomogeneous start system, from any other *suitable* system.
+		MultiHomogeneous::MultiHomogeneous(System const& s)
+		{
+			if (s.HavePathVariable())
+				throw std::runtime_error("attempting to construct multihomogeneous start system, but target system has path varible declared already");
+
+			if (s.NumUngroupedVariables() > 0)
+				throw std::runtime_error("attempting to construct multihomogeneous start system from target system with ungrouped variables");
+
+			if (!s.IsPolynomial())
+				throw std::runtime_error("attempting to construct multihomogeneous start system from non-polynomial target system");
+
+			unsigned affine_group_counter = 0, hom_group_counter = 0;
+			for (auto group_type : s.VariableGroupTypes())
+			{
+				if (group_type==VariableGroupType::Affine)
+				{
+					groups_.push_back(s.AffineVariableGroup(affine_group_counter++));
+					group_is_affine_.push_back(true);
+					group_dimensions_.push_back(groups_.back().size());
+				}
+				else if (group_type==VariableGroupType::Homogeneous)
+				{
+					groups_.push_back(s.HomVariableGroup(hom_group_counter++));
+					group_is_affine_.push_back(false);
+					group_dimensions_.push_back(groups_.back().size()-1);
+				}
+			}
+
+			unsigned total_dimension = 0;
+			for (auto d : group_dimensions_)
+				total_dimension += d;
+			if (s.NumFunctions() != total_dimension)
+				throw std::runtime_error("attempting to construct multihomogeneous start system from target system whose number of functions differs from the total dimension of its variable groups");
+
+			degree_matrix_.resize(s.NumFunctions(), std::vector<int>(groups_.size()));
+			for (unsigned jj = 0; jj < groups_.size(); ++jj)
+			{
+				auto degs = s.Degrees(groups_[jj]);
+				for (unsigned ii = 0; ii < s.NumFunctions(); ++ii)
+					degree_matrix_[ii][jj] = degs[ii];
+			}
+
+			CopyVariableStructure(s);
+
+			// make the random linear forms, and the start functions from them.
+			linear_form_offsets_.resize(s.NumFunctions(), std::vector<size_t>(groups_.size()));
+			for (unsigned ii = 0; ii < s.NumFunctions(); ++ii)
+			{
+				Nd start_function = nullptr;
+				for (unsigned jj = 0; jj < groups_.size(); ++jj)
+				{
+					linear_form_offsets_[ii][jj] = linear_form_coefficients_.size();
+					unsigned num_coefficients = groups_[jj].size() + (group_is_affine_[jj] ? 1 : 0);
+
+					for (int kk = 0; kk < degree_matrix_[ii][jj]; ++kk)
+					{
+						std::vector<std::shared_ptr<node::Rational> > coefficients(num_coefficients);
+						for (auto& c : coefficients)
+							c = std::make_shared<node::Rational>(node::Rational::Rand());
+						linear_form_coefficients_.push_back(coefficients);
+
+						auto form = LinearForm(jj, coefficients);
+						start_function = start_function ? start_function*form : form;
+					}
+				}
+
+				if (!start_function)
+					throw std::runtime_error("attempting to construct multihomogeneous start system from target system with a constant function");
+
+				AddFunction(start_function);
+			}
+
+			EnumerateGroupChoices();
+
+			if (s.IsHomogeneous())
+				Homogenize();
+
+			if (s.IsPatched())
+				CopyPatches(s);
+		}// multihomogeneous constructor
+
+
+
+		Nd MultiHomogeneous::LinearForm(unsigned group_index, std::vector<std::shared_ptr<node::Rational> > const& coefficients) const
+		{
+			const auto& vars = groups_[group_index];
+
+			Nd form = group_is_affine_[group_index] ? Nd(coefficients.back()) : coefficients[0]*vars[0];
+			for (unsigned vv = group_is_affine_[group_index] ? 0 : 1; vv < vars.size(); ++vv)
+				form = form + coefficients[vv]*vars[vv];
+			return form;
+		}
+
+
+
+		void MultiHomogeneous::EnumerateGroupChoices()
+		{
+			auto num_functions = degree_matrix_.size();
+
+			group_choices_.clear();
+			cumulative_num_start_points_.clear();
+
+			// depth-first through the functions, assigning each to a group with room left and nonzero degree.
+			std::vector<unsigned> choice(num_functions);
+			std::vector<unsigned> room_left(group_dimensions_);
+			mpz_int running_total = 0;
+
+			std::function<void(unsigned, mpz_int const&)> recurse = [&](unsigned ii, mpz_int const& num_points)
+			{
+				if (ii==num_functions)
+				{
+					running_total += num_points;
+					group_choices_.push_back(choice);
+					cumulative_num_start_points_.push_back(running_total);
+					return;
+				}
+
+				for (unsigned jj = 0; jj < groups_.size(); ++jj)
+				{
+					if (room_left[jj]==0 || degree_matrix_[ii][jj]<=0)
+						continue;
+
+					choice[ii] = jj;
+					--room_left[jj];
+					recurse(ii+1, num_points*degree_matrix_[ii][jj]);
+					++room_left[jj];
+				}
+			};
+
+			recurse(0, mpz_int(1));
+		}
+
+
+
+		mpz_int MultiHomogeneous::NumStartPoints() const
+		{
+			if (cumulative_num_start_points_.empty())
+				return 0;
+			return cumulative_num_start_points_.back();
+		}
+
+
+
+		template<typename T>
+		Vec<T> MultiHomogeneous::GenerateStartPointT(mpz_int index) const
+		{
+			if (index < 0 || index >= NumStartPoints())
+				throw std::out_of_range("in MultiHomogeneous::GenerateStartPoint, index exceeds number of start points");
+
+			// find the choice of groups in whose block the index falls
+			auto choice_iter = std::upper_bound(cumulative_num_start_points_.begin(), cumulative_num_start_points_.end(), index);
+			auto choice_index = choice_iter - cumulative_num_start_points_.begin();
+			const auto& choice = group_choices_[choice_index];
+
+			mpz_int index_in_block = index;
+			if (choice_index > 0)
+				index_in_block -= cumulative_num_start_points_[choice_index-1];
+
+			// then which linear form for each function
+			std::vector<mpz_int> chosen_degrees(choice.size());
+			for (unsigned ii = 0; ii < choice.size(); ++ii)
+				chosen_degrees[ii] = degree_matrix_[ii][choice[ii]];
+			auto form_indices = IndexToSubscript(index_in_block, chosen_degrees);
+
+			bool is_homogenized = NumHomVariables() > 0;
+
+			Vec<T> start_point(NumVariables());
+			unsigned point_index = 0;
+			for (unsigned jj = 0; jj < groups_.size(); ++jj)
+			{
+				auto num_vars = groups_[jj].size();
+				Mat<T> A(num_vars, num_vars);
+				Vec<T> b(num_vars);
+
+				unsigned row = 0;
+				for (unsigned ii = 0; ii < choice.size(); ++ii)
+				{
+					if (choice[ii]!=jj)
+						continue;
+
+					const auto& coefficients = linear_form_coefficients_[linear_form_offsets_[ii][jj] + form_indices[ii].convert_to<size_t>()];
+					for (unsigned vv = 0; vv < num_vars; ++vv)
+						A(row,vv) = coefficients[vv]->Eval<T>();
+					b(row) = group_is_affine_[jj] ? T(-coefficients.back()->Eval<T>()) : T(0);
+					++row;
+				}
+
+				// a homogeneous group is fixed only up to scale.  pick a representative.
+				if (!group_is_affine_[jj])
+				{
+					for (unsigned vv = 0; vv < num_vars; ++vv)
+						A(row,vv) = T(1);
+					b(row) = T(1);
+				}
+
+				Vec<T> group_values = A.lu().solve(b);
+
+				if (group_is_affine_[jj] && is_homogenized)
+					start_point(point_index++) = T(1);
+				for (unsigned vv = 0; vv < num_vars; ++vv)
+					start_point(point_index++) = group_values(vv);
+			}
+
+			if (IsPatched())
+				RescalePointToFitPatchInPlace(start_point);
+
+			return start_point;
+		}
+
+
+
+		Vec<dbl> MultiHomogeneous::GenerateStartPoint(dbl,mpz_int index) const
+		{
+			return GenerateStartPointT<dbl>(index);
+		}
+
+
+		Vec<mpfr> MultiHomogeneous::GenerateStartPoint(mpfr,mpz_int index) const
+		{
+			return GenerateStartPointT<mpfr>(index);
+		}
+
+
+		// constructor for LinearProduct start system, from any other *suitable* system.
+		LinearProduct::LinearProduct(System const& s)
+		{
+			CheckAndCopyStructure(s);
+
+			// by default, a function whose degree is the sum of its degrees in the individual variables gets one part per variable.  this uses no more linear forms than one part would, and the forms have smaller supports, so the root count can only go down.  other functions get one part, the variables appearing in them.
+			VariableGroup v = this->AffineVariableGroup(0);
+			std::vector<std::vector<VariableGroup> > partitions(s.NumFunctions());
+			for (unsigned ii = 0; ii < s.NumFunctions(); ++ii)
+			{
+				auto f = s.Function(ii);
+
+				VariableGroup appearing;
+				int sum_of_degrees = 0;
+				for (const auto& var : v)
+				{
+					auto d = f->Degree(var);
+					if (d > 0)
+					{
+						appearing.push_back(var);
+						sum_of_degrees += d;
+					}
+				}
+
+				if (sum_of_degrees == f->Degree(v))
+					for (const auto& var : appearing)
+						partitions[ii].push_back(VariableGroup{var});
+				else
+					partitions[ii].push_back(appearing);
+			}
+
+			Construct(s, partitions);
+		}
+
+
+
+		LinearProduct::LinearProduct(System const& s, std::vector<std::vector<VariableGroup> > const& partitions)
+		{
+			CheckAndCopyStructure(s);
+			Construct(s, partitions);
+		}
+
+
+
+		void LinearProduct::CheckAndCopyStructure(System const& s)
+		{
+			if (s.NumHomVariableGroups() > 0)
+				throw std::runtime_error("a homogeneous variable group is present.  currently unallowed");
+
+			if (s.NumTotalFunctions() != s.NumVariables())
+				throw std::runtime_error("attempting to construct linear product start system from non-square target system");
+
+			if (s.HavePathVariable())
+				throw std::runtime_error("attempting to construct linear product start system, but target system has path varible declared already");
+
+			if (s.NumVariableGroups() != 1)
+				throw std::runtime_error("more than one affine variable group.  currently unallowed");
+
+			if (!s.IsPolynomial())
+				throw std::runtime_error("attempting to construct linear product start system from non-polynomial target system");
+
+			CopyVariableStructure(s);
+		}
+
+
+
+		void LinearProduct::Construct(System const& s, std::vector<std::vector<VariableGroup> > const& partitions)
+		{
+			if (partitions.size() != s.NumFunctions())
+				throw std::runtime_error("attempting to construct linear product start system with number of partitions differing from number of functions");
+
+			// by hypothesis, the system has a single variable group.
+			VariableGroup v = this->AffineVariableGroup(0);
+
+			part_variable_indices_.resize(s.NumFunctions());
+			part_degrees_.resize(s.NumFunctions());
+			linear_form_offsets_.resize(s.NumFunctions());
+
+			for (unsigned ii = 0; ii < s.NumFunctions(); ++ii)
+			{
+				auto f = s.Function(ii);
+				std::vector<bool> in_some_part(v.size(), false);
+
+				for (const auto& part : partitions[ii])
+				{
+					std::vector<unsigned> indices;
+					for (const auto& var : part)
+					{
+						auto location = std::find(v.begin(), v.end(), var);
+						if (location==v.end())
+							throw std::runtime_error("attempting to construct linear product start system with partition containing a variable not in the target system");
+
+						auto index = location - v.begin();
+						if (in_some_part[index])
+							throw std::runtime_error("attempting to construct linear product start system with overlapping parts in a partition");
+						in_some_part[index] = true;
+						indices.push_back(index);
+					}
+
+					part_variable_indices_[ii].push_back(indices);
+					part_degrees_[ii].push_back(part.empty() ? 0 : f->Degree(part));
+				}
+
+				for (unsigned jj = 0; jj < v.size(); ++jj)
+					if (!in_some_part[jj] && f->Degree(v[jj]) > 0)
+						throw std::runtime_error("attempting to construct linear product start system with partition missing a variable appearing in its function");
+
+				// make the product of linear forms for this function
+				Nd start_function = nullptr;
+				for (unsigned kk = 0; kk < part_degrees_[ii].size(); ++kk)
+				{
+					linear_form_offsets_[ii].push_back(linear_form_coefficients_.size());
+					const auto& indices = part_variable_indices_[ii][kk];
+
+					for (int dd = 0; dd < part_degrees_[ii][kk]; ++dd)
+					{
+						std::vector<std::shared_ptr<node::Rational> > coefficients(indices.size()+1);
+						for (auto& c : coefficients)
+							c = std::make_shared<node::Rational>(node::Rational::Rand());
+						linear_form_coefficients_.push_back(coefficients);
+
+						Nd form = coefficients.back();
+						for (unsigned vv = 0; vv < indices.size(); ++vv)
+							form = form + coefficients[vv]*v[indices[vv]];
+						start_function = start_function ? start_function*form : form;
+					}
+				}
+
+				if (!start_function)
+					throw std::runtime_error("attempting to construct linear product start system from target system with a constant function");
+
+				AddFunction(start_function);
+			}
+
+			EnumeratePartChoices();
+
+			if (s.IsHomogeneous())
+				Homogenize();
+
+			if (s.IsPatched())
+				CopyPatches(s);
+		}
+
+
+
+		bool LinearProduct::HaveMatching(std::vector<unsigned> const& choice, unsigned num_functions) const
+		{
+			// augmenting paths, one function at a time.  the systems are small, so this is plenty fast.
+			std::vector<int> function_matched_to_variable(NumNaturalVariables(), -1);
+
+			std::function<bool(unsigned, std::vector<bool>&)> augment = [&](unsigned ii, std::vector<bool>& visited)
+			{
+				for (auto jj : part_variable_indices_[ii][choice[ii]])
+				{
+					if (visited[jj])
+						continue;
+					visited[jj] = true;
+
+					if (function_matched_to_variable[jj] < 0 || augment(function_matched_to_variable[jj], visited))
+					{
+						function_matched_to_variable[jj] = ii;
+						return true;
+					}
+				}
+				return false;
+			};
+
+			for (unsigned ii = 0; ii < num_functions; ++ii)
+			{
+				std::vector<bool> visited(NumNaturalVariables(), false);
+				if (!augment(ii, visited))
+					return false;
+			}
+			return true;
+		}
+
+
+
+		void LinearProduct::EnumeratePartChoices()
+		{
+			auto num_functions = part_degrees_.size();
+
+			part_choices_.clear();
+			cumulative_num_start_points_.clear();
+
+			// depth-first through the functions, pruning as soon as the functions so far cannot be matched to variables.
+			std::vector<unsigned> choice(num_functions);
+			mpz_int running_total = 0;
+
+			std::function<void(unsigned, mpz_int const&)> recurse = [&](unsigned ii, mpz_int const& num_points)
+			{
+				if (ii==num_functions)
+				{
+					running_total += num_points;
+					part_choices_.push_back(choice);
+					cumulative_num_start_points_.push_back(running_total);
+					return;
+				}
+
+				for (unsigned kk = 0; kk < part_degrees_[ii].size(); ++kk)
+				{
+					if (part_degrees_[ii][kk]<=0)
+						continue;
+
+					choice[ii] = kk;
+					if (HaveMatching(choice, ii+1))
+						recurse(ii+1, num_points*part_degrees_[ii][kk]);
+				}
+			};
+
+			recurse(0, mpz_int(1));
+		}
+
+
+
+		mpz_int LinearProduct::NumStartPoints() const
+		{
+			if (cumulative_num_start_points_.empty())
+				return 0;
+			return cumulative_num_start_points_.back();
+		}
+
+
+
+		template<typename T>
+		Vec<T> LinearProduct::GenerateStartPointT(mpz_int index) const
+		{
+			if (index < 0 || index >= NumStartPoints())
+				throw std::out_of_range("in LinearProduct::GenerateStartPoint, index exceeds number of start points");
+
+			// find the choice of parts in whose block the index falls
+			auto choice_iter = std::upper_bound(cumulative_num_start_points_.begin(), cumulative_num_start_points_.end(), index);
+			auto choice_index = choice_iter - cumulative_num_start_points_.begin();
+			const auto& choice = part_choices_[choice_index];
+
+			mpz_int index_in_block = index;
+			if (choice_index > 0)
+				index_in_block -= cumulative_num_start_points_[choice_index-1];
+
+			// then which linear form for each function
+			std::vector<mpz_int> chosen_degrees(choice.size());
+			for (unsigned ii = 0; ii < choice.size(); ++ii)
+				chosen_degrees[ii] = part_degrees_[ii][choice[ii]];
+			auto form_indices = IndexToSubscript(index_in_block, chosen_degrees);
+
+			auto num_vars = NumNaturalVariables();
+			Mat<T> A = Mat<T>::Zero(num_vars, num_vars);
+			Vec<T> b(num_vars);
+
+			for (unsigned ii = 0; ii < choice.size(); ++ii)
+			{
+				const auto& indices = part_variable_indices_[ii][choice[ii]];
+				const auto& coefficients = linear_form_coefficients_[linear_form_offsets_[ii][choice[ii]] + form_indices[ii].convert_to<size_t>()];
+				for (unsigned vv = 0; vv < indices.size(); ++vv)
+					A(ii,indices[vv]) = coefficients[vv]->Eval<T>();
+				b(ii) = -coefficients.back()->Eval<T>();
+			}
+
+			Vec<T> natural_values = A.lu().solve(b);
+
+			Vec<T> start_point(NumVariables());
+			unsigned offset = 0;
+			if (NumHomVariables() > 0)
+			{
+				start_point(0) = T(1);
+				offset = 1;
+			}
+			for (unsigned ii = 0; ii < num_vars; ++ii)
+				start_point(ii+offset) = natural_values(ii);
+
+			if (IsPatched())
+				RescalePointToFitPatchInPlace(start_point);
+
+			return start_point;
+		}
+
+
+
+		Vec<dbl> LinearProduct::GenerateStartPoint(dbl,mpz_int index) const
+		{
+			return GenerateStartPointT<dbl>(index);
+		}
+
+
+		Vec<mpfr> LinearProduct::GenerateStartPoint(mpfr,mpz_int index) const
+		{
+			return GenerateStartPointT<mpfr>(index);
+		}
+
+
+
 		inline
 		TotalDegree operator*(TotalDegree td, std::shared_ptr<node::Node> const& n)
 		{
@@ -25,6 +25,11 @@
 
 #include "system.hpp"
 
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 template<typename NumType> using Vec = bertini::Vec<NumType>;
 template<typename NumType> using Mat = bertini::Mat<NumType>;
 
@@ -61,10 +66,14 @@ namespace bertini
 
 		swap(a.is_differentiated_,b.is_differentiated_);
 		swap(a.jacobian_,b.jacobian_);
+		swap(a.lazy_differentiation_,b.lazy_differentiation_);
 
 		swap(a.precision_,b.precision_);
 		swap(a.is_patched_,b.is_patched_);
 		swap(a.patch_,b.patch_);
+
+		swap(a.slices_,b.slices_);
+		swap(a.slice_variable_indices_,b.slice_variable_indices_);
 	}
 
 	// the copy constructor
@@ -81,8 +90,12 @@ namespace bertini
 		patch_ = other.patch_;
 		is_patched_ = other.is_patched_;
 
+		slices_ = other.slices_;
+		slice_variable_indices_ = other.slice_variable_indices_;
+
 		jacobian_ = other.jacobian_;
 		is_differentiated_ = other.is_differentiated_;
+		lazy_differentiation_ = other.lazy_differentiation_;
 
 
 		time_order_of_variable_groups_ = other.time_order_of_variable_groups_;
@@ -112,6 +125,67 @@ namespace bertini
 			explicit_parameters_[ii] = std::make_shared<bertini::node::Function>(other.explicit_parameters_[ii]->entry_node());
 	}
 
+	System System::Clone() const
+	{
+		System copy;
+		node::NodeCloneMap already_cloned;
+
+		auto clone = [&already_cloned](auto const& n)
+		{
+			using NodeT = typename std::decay_t<decltype(n)>::element_type;
+			if (!n) // not yet differentiated, with lazy differentiation
+				return std::shared_ptr<NodeT>();
+			return std::dynamic_pointer_cast<NodeT>(n->Clone(already_cloned));
+		};
+
+		auto clone_all = [&clone](auto const& nodes)
+		{
+			std::decay_t<decltype(nodes)> copies;
+			for (const auto& n : nodes)
+				copies.push_back(clone(n));
+			return copies;
+		};
+
+		copy.ungrouped_variables_ = clone_all(ungrouped_variables_);
+		for (const auto& g : variable_groups_)
+			copy.variable_groups_.push_back(clone_all(g));
+		for (const auto& g : hom_variable_groups_)
+			copy.hom_variable_groups_.push_back(clone_all(g));
+		copy.homogenizing_variables_ = clone_all(homogenizing_variables_);
+		copy.time_order_of_variable_groups_ = time_order_of_variable_groups_;
+
+		copy.have_path_variable_ = have_path_variable_;
+		if (path_variable_)
+			copy.path_variable_ = clone(path_variable_);
+
+		copy.implicit_parameters_ = clone_all(implicit_parameters_);
+		copy.explicit_parameters_ = clone_all(explicit_parameters_);
+
+		copy.constant_subfunctions_ = clone_all(constant_subfunctions_);
+		copy.subfunctions_ = clone_all(subfunctions_);
+		copy.functions_ = clone_all(functions_);
+
+		copy.jacobian_ = clone_all(jacobian_);
+		copy.is_differentiated_ = is_differentiated_;
+		copy.lazy_differentiation_ = lazy_differentiation_;
+
+		copy.patch_ = patch_;
+		copy.is_patched_ = is_patched_;
+
+		copy.slices_ = slices_;
+		for (auto& s : copy.slices_)
+			s.Variables(clone_all(s.Variables()));
+		copy.slice_variable_indices_ = slice_variable_indices_;
+
+		copy.variable_ordering_ = clone_all(variable_ordering_);
+		copy.have_ordering_ = have_ordering_;
+		copy.current_variable_values_ = current_variable_values_;
+
+		copy.precision_ = precision_;
+
+		return copy;
+	}
+
 	// the assignment operator
 	System& System::operator=(System other)
 	{
@@ -194,9 +268,18 @@ namespace bertini
 	}
 
 
+	size_t System::NumSliceFunctions() const
+	{
+		size_t num_slice_functions(0);
+		for (const auto& s : slices_)
+			num_slice_functions += s.Dimension();
+		return num_slice_functions;
+	}
+
+
 	size_t System::NumTotalFunctions() const
 	{
-		return NumFunctions() + NumPatches();
+		return NumFunctions() + NumSliceFunctions() + NumPatches();
 	}
 
 
@@ -225,7 +308,8 @@ namespace bertini
 
 		if (is_differentiated_)
 			for (const auto& iter : jacobian_)
-				iter->precision(new_precision);
+				if (iter)
+					iter->precision(new_precision);
 
 		if (have_path_variable_)
 			path_variable_->precision(new_precision);
@@ -251,20 +335,75 @@ namespace bertini
 		if (IsPatched())
 			patch_.Precision(new_precision);
 
+		for (const auto& iter : slices_)
+			iter.Precision(new_precision);
+
 		precision_ = new_precision;
 	}
 
 
+	System::Jac System::DifferentiateFunction(unsigned index) const
+	{
+		auto jac = std::make_shared<bertini::node::Jacobian>(functions_[index]->Differentiate());
+		jac->name("d" + functions_[index]->name());
+		return jac;
+	}
+
 	void System::Differentiate() const
 	{
-			jacobian_.resize(NumFunctions());
-			auto num_functions = NumFunctions();
-			for (int ii = 0; ii < num_functions; ++ii)
-				jacobian_[ii] = std::make_shared<bertini::node::Jacobian>(functions_[ii]->Differentiate());
+			jacobian_.assign(NumFunctions(), nullptr);
+			if (!lazy_differentiation_)
+			{
+				auto num_functions = NumFunctions();
+				for (int ii = 0; ii < num_functions; ++ii)
+					jacobian_[ii] = DifferentiateFunction(ii);
+			}
 
 			is_differentiated_ = true;
 		}
 
+	void System::Differentiate(unsigned num_threads) const
+	{
+		if (num_threads==0)
+			throw std::runtime_error("must use at least one thread to differentiate a system");
+
+		jacobian_.assign(NumFunctions(), nullptr);
+
+		std::atomic<size_t> next(0);
+		std::mutex failure_mutex;
+		std::exception_ptr failure;
+
+		auto worker = [this, &next, &failure_mutex, &failure]()
+		{
+			try
+			{
+				for (auto ii = next++; ii < jacobian_.size(); ii = next++)
+					jacobian_[ii] = DifferentiateFunction(ii);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(failure_mutex);
+				failure = std::current_exception();
+			}
+		};
+
+		if (num_threads==1)
+			worker();
+		else
+		{
+			std::vector<std::thread> workers;
+			for (unsigned ii = 0; ii < num_threads; ++ii)
+				workers.emplace_back(worker);
+			for (auto& w : workers)
+				w.join();
+		}
+
+		if (failure)
+			std::rethrow_exception(failure);
+
+		is_differentiated_ = true;
+	}
+
 
 
 
@@ -663,6 +802,7 @@ namespace bertini
 	{
 		variable_ordering_ = VariableOrdering();
 		have_ordering_ = true;
+		slice_variable_indices_.clear();
 	}
 
 
@@ -693,6 +833,7 @@ namespace bertini
 
 		variable_ordering_ = other.variable_ordering_; 
 		have_ordering_ = other.have_ordering_;
+		slice_variable_indices_.clear();
 	}
 
 
@@ -746,6 +887,62 @@ namespace bertini
 	}
 
 
+
+
+
+	/////////////////
+	//
+	// Slicing functions
+	//
+	///////////////////
+
+
+
+	void System::AddSlice(LinearSlice const& s)
+	{
+		slices_.push_back(s);
+		slices_.back().Precision(precision_);
+		slice_variable_indices_.clear();
+	}
+
+
+
+	void System::ClearSlices()
+	{
+		slices_.clear();
+		slice_variable_indices_.clear();
+	}
+
+
+
+	std::vector<unsigned> const& System::SliceVariableIndices(unsigned slice_index) const
+	{
+		const auto& vars = Variables(); // constructs the ordering if needed, which clears the indices
+
+		if (slice_variable_indices_.size()!=slices_.size())
+		{
+			slice_variable_indices_.resize(slices_.size());
+			for (unsigned ii = 0; ii < slices_.size(); ++ii)
+			{
+				auto& indices = slice_variable_indices_[ii];
+				indices.clear();
+				for (const auto& v : slices_[ii].Variables())
+				{
+					auto location = std::find(vars.begin(), vars.end(), v);
+					if (location==vars.end())
+					{
+						slice_variable_indices_.clear();
+						throw std::runtime_error("slice on variable " + v->name() + ", which is not a variable of the system");
+					}
+					indices.push_back(location - vars.begin());
+				}
+			}
+		}
+
+		return slice_variable_indices_[slice_index];
+	}
+
+
 			
 
     //////////////////////
@@ -965,7 +1162,10 @@ namespace bertini
 		{
 			out << "system is differentiated; jacobian:\n";
 			for (const auto& iter : s.jacobian_) {
-				out << (iter)->name() << " = " << *iter << "\n";
+				if (iter)
+					out << (iter)->name() << " = " << *iter << "\n";
+				else
+					out << "(to be differentiated when first used)\n";
 			}
 			out << "\n";
 		}
@@ -981,6 +1181,9 @@ namespace bertini
 			out << "system not patched\n";
 		}
 
+		for (const auto& iter : s.slices_)
+			out << iter << "\n";
+
 		return out;
 	}
 
@@ -1026,6 +1229,17 @@ namespace bertini
 			if (this->patch_ != rhs.patch_)
 				throw std::runtime_error("System+=System cannot combine two patched systems whose patches differ.");
 
+		//
+		//  deal with the slices, which are kept unless both systems have them
+		//
+		if (rhs.IsSliced())
+		{
+			if (this->IsSliced())
+				throw std::runtime_error("System+=System cannot combine two sliced systems.");
+			for (const auto& s : rhs.slices_)
+				AddSlice(s);
+		}
+
 		for (auto iter=functions_.begin(); iter!=functions_.end(); iter++)
 			(*iter)->SetRoot( (*(rhs.functions_.begin()+(iter-functions_.begin())))->entry_node() + (*iter)->entry_node());
 
@@ -1081,6 +1295,9 @@ namespace bertini
 		for (unsigned ii(0); ii<sys2.NumFunctions(); ++ii)
 			sys1.AddFunction(sys2.Function(ii));
 
+		for (const auto& s : sys2.Slices())
+			sys1.AddSlice(s);
+
 		return sys1;
 	}
 
@@ -27,6 +27,7 @@
 #include "bertini2/num_traits.hpp"
 #include <boost/test/unit_test.hpp>
 #include <fstream>
+#include <thread>
 
 using mpfr_float = bertini::mpfr_float;
 #include "eigen_extensions.hpp"
@@ -790,3 +791,68 @@ BOOST_AUTO_TEST_CASE(mpfr_float_serialization2)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+
+
+BOOST_AUTO_TEST_SUITE(default_precision)
+
+BOOST_AUTO_TEST_CASE(scoped_default_precision_restores)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	{
+		bertini::ScopedDefaultPrecision higher(100);
+		BOOST_CHECK_EQUAL(DefaultPrecision(), 100);
+
+		bertini::complex z(1,2);
+		BOOST_CHECK_EQUAL(z.precision(), 100);
+		BOOST_CHECK_EQUAL(z.real().precision(), 100);
+		BOOST_CHECK_EQUAL(z.imag().precision(), 100);
+	}
+	BOOST_CHECK_EQUAL(DefaultPrecision(), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+BOOST_AUTO_TEST_CASE(threads_compute_at_the_shared_default_precision)
+{
+	// the default precision is process-wide, so concurrent threads must all work at it
+	DefaultPrecision(100);
+
+	const unsigned num_threads = 4;
+	std::vector<bertini::complex> expected(num_threads), computed(num_threads);
+	for (unsigned ii = 0; ii < num_threads; ++ii)
+	{
+		expected[ii] = bertini::complex(std::to_string(ii+1),"0.1") / bertini::complex("0.3",std::to_string(ii+2));
+		expected[ii] *= expected[ii];
+	}
+
+	std::vector<unsigned> precision_in_thread(num_threads);
+	std::vector<std::thread> threads;
+	for (unsigned ii = 0; ii < num_threads; ++ii)
+		threads.emplace_back([&, ii]{
+			for (unsigned jj = 0; jj < 100; ++jj)
+			{
+				bertini::complex z = bertini::complex(std::to_string(ii+1),"0.1") / bertini::complex("0.3",std::to_string(ii+2));
+				z *= z;
+				computed[ii] = z;
+			}
+			precision_in_thread[ii] = computed[ii].precision();
+		});
+	for (auto& t : threads)
+		t.join();
+
+	for (unsigned ii = 0; ii < num_threads; ++ii)
+	{
+		BOOST_CHECK_EQUAL(precision_in_thread[ii], 100);
+		BOOST_CHECK(computed[ii] == expected[ii]);
+	}
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 100);
+
+	// and a change made on one thread is seen by the others
+	std::thread t([]{DefaultPrecision(50);});
+	t.join();
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 50);
+	BOOST_CHECK_EQUAL(bertini::complex().precision(), 50);
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
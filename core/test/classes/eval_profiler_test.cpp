@@ -0,0 +1,151 @@
+//This file is part of Bertini 2.
+//
+//eval_profiler_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//eval_profiler_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with eval_profiler_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file eval_profiler_test.cpp Unit testing for the per-node evaluation profiler.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <sstream>
+
+#include "bertini2/system.hpp"
+#include "bertini2/function_tree/eval_profiler.hpp"
+
+using System = bertini::System;
+using Var = std::shared_ptr<bertini::node::Variable>;
+using Variable = bertini::node::Variable;
+using Function = bertini::node::Function;
+
+using dbl = bertini::dbl;
+using mpfr = bertini::mpfr;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::node::EvalProfile;
+using bertini::node::ScopedEvalProfiling;
+
+BOOST_AUTO_TEST_SUITE(eval_profiler)
+
+
+BOOST_AUTO_TEST_CASE(profiles_functions_and_jacobian_entries)
+{
+	if (!bertini::telemetry::Enabled())
+		return;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	auto f = std::make_shared<Function>("f");
+	f->SetRoot(sin(x)*y);
+	auto g = std::make_shared<Function>("g");
+	g->SetRoot(x+y);
+
+	System sys;
+	sys.AddUngroupedVariable(x);
+	sys.AddUngroupedVariable(y);
+	sys.AddFunction(f);
+	sys.AddFunction(g);
+
+	Vec<dbl> v(2); v << dbl(0.5), dbl(1.5);
+	Vec<mpfr> v_mp(2); v_mp << mpfr("0.5"), mpfr("1.5");
+
+	EvalProfile profile;
+	BOOST_CHECK(profile.Empty());
+	{
+		ScopedEvalProfiling profiling(profile);
+		sys.Eval(v);
+		sys.Eval(v);
+		sys.Eval(v_mp);
+		sys.Jacobian(v);
+	}
+
+	auto roots = profile.Roots();
+	std::map<std::string, EvalProfile::Entry> by_name;
+	for (const auto& r : roots)
+		by_name[r.expression] = r;
+
+	BOOST_REQUIRE(by_name.count("f"));
+	BOOST_CHECK_EQUAL(by_name["f"].calls_double, 2);
+	BOOST_CHECK_EQUAL(by_name["f"].calls_multiple, 1);
+	BOOST_CHECK(by_name["f"].Seconds() >= by_name["f"].self_seconds);
+
+	BOOST_REQUIRE(by_name.count("g"));
+	BOOST_CHECK_EQUAL(by_name["g"].Calls(), 3);
+
+	BOOST_CHECK(by_name.count("df/dx"));
+	BOOST_CHECK(by_name.count("df/dy"));
+	BOOST_CHECK(by_name.count("dg/dx"));
+	BOOST_CHECK(by_name.count("dg/dy"));
+	BOOST_CHECK_EQUAL(by_name["df/dx"].Calls(), 1);
+
+	std::stringstream sin_printed;
+	sin_printed << *sin(x);
+	bool found_sin = false;
+	for (const auto& n : profile.Nodes())
+		if (n.expression==sin_printed.str())
+		{
+			found_sin = true;
+			BOOST_CHECK(n.Calls() >= 3);
+		}
+	BOOST_CHECK(found_sin);
+
+	std::stringstream folded;
+	profile.WriteFoldedStacks(folded);
+	std::string line;
+	unsigned num_lines = 0;
+	while (std::getline(folded, line))
+	{
+		++num_lines;
+		auto space = line.rfind(' ');
+		BOOST_REQUIRE(space!=std::string::npos);
+		BOOST_CHECK(std::stoull(line.substr(space+1)) > 0);
+	}
+	BOOST_CHECK(num_lines > 0);
+
+	profile.Clear();
+	BOOST_CHECK(profile.Empty());
+}
+
+
+BOOST_AUTO_TEST_CASE(nothing_recorded_outside_scope)
+{
+	Var x = std::make_shared<Variable>("x");
+	System sys;
+	sys.AddUngroupedVariable(x);
+	sys.AddFunction(x*x);
+
+	Vec<dbl> v(1); v << dbl(2);
+
+	EvalProfile profile;
+	{
+		ScopedEvalProfiling profiling(profile);
+	}
+	sys.Eval(v);
+	BOOST_CHECK(profile.Empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -49,6 +49,7 @@
 #include "bertini2/function_tree.hpp"
 #include "bertini2/system.hpp"
 #include "bertini2/system_parsing.hpp"
+#include "bertini2/serialization.hpp"
 
 using Variable = bertini::node::Variable;
 using Node = bertini::node::Node;
@@ -207,6 +208,173 @@ BOOST_AUTO_TEST_CASE(system_serialize)
 }
 
 
+BOOST_AUTO_TEST_CASE(mpfr_float_serialize_binary_exact)
+{
+	bertini::ScopedDefaultPrecision prec(100);
+
+	bertini::mpfr_float a = bertini::mpfr_float(1)/3;
+	bertini::mpz_int b = -(bertini::mpz_int(1) << 200) + 17;
+	bertini::mpq_rational c(b, bertini::mpz_int(3));
+	bertini::mpfr_float d = -a/bertini::mpfr_float(1024);
+	bertini::mpfr_float e = -bertini::mpfr_float(0);
+
+	{
+		std::ofstream fout("serialization_test_node", std::ios::binary);
+		boost::archive::binary_oarchive oa(fout);
+		oa << a << b << c << d << e;
+	}
+
+	bertini::ScopedDefaultPrecision other_prec(30);
+
+	bertini::mpfr_float a2;
+	bertini::mpz_int b2;
+	bertini::mpq_rational c2;
+	bertini::mpfr_float d2, e2;
+	{
+		std::ifstream fin("serialization_test_node", std::ios::binary);
+		boost::archive::binary_iarchive ia(fin);
+		ia >> a2 >> b2 >> c2 >> d2 >> e2;
+	}
+
+	BOOST_CHECK_EQUAL(a2.precision(), a.precision());
+	BOOST_CHECK(a2==a);
+	BOOST_CHECK(b2==b);
+	BOOST_CHECK(c2==c);
+	BOOST_CHECK(d2==d);
+	BOOST_CHECK(e2==0);
+	BOOST_CHECK(signbit(e2));
+}
+
+
+BOOST_AUTO_TEST_CASE(shared_subexpression_stays_shared_binary)
+{
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	auto y = x*x + 2;
+	auto f = exp(y);
+	auto g = sin(y);
+
+	{
+		std::ofstream fout("serialization_test_node", std::ios::binary);
+		boost::archive::binary_oarchive oa(fout);
+		oa << x << f << g;
+	}
+
+	std::shared_ptr<Variable> x2;
+	std::shared_ptr<Node> f2, g2;
+	{
+		std::ifstream fin("serialization_test_node", std::ios::binary);
+		boost::archive::binary_iarchive ia(fin);
+		ia >> x2 >> f2 >> g2;
+	}
+
+	auto f2_unary = std::dynamic_pointer_cast<bertini::node::UnaryOperator>(f2);
+	auto g2_unary = std::dynamic_pointer_cast<bertini::node::UnaryOperator>(g2);
+	BOOST_REQUIRE(f2_unary);
+	BOOST_REQUIRE(g2_unary);
+	BOOST_CHECK(f2_unary->first_child()==g2_unary->first_child());
+
+	x->set_current_value(dbl(1.2,0.9));
+	x2->set_current_value(dbl(1.2,0.9));
+	BOOST_CHECK(abs(f->Eval<dbl>() - f2->Eval<dbl>()) < threshold_clearance_d);
+	BOOST_CHECK(abs(g->Eval<dbl>() - g2->Eval<dbl>()) < threshold_clearance_d);
+}
+
+
+BOOST_AUTO_TEST_CASE(system_serialize_binary_with_jacobian)
+{
+	std::string str = "function f1, f2; variable_group x1, x2; y = x1*x2; f1 = y*y - 0.1; f2 = x1*y; ";
+
+	bertini::System sys;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+	sys.Differentiate();
+
+	bertini::SaveBinary(sys, "serialization_test_node");
+
+	bertini::System sys2;
+	bertini::LoadBinary(sys2, "serialization_test_node");
+
+	Vec<dbl> values(2);
+	values << dbl(2.0), dbl(3.0);
+
+	Vec<dbl> v = sys.Eval(values);
+	Vec<dbl> v2 = sys2.Eval(values);
+	BOOST_CHECK_EQUAL(v2.size(),2);
+	BOOST_CHECK_EQUAL(v2(0), v(0));
+	BOOST_CHECK_EQUAL(v2(1), v(1));
+
+	auto J = sys.Jacobian(values);
+	auto J2 = sys2.Jacobian(values);
+	for (unsigned ii = 0; ii < 2; ++ii)
+		for (unsigned jj = 0; jj < 2; ++jj)
+			BOOST_CHECK_EQUAL(J2(ii,jj), J(ii,jj));
+}
+
+
+
+BOOST_AUTO_TEST_CASE(system_serialize_lazily_differentiated)
+{
+	std::string str = "function f1, f2; variable_group x1, x2; y = x1*x2; f1 = y*y - 0.1; f2 = x1*y; ";
+
+	System sys(str), lazy(str);
+	sys.Differentiate();
+	lazy.LazyDifferentiation(true);
+	lazy.Differentiate();
+
+	{
+		std::ofstream fout("serialization_test_node");
+		boost::archive::text_oarchive oa(fout);
+		oa << lazy;
+	}
+
+	System lazy2;
+	{
+		std::ifstream fin("serialization_test_node");
+		boost::archive::text_iarchive ia(fin);
+		ia >> lazy2;
+	}
+
+	BOOST_CHECK(lazy2.LazyDifferentiation());
+
+	Vec<dbl> values(2);
+	values << dbl(2.0), dbl(3.0);
+
+	auto J = sys.Jacobian(values);
+	auto J2 = lazy2.Jacobian(values);
+	for (unsigned ii = 0; ii < 2; ++ii)
+		for (unsigned jj = 0; jj < 2; ++jj)
+			BOOST_CHECK_EQUAL(J2(ii,jj), J(ii,jj));
+}
+
+
+BOOST_AUTO_TEST_CASE(total_degree_serialize_binary)
+{
+	bertini::System sys;
+	auto x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y");
+	bertini::VariableGroup v{x, y};
+	sys.AddVariableGroup(v);
+	sys.AddFunction(x*x + y - 1);
+	sys.AddFunction(x - y*y*y);
+
+	bertini::start_system::TotalDegree td(sys);
+	bertini::SaveBinary(td, "serialization_test_node");
+
+	bertini::start_system::TotalDegree td2;
+	bertini::LoadBinary(td2, "serialization_test_node");
+
+	BOOST_CHECK_EQUAL(td2.NumStartPoints(), td.NumStartPoints());
+	for (unsigned ii = 0; ii < td.NumStartPoints(); ++ii)
+	{
+		Vec<dbl> p = td.StartPoint<dbl>(ii);
+		Vec<dbl> p2 = td2.StartPoint<dbl>(ii);
+		for (unsigned jj = 0; jj < p.size(); ++jj)
+			BOOST_CHECK_EQUAL(p2(jj), p(jj));
+	}
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
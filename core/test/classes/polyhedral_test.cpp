@@ -0,0 +1,136 @@
+//This file is part of Bertini 2.
+//
+//polyhedral_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polyhedral_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polyhedral_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file polyhedral_test.cpp Unit testing for mixed volumes and the polyhedral start system
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/start_system/polyhedral.hpp"
+
+#include "externs.hpp"
+
+BOOST_AUTO_TEST_SUITE(polyhedral_start_system)
+
+using namespace bertini;
+using Var = std::shared_ptr<bertini::node::Variable>;
+
+using bertini::DefaultPrecision;
+using namespace bertini::start_system::polyhedral;
+
+
+BOOST_AUTO_TEST_CASE(support_of_function)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+	VariableGroup v{x,y};
+
+	auto f = pow(x,2)*y - 3*x + pow(x*y+1,2);
+	auto supp = f->Support(v);
+
+	std::set<std::vector<int> > expected{{2,1},{1,0},{2,2},{1,1},{0,0}};
+	BOOST_CHECK(supp==expected);
+
+	BOOST_CHECK_THROW(exp(x)->Support(v), std::runtime_error);
+}
+
+
+BOOST_AUTO_TEST_CASE(mixed_volume_dense_quadrics_is_bezout)
+{
+	Support quadric{{0,0},{1,0},{0,1},{2,0},{1,1},{0,2}};
+	BOOST_CHECK_EQUAL(MixedVolume(std::vector<Support>{quadric, quadric}), 4);
+	BOOST_CHECK_EQUAL(MixedVolume(std::vector<Support>{quadric, quadric}, 2), 4);
+}
+
+
+BOOST_AUTO_TEST_CASE(mixed_volume_sparse_below_bezout)
+{
+	// xy - 1 and xy + x - 2, total degree 4, but one solution
+	Support f1{{0,0},{1,1}};
+	Support f2{{0,0},{1,0},{1,1}};
+	BOOST_CHECK_EQUAL(MixedVolume(std::vector<Support>{f1, f2}), 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(lower_triangularize_binomial_exponents)
+{
+	std::vector<std::vector<mpz_int> > V{{2,1},{1,3}}, L, W;
+	LowerTriangularize(V, L, W);
+
+	BOOST_CHECK_EQUAL(L[0][1], 0);
+	BOOST_CHECK_EQUAL(abs(L[0][0]*L[1][1]), 5);
+
+	// V W == L
+	for (unsigned ii = 0; ii < 2; ++ii)
+		for (unsigned jj = 0; jj < 2; ++jj)
+			BOOST_CHECK_EQUAL(V[ii][0]*W[0][jj] + V[ii][1]*W[1][jj], L[ii][jj]);
+}
+
+
+BOOST_AUTO_TEST_CASE(polyhedral_start_points_solve_start_system)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(pow(x,3)*y + pow(y,2) - 2);
+
+	start_system::TotalDegree TD(sys);
+	start_system::Polyhedral P(sys, 1);
+
+	BOOST_CHECK(P.NumStartPoints() < TD.NumStartPoints());
+	BOOST_CHECK_EQUAL(P.NumStartPoints(), MixedVolume(P.MixedCells()));
+
+	for (mpz_int ii = 0; ii < P.NumStartPoints(); ++ii)
+	{
+		size_t cell_index;
+		auto binomial_solution = P.BinomialStartPoint<dbl>(ii, cell_index);
+		auto at_start = P.CellHomotopy(cell_index).Eval(binomial_solution, dbl(1));
+		for (unsigned jj = 0; jj < at_start.size(); ++jj)
+			BOOST_CHECK(abs(at_start(jj)) < relaxed_threshold_clearance_d);
+
+		auto start = P.StartPoint<dbl>(ii);
+		auto function_values = P.Eval(start);
+		for (unsigned jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(polyhedral_nonpolynomial_should_throw)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(exp(x) - y);
+	sys.AddFunction(x + y);
+
+	BOOST_CHECK_THROW(start_system::Polyhedral P(sys), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
@@ -0,0 +1,162 @@
+//This file is part of Bertini 2.
+//
+//random_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//random_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with random_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+/**
+\file random_test.cpp Unit testing for the per-thread random number streams.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+
+#include "bertini2/random.hpp"
+#include "bertini2/num_traits.hpp"
+#include "bertini2/eigen_extensions.hpp"
+
+using dbl = bertini::dbl;
+using mpfr = bertini::mpfr;
+using mpfr_float = bertini::mpfr_float;
+
+using bertini::ScopedRandomStream;
+using bertini::RandomUnit;
+
+BOOST_AUTO_TEST_SUITE(random_streams)
+
+
+BOOST_AUTO_TEST_CASE(same_stream_same_numbers)
+{
+	bertini::DefaultPrecision(30);
+
+	dbl a_d, b_d;
+	mpfr a_mp, b_mp;
+	{
+		ScopedRandomStream s(42, 7);
+		a_d = RandomUnit<dbl>();
+		a_mp = RandomUnit<mpfr>();
+	}
+	{
+		ScopedRandomStream s(42, 7);
+		b_d = RandomUnit<dbl>();
+		b_mp = RandomUnit<mpfr>();
+	}
+
+	BOOST_CHECK_EQUAL(a_d, b_d);
+	BOOST_CHECK_EQUAL(a_mp.real(), b_mp.real());
+	BOOST_CHECK_EQUAL(a_mp.imag(), b_mp.imag());
+}
+
+
+BOOST_AUTO_TEST_CASE(different_streams_different_numbers)
+{
+	dbl a, b, c;
+	{
+		ScopedRandomStream s(42, 7);
+		a = RandomUnit<dbl>();
+	}
+	{
+		ScopedRandomStream s(42, 8);
+		b = RandomUnit<dbl>();
+	}
+	{
+		ScopedRandomStream s(43, 7);
+		c = RandomUnit<dbl>();
+	}
+
+	BOOST_CHECK(a!=b);
+	BOOST_CHECK(a!=c);
+}
+
+
+BOOST_AUTO_TEST_CASE(scope_restores_thread_engine)
+{
+	auto before = bertini::ThreadRandomEngine();
+	{
+		ScopedRandomStream s(1, 2);
+		RandomUnit<dbl>();
+		ScopedRandomStream nested(3, 4);
+		RandomUnit<dbl>();
+	}
+	BOOST_CHECK(bertini::ThreadRandomEngine()==before);
+}
+
+
+BOOST_AUTO_TEST_CASE(successive_units_differ)
+{
+	auto v = bertini::RandomOfUnits<dbl>(4);
+	for (int ii = 1; ii < v.size(); ++ii)
+		BOOST_CHECK(v(ii)!=v(0));
+
+	for (int ii = 0; ii < v.size(); ++ii)
+		BOOST_CHECK_CLOSE(abs(v(ii)), 1.0, 1e-12);
+}
+
+
+BOOST_AUTO_TEST_CASE(stream_independent_of_thread)
+{
+	dbl here, there;
+	{
+		ScopedRandomStream s(42, 7);
+		RandomUnit<dbl>(); // disturb the thread's engine before the comparison
+	}
+	{
+		ScopedRandomStream s(42, 7);
+		here = RandomUnit<dbl>();
+	}
+
+	std::thread t([&]{
+			ScopedRandomStream s(42, 7);
+			there = RandomUnit<dbl>();
+		});
+	t.join();
+
+	BOOST_CHECK_EQUAL(here, there);
+}
+
+
+BOOST_AUTO_TEST_CASE(threads_get_different_engines)
+{
+	dbl here = RandomUnit<dbl>(), there;
+	std::thread t([&]{there = RandomUnit<dbl>();});
+	t.join();
+
+	BOOST_CHECK(here!=there);
+}
+
+
+BOOST_AUTO_TEST_CASE(random_mp_in_unit_interval)
+{
+	ScopedRandomStream s(42, 0);
+	for (unsigned ii = 0; ii < 10; ++ii)
+	{
+		mpfr_float r;
+		bertini::RandomMp(r, 100);
+		BOOST_CHECK(r >= 0);
+		BOOST_CHECK(r < 1);
+		BOOST_CHECK_EQUAL(r.precision(), 100);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
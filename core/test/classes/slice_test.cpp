@@ -37,6 +37,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "bertini2/slice.hpp"
+#include "bertini2/system.hpp"
 
 BOOST_AUTO_TEST_SUITE(linear_slicing)
 
@@ -84,5 +85,111 @@ BOOST_AUTO_TEST_CASE(slice_basic_real)
 }
 
 
+BOOST_AUTO_TEST_CASE(system_with_slice_evaluates_slice_after_functions)
+{
+	DefaultPrecision(30);
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), z = std::make_shared<bertini::node::Variable>("z");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y,z});
+	sys.AddFunction(x*y - z);
+
+	// slice on y and x, in the other order from the system, to exercise the index map
+	auto s = LinearSlice::RandomComplex(VariableGroup{y,x},2);
+	sys.AddSlice(s);
+
+	BOOST_CHECK(sys.IsSliced());
+	BOOST_CHECK_EQUAL(sys.NumSliceFunctions(),2);
+	BOOST_CHECK_EQUAL(sys.NumTotalFunctions(),3);
+
+	Vec<dbl> values(3);
+	values << dbl(2,1), dbl(-1,0.5), dbl(0.3,-0.7);
+
+	Vec<dbl> y_and_x(2);
+	y_and_x << values(1), values(0);
+	Vec<dbl> expected_slice_values = s.Eval(y_and_x);
+
+	auto f = sys.Eval(values);
+	BOOST_REQUIRE_EQUAL(f.size(),3);
+	BOOST_CHECK(abs(f(0) - (values(0)*values(1)-values(2))) < 1e-14);
+	BOOST_CHECK(abs(f(1) - expected_slice_values(0)) < 1e-14);
+	BOOST_CHECK(abs(f(2) - expected_slice_values(1)) < 1e-14);
+
+	auto J = sys.Jacobian(values);
+	Mat<dbl> slice_jacobian = s.Jacobian(Mat<dbl>(y_and_x));
+	for (unsigned ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(J(ii+1,0) - slice_jacobian(ii,1)) < 1e-14);
+		BOOST_CHECK(abs(J(ii+1,1) - slice_jacobian(ii,0)) < 1e-14);
+		BOOST_CHECK_EQUAL(J(ii+1,2), dbl(0));
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(system_with_slice_evaluates_in_mpfr)
+{
+	DefaultPrecision(30);
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*x + y*y - 1);
+	sys.AddSlice(LinearSlice::RandomComplex(VariableGroup{x,y},1));
+
+	Vec<mpfr> values(2);
+	values << mpfr("0.6","0.1"), mpfr("0.8","-0.2");
+
+	auto f = sys.Eval(values);
+	BOOST_CHECK_EQUAL(f.size(),2);
+
+	Vec<mpfr> x_and_y = values;
+	Vec<mpfr> expected_slice_values = sys.Slices()[0].Eval(x_and_y);
+	BOOST_CHECK(abs(f(1) - expected_slice_values(0)) < mpfr_float("1e-28"));
+
+	sys.ClearSlices();
+	BOOST_CHECK(!sys.IsSliced());
+	BOOST_CHECK_EQUAL(sys.NumTotalFunctions(),1);
+}
+
+
+BOOST_AUTO_TEST_CASE(system_with_slice_on_foreign_variable_throws)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 1);
+	sys.AddSlice(LinearSlice::RandomComplex(VariableGroup{x,y},1));
+
+	Vec<dbl> values(1);
+	values << dbl(1,0);
+	BOOST_CHECK_THROW(sys.Eval(values), std::runtime_error);
+}
+
+
+BOOST_AUTO_TEST_CASE(sum_and_concatenation_keep_slices)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	System f, g;
+	f.AddVariableGroup(VariableGroup{x,y});
+	f.AddFunction(x*x - 1);
+	g.AddVariableGroup(VariableGroup{x,y});
+	g.AddFunction(y*y - 1);
+	g.AddSlice(LinearSlice::RandomComplex(VariableGroup{x,y},1));
+
+	System sum = f;
+	sum += g;
+	BOOST_CHECK_EQUAL(sum.NumSliceFunctions(),1);
+
+	BOOST_CHECK_THROW(sum += g, std::runtime_error);
+
+	System stacked = Concatenate(g, g);
+	BOOST_CHECK_EQUAL(stacked.NumFunctions(),2);
+	BOOST_CHECK_EQUAL(stacked.NumSliceFunctions(),2);
+	BOOST_CHECK_EQUAL(stacked.NumTotalFunctions(),4);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -417,6 +417,198 @@ BOOST_AUTO_TEST_CASE(total_degree_start_system_coefficient_bound_degree_bound)
 
 
 
+BOOST_AUTO_TEST_CASE(multihomogeneous_bilinear_fewer_paths_than_total_degree)
+{
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y");
+
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddVariableGroup(VariableGroup{y});
+	sys.AddFunction(x*y + x + 1);
+	sys.AddFunction(x*y + y - 2);
+
+	bertini::start_system::MultiHomogeneous MH(sys);
+
+	auto degrees = sys.Degrees();
+	BOOST_CHECK_EQUAL(degrees[0]*degrees[1], 4);
+	BOOST_CHECK_EQUAL(MH.NumStartPoints(), 2);
+	BOOST_CHECK_EQUAL(MH.NumGroupChoices(), 2);
+	BOOST_CHECK_EQUAL(MH.NumFunctions(), 2);
+	BOOST_CHECK_EQUAL(MH.DegreeMatrix()[0][0], 1);
+	BOOST_CHECK_EQUAL(MH.DegreeMatrix()[0][1], 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(multihomogeneous_start_points_satisfy_start_system)
+{
+	bertini::System sys;
+	Var x1 = std::make_shared<Variable>("x1"), x2 = std::make_shared<Variable>("x2");
+	Var y1 = std::make_shared<Variable>("y1"), y2 = std::make_shared<Variable>("y2");
+
+	sys.AddVariableGroup(VariableGroup{x1,x2});
+	sys.AddVariableGroup(VariableGroup{y1,y2});
+	sys.AddFunction(x1*y1 + x2*y2 - 1);
+	sys.AddFunction(x1*y2 - x2 + 3);
+	sys.AddFunction(pow(x1,2)*y1 + y2 - x2);
+	sys.AddFunction(x1 + x2*y1*y2 - 2);
+
+	bertini::start_system::MultiHomogeneous MH(sys);
+
+	auto degrees = sys.Degrees();
+	mpz_int total_degree = 1;
+	for (auto d : degrees)
+		total_degree *= d;
+	BOOST_CHECK(MH.NumStartPoints() < total_degree);
+
+	for (mpz_int ii = 0; ii < MH.NumStartPoints(); ++ii)
+	{
+		auto start = MH.StartPoint<dbl>(ii);
+		auto function_values = MH.Eval(start);
+
+		for (size_t jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+	}
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	for (mpz_int ii = 0; ii < MH.NumStartPoints(); ++ii)
+	{
+		auto start = MH.StartPoint<mpfr>(ii);
+		auto function_values = MH.Eval(start);
+
+		for (size_t jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < threshold_clearance_mp);
+	}
+
+	BOOST_CHECK_THROW(MH.StartPoint<dbl>(MH.NumStartPoints()), std::out_of_range);
+}
+
+
+BOOST_AUTO_TEST_CASE(multihomogeneous_homogeneous_group_start_points)
+{
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x");
+	Var u = std::make_shared<Variable>("u"), v = std::make_shared<Variable>("v");
+
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddHomVariableGroup(VariableGroup{u,v});
+	sys.AddFunction(x*u - v);
+	sys.AddFunction(pow(x,2)*v + u);
+
+	bertini::start_system::MultiHomogeneous MH(sys);
+
+	// choices are f1->x,f2->hom (1*1) and f1->hom,f2->x (1*2)
+	BOOST_CHECK_EQUAL(MH.NumStartPoints(), 3);
+
+	for (mpz_int ii = 0; ii < MH.NumStartPoints(); ++ii)
+	{
+		auto start = MH.StartPoint<dbl>(ii);
+		BOOST_CHECK_EQUAL(start.size(), 3);
+
+		auto function_values = MH.Eval(start);
+		for (size_t jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(multihomogeneous_ungrouped_variables_should_throw)
+{
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y");
+
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddUngroupedVariable(y);
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(x + y);
+
+	BOOST_CHECK_THROW(bertini::start_system::MultiHomogeneous MH(sys), std::runtime_error);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(linear_product_bilinear_fewer_paths_than_total_degree)
+{
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y");
+
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(x*y + x - 2);
+
+	bertini::start_system::TotalDegree TD(sys);
+	bertini::start_system::LinearProduct LP(sys);
+
+	BOOST_CHECK_EQUAL(TD.NumStartPoints(), 4);
+	BOOST_CHECK_EQUAL(LP.NumStartPoints(), 2);
+	BOOST_CHECK_EQUAL(LP.PartDegrees()[0].size(), 2);
+
+	for (mpz_int ii = 0; ii < LP.NumStartPoints(); ++ii)
+	{
+		auto start = LP.StartPoint<dbl>(ii);
+		auto function_values = LP.Eval(start);
+
+		for (size_t jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(linear_product_given_partitions_start_points)
+{
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), z = std::make_shared<Variable>("z");
+
+	sys.AddVariableGroup(VariableGroup{x,y,z});
+	sys.AddFunction(pow(x,2)*y + z - 1);
+	sys.AddFunction(x*pow(z,2) + y*z - 2);
+	sys.AddFunction(x + y + z);
+
+	std::vector<std::vector<VariableGroup> > partitions{
+		{VariableGroup{x}, VariableGroup{y,z}},
+		{VariableGroup{x,y}, VariableGroup{z}},
+		{VariableGroup{x,y,z}}
+	};
+
+	bertini::start_system::LinearProduct LP(sys, partitions);
+	bertini::start_system::TotalDegree TD(sys);
+
+	BOOST_CHECK_EQUAL(LP.PartDegrees()[0][0], 2);
+	BOOST_CHECK_EQUAL(LP.PartDegrees()[1][1], 2);
+	BOOST_CHECK(LP.NumStartPoints() <= TD.NumStartPoints());
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	for (mpz_int ii = 0; ii < LP.NumStartPoints(); ++ii)
+	{
+		auto start = LP.StartPoint<mpfr>(ii);
+		auto function_values = LP.Eval(start);
+
+		for (size_t jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < threshold_clearance_mp);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(linear_product_partition_missing_variable_should_throw)
+{
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y");
+
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(x + y);
+
+	std::vector<std::vector<VariableGroup> > partitions{
+		{VariableGroup{x}},
+		{VariableGroup{x,y}}
+	};
+
+	BOOST_CHECK_THROW(bertini::start_system::LinearProduct LP(sys, partitions), std::runtime_error);
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
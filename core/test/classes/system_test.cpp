@@ -965,6 +965,176 @@ BOOST_AUTO_TEST_CASE(ref_test)
 
 
 
+/**
+\class bertini::System
+\test \b system_clone_shares_no_nodes Clone a system, and check the clone evaluates the same, but independently of the original.
+*/
+BOOST_AUTO_TEST_CASE(system_clone_shares_no_nodes)
+{
+	std::string str = "function f, g; variable_group x1, x2; y = x1*x2; f = y*y; g = y + x1^2;";
+
+	bertini::System sys;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+
+	sys.Differentiate();
+	auto clone = sys.Clone();
+
+	BOOST_CHECK_EQUAL(clone.NumVariables(), sys.NumVariables());
+	BOOST_CHECK_EQUAL(clone.NumFunctions(), sys.NumFunctions());
+	for (unsigned ii = 0; ii < sys.NumVariables(); ++ii)
+	{
+		BOOST_CHECK(clone.Variables()[ii] != sys.Variables()[ii]);
+		BOOST_CHECK_EQUAL(clone.Variables()[ii]->name(), sys.Variables()[ii]->name());
+	}
+
+	Vec<dbl> values(2);
+	values << dbl(2.0), dbl(3.0);
+
+	Vec<dbl> other_values(2);
+	other_values << dbl(-1.0), dbl(0.5);
+
+	Vec<dbl> v = sys.Eval(values);
+	Vec<dbl> v_clone = clone.Eval(other_values);
+
+	BOOST_CHECK_EQUAL(v(0), 36.0);
+	BOOST_CHECK_EQUAL(v(1), 10.0);
+	BOOST_CHECK_EQUAL(v_clone(0), 0.25);
+	BOOST_CHECK_EQUAL(v_clone(1), 0.5);
+
+	// evaluating the clone must not have disturbed the values stored in the original
+	Vec<dbl> v_again = sys.Eval<dbl>();
+	BOOST_CHECK_EQUAL(v_again(0), 36.0);
+	BOOST_CHECK_EQUAL(v_again(1), 10.0);
+
+	auto J = sys.Jacobian(values);
+	auto J_clone = clone.Jacobian(values);
+	for (unsigned ii = 0; ii < 2; ++ii)
+		for (unsigned jj = 0; jj < 2; ++jj)
+			BOOST_CHECK_EQUAL(J_clone(ii,jj), J(ii,jj));
+}
+
+
+
+
+/**
+\class bertini::System
+\test \b system_parse_long_sum Parse a function with many terms, which parses to one flat sum.
+*/
+BOOST_AUTO_TEST_CASE(system_parse_long_sum)
+{
+	const unsigned num_terms = 20000;
+	std::string str = "function f; variable_group x, y; f = x*y";
+	for (unsigned ii = 1; ii < num_terms; ++ii)
+		str += (ii%2 ? " + 2*x*y" : " - x*y");
+	str += ";";
+
+	System sys(str);
+
+	Vec<dbl> values(2);
+	values << dbl(2.0), dbl(3.0);
+
+	Vec<dbl> v = sys.Eval(values);
+	BOOST_CHECK_EQUAL(v(0), 6.0*(1 + num_terms/2*2 - (num_terms-1)/2));
+}
+
+
+/**
+\class bertini::System
+\test \b system_parse_in_parallel Parse the definitions of the functions of a system on several threads, and get the same system as parsing on one.
+*/
+BOOST_AUTO_TEST_CASE(system_parse_in_parallel)
+{
+	std::string str = "function f1, f2, f3; variable_group x1, x2; constant c; c = 1.5; y = x1*x2; f1 = y*y - c; f2 = x1^2 + y/2; f3 = -x2*c*y;";
+
+	System serial(str);
+	System parallel = bertini::ParseSystem(str, 3);
+
+	BOOST_CHECK_EQUAL(parallel.NumFunctions(), serial.NumFunctions());
+	BOOST_CHECK_EQUAL(parallel.NumVariables(), serial.NumVariables());
+
+	Vec<dbl> values(2);
+	values << dbl(2.0), dbl(-3.0);
+
+	Vec<dbl> v = serial.Eval(values);
+	Vec<dbl> v_parallel = parallel.Eval(values);
+	for (unsigned ii = 0; ii < 3; ++ii)
+		BOOST_CHECK_EQUAL(v_parallel(ii), v(ii));
+
+	BOOST_CHECK_THROW(bertini::ParseSystem("function f; variable_group x; f = x*+;", 2), std::runtime_error);
+}
+
+
+/**
+\class bertini::System
+\test \b system_parse_in_parallel_checks_order_and_collects_errors A deferred definition may only use symbols which come before it, as when parsing serially, and errors from all the threads are reported together.
+*/
+BOOST_AUTO_TEST_CASE(system_parse_in_parallel_checks_order_and_collects_errors)
+{
+	std::string uses_later_subfunction = "function f; variable_group x; f = x*y; y = x^2;";
+	BOOST_CHECK_THROW(System{uses_later_subfunction}, std::runtime_error);
+	BOOST_CHECK_THROW(bertini::ParseSystem(uses_later_subfunction, 2), std::runtime_error);
+
+	std::string two_bad_definitions = "function f1, f2, f3; variable_group x; f1 = x*+; f2 = x; f3 = x^;";
+	std::string what;
+	try
+	{
+		bertini::ParseSystem(two_bad_definitions, 3);
+	}
+	catch (std::runtime_error const& e)
+	{
+		what = e.what();
+	}
+	BOOST_CHECK(what.find("function f1")!=std::string::npos);
+	BOOST_CHECK(what.find("function f2")==std::string::npos);
+	BOOST_CHECK(what.find("function f3")!=std::string::npos);
+}
+
+
+
+
+/**
+\class bertini::System
+\test \b system_differentiate_in_parallel_and_lazily Differentiate a system on several threads, and lazily, and get the same Jacobian as differentiating serially.
+*/
+BOOST_AUTO_TEST_CASE(system_differentiate_in_parallel_and_lazily)
+{
+	std::string str = "function f1, f2, f3, f4; variable_group x1, x2; y = x1*x2; f1 = y*y; f2 = x1^3 - 2*y; f3 = sin(x1)*x2; f4 = exp(x2)/x1;";
+
+	System serial(str), parallel(str), lazy(str);
+	serial.Differentiate();
+	parallel.Differentiate(3);
+	lazy.LazyDifferentiation(true);
+
+	Vec<dbl> values(2);
+	values << dbl(0.5, 0.25), dbl(-1.5, 0.75);
+
+	auto J = serial.Jacobian(values);
+	auto J_parallel = parallel.Jacobian(values);
+
+	// a clone of a lazily differentiated system, before any of its functions have been differentiated
+	lazy.Differentiate();
+	auto lazy_clone = lazy.Clone();
+
+	auto J_lazy = lazy.Jacobian(values);
+	auto J_lazy_clone = lazy_clone.Jacobian(values);
+
+	for (unsigned ii = 0; ii < 4; ++ii)
+		for (unsigned jj = 0; jj < 2; ++jj)
+		{
+			BOOST_CHECK_EQUAL(J_parallel(ii,jj), J(ii,jj));
+			BOOST_CHECK_EQUAL(J_lazy(ii,jj), J(ii,jj));
+			BOOST_CHECK_EQUAL(J_lazy_clone(ii,jj), J(ii,jj));
+		}
+
+	BOOST_CHECK_THROW(serial.Differentiate(0), std::runtime_error);
+}
+
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,152 @@
+//This file is part of Bertini 2.
+//
+//telemetry_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//telemetry_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with telemetry_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file telemetry_test.cpp Unit testing for the per-thread telemetry counters.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+
+#include "bertini2/system.hpp"
+#include "bertini2/tracking/fixed_precision_tracker.hpp"
+#include "bertini2/detail/telemetry.hpp"
+
+using System = bertini::System;
+using Var = std::shared_ptr<bertini::Variable>;
+using Variable = bertini::Variable;
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = bertini::dbl;
+using mpfr = bertini::mpfr;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+namespace telemetry = bertini::telemetry;
+using telemetry::Counter;
+using telemetry::Phase;
+
+BOOST_AUTO_TEST_SUITE(telemetry_counters)
+
+
+BOOST_AUTO_TEST_CASE(system_evaluations_counted_by_precision)
+{
+	if (!telemetry::Enabled())
+		return;
+
+	Var x = std::make_shared<Variable>("x");
+	System sys;
+	sys.AddUngroupedVariable(x);
+	sys.AddFunction(x*x - 1);
+
+	Vec<dbl> v_d(1); v_d << dbl(2);
+	Vec<mpfr> v_mp(1); v_mp << mpfr(2);
+
+	auto before = telemetry::TakeSnapshot();
+	sys.Eval(v_d);
+	sys.Eval(v_d);
+	sys.Eval(v_mp);
+	sys.Jacobian(v_mp);
+	auto used = telemetry::TakeSnapshot() - before;
+
+	BOOST_CHECK_EQUAL(used.Count(Counter::SystemEvaluationsDouble), 2);
+	BOOST_CHECK_EQUAL(used.Count(Counter::SystemEvaluationsMultiple), 1);
+	BOOST_CHECK_EQUAL(used.Count(Counter::JacobianEvaluationsDouble), 0);
+	BOOST_CHECK_EQUAL(used.Count(Counter::JacobianEvaluationsMultiple), 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(counts_of_finished_threads_are_kept)
+{
+	if (!telemetry::Enabled())
+		return;
+
+	auto before = telemetry::TakeSnapshot();
+
+	std::vector<std::thread> threads;
+	for (unsigned ii = 0; ii < 4; ++ii)
+		threads.emplace_back([]{
+			for (unsigned jj = 0; jj < 1000; ++jj)
+				BERTINI_TELEMETRY_INCREMENT(Counter::LinearSolves);
+		});
+	for (auto& t : threads)
+		t.join();
+
+	auto used = telemetry::TakeSnapshot() - before;
+	BOOST_CHECK_EQUAL(used.Count(Counter::LinearSolves), 4000);
+}
+
+
+BOOST_AUTO_TEST_CASE(reset_zeros_counts)
+{
+	BERTINI_TELEMETRY_INCREMENT(Counter::NewtonIterations);
+	telemetry::Reset();
+
+	auto snapshot = telemetry::TakeSnapshot();
+	for (unsigned ii = 0; ii < telemetry::NumCounters; ++ii)
+		BOOST_CHECK_EQUAL(snapshot.counts[ii], 0);
+	for (unsigned ii = 0; ii < telemetry::NumPhases; ++ii)
+		BOOST_CHECK_EQUAL(snapshot.phase_entries[ii], 0);
+}
+
+
+BOOST_AUTO_TEST_CASE(tracking_counts_newton_iterations_and_phases)
+{
+	if (!telemetry::Enabled())
+		return;
+
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{y};
+	sys.AddFunction(y-t);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	DoublePrecisionTracker tracker(sys);
+	tracker.Setup(config::Predictor::Euler, double(1e-5), double(1e5), config::Stepping<double>(), config::Newton());
+
+	Vec<dbl> y_start(1); y_start << dbl(1);
+	Vec<dbl> y_end;
+
+	auto before = telemetry::TakeSnapshot();
+	auto code = tracker.TrackPath(y_end, dbl(1), dbl(0), y_start);
+	auto used = telemetry::TakeSnapshot() - before;
+
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK(used.Count(Counter::NewtonIterations) > 0);
+	BOOST_CHECK(used.Count(Counter::LUFactorizations) >= used.Count(Counter::NewtonIterations));
+	BOOST_CHECK(used.Count(Counter::PredictorStages) > 0);
+	BOOST_CHECK_EQUAL(used.Count(Counter::PrecisionIncreases), 0);
+	BOOST_CHECK(used.Entries(Phase::Tracking) > 0);
+	BOOST_CHECK(used.Entries(Phase::Correction) > 0);
+	BOOST_CHECK(used.Seconds(Phase::Tracking) >= used.Seconds(Phase::Correction));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -224,6 +224,49 @@ BOOST_AUTO_TEST_CASE(hermite_interpolation)
 
 
 
+/**
+The incremental interpolant, fed one sample at a time with a window of two samples, must agree with building the whole table from the most recent two samples.  Samples are from x = 1 + t^3, for which two samples with derivatives interpolate exactly.
+*/
+BOOST_AUTO_TEST_CASE(incremental_hermite_interpolant_sliding_window)
+{
+	DefaultPrecision(ambient_precision);
+
+	BCT target_time(0,0);
+	unsigned int num_samples = 2;
+
+	TimeCont<BCT> times;
+	SampCont<BCT> samples, derivatives;
+	HermiteInterpolant<BCT> interpolant(num_samples);
+
+	BCT time = ComplexFromString("0.1","0.02");
+	Vec<BCT> sample(1), derivative(1);
+	for (unsigned ii = 0; ii < 5; ++ii)
+	{
+		sample << BCT(1) + time*time*time;
+		derivative << BCT(3)*time*time;
+
+		times.push_back(time);
+		samples.push_back(sample);
+		derivatives.push_back(derivative);
+		interpolant.AddSample(time, sample, derivative);
+
+		BOOST_CHECK_EQUAL(interpolant.NumSamples(), std::min(ii+1, num_samples));
+		if (ii>0)
+		{
+			Vec<BCT> from_table = HermiteInterpolateAndSolve(target_time,num_samples,times,samples,derivatives);
+			Vec<BCT> incremental = interpolant.Evaluate(target_time, num_samples);
+			BOOST_CHECK(abs(from_table(0) - incremental(0)) < 1e-12);
+			BOOST_CHECK(abs(incremental(0) - BCT(1)) < 1e-12);
+		}
+
+		time *= BRT(0.5);
+	}
+
+	BOOST_CHECK_THROW(interpolant.Evaluate(target_time, num_samples+1), std::runtime_error);
+}
+
+
+
 
 
 
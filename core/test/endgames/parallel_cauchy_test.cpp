@@ -0,0 +1,161 @@
+//This file is part of Bertini 2.
+//
+//parallel_cauchy_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parallel_cauchy_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parallel_cauchy_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include <iostream>
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/num_traits.hpp"
+
+#include "bertini2/tracking/fixed_prec_cauchy_endgame.hpp"
+#include "bertini2/tracking/parallel_cauchy_endgame.hpp"
+
+
+
+BOOST_AUTO_TEST_SUITE(parallel_cauchy_endgame)
+
+using namespace bertini::tracking;
+using namespace bertini::tracking::endgame;
+
+using bertini::System;
+using Variable = bertini::node::Variable;
+using Var = std::shared_ptr<Variable>;
+using VariableGroup = bertini::VariableGroup;
+
+using TrackerType = DoublePrecisionTracker;
+using TestedEGType = EndgameSelector<TrackerType>::Cauchy;
+using BCT = TrackerTraits<TrackerType>::BaseComplexType;
+using BRT = TrackerTraits<TrackerType>::BaseRealType;
+
+
+// the endpoint at the origin is x=1, with cycle number 2
+std::shared_ptr<System> MakeCycleNumTwoSystem()
+{
+	auto sys = std::make_shared<System>();
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	sys->AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+
+	VariableGroup vars{x};
+	sys->AddVariableGroup(vars);
+	sys->AddPathVariable(t);
+	return sys;
+}
+
+std::shared_ptr<TrackerType> MakeTracker(System const& sys)
+{
+	auto tracker = std::make_shared<TrackerType>(sys);
+
+	config::Stepping<BRT> stepping_preferences;
+	config::Newton newton_preferences;
+	newton_preferences.max_num_newton_iterations = 2;
+	newton_preferences.min_num_newton_iterations = 1;
+
+	tracker->Setup(config::Predictor::HeunEuler,
+                1e-5,
+                1e5,
+                stepping_preferences,
+                newton_preferences);
+	return tracker;
+}
+
+
+BOOST_AUTO_TEST_CASE(parallel_matches_serial_cycle_num_greater_than_1)
+{
+	bertini::DefaultPrecision(16);
+
+	BCT time(0.1);
+	Vec<BCT> sample(1);
+	sample << BCT(9.000000000000001e-01, 4.358898943540673e-01);
+
+	Vec<BCT> x_origin(1);
+	x_origin << BCT(1,0);
+
+	auto serial_sys = MakeCycleNumTwoSystem();
+	auto serial_tracker = MakeTracker(*serial_sys);
+	TestedEGType serial_endgame(*serial_tracker);
+	auto serial_code = serial_endgame.Run(time, sample);
+	BOOST_CHECK(serial_code==SuccessCode::Success);
+
+	const unsigned num_workers = 3;
+	std::vector<std::shared_ptr<System>> systems;
+	std::vector<std::shared_ptr<TrackerType>> trackers;
+	std::vector<std::shared_ptr<TestedEGType>> endgames;
+	for (unsigned ii = 0; ii < num_workers; ++ii)
+	{
+		systems.push_back(MakeCycleNumTwoSystem());
+		trackers.push_back(MakeTracker(*systems.back()));
+		endgames.push_back(std::make_shared<TestedEGType>(*trackers.back()));
+	}
+
+	ParallelCauchyEndgame<TestedEGType> parallel_endgame(endgames);
+	BOOST_CHECK_EQUAL(parallel_endgame.NumWorkers(), num_workers);
+
+	auto parallel_code = parallel_endgame.Run(time, sample);
+
+	BOOST_CHECK(parallel_code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(parallel_endgame.CycleNumber(), 2);
+	BOOST_CHECK((parallel_endgame.FinalApproximation<BCT>() - x_origin).norm() < endgames[0]->Tolerances().newton_during_endgame);
+	BOOST_CHECK((parallel_endgame.FinalApproximation<BCT>() - serial_endgame.FinalApproximation<BCT>()).norm() < endgames[0]->Tolerances().final_tolerance);
+	BOOST_CHECK(parallel_endgame.NumCirclesUsed() <= parallel_endgame.NumCirclesTracked());
+}
+
+
+BOOST_AUTO_TEST_CASE(single_worker_runs_serial_endgame)
+{
+	bertini::DefaultPrecision(16);
+
+	BCT time(0.1);
+	Vec<BCT> sample(1);
+	sample << BCT(9.000000000000001e-01, 4.358898943540673e-01);
+
+	auto sys = MakeCycleNumTwoSystem();
+	auto tracker = MakeTracker(*sys);
+	auto endgame = std::make_shared<TestedEGType>(*tracker);
+
+	ParallelCauchyEndgame<TestedEGType> parallel_endgame({endgame});
+	auto code = parallel_endgame.Run(time, sample);
+
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(parallel_endgame.CycleNumber(), endgame->CycleNumber());
+	BOOST_CHECK((parallel_endgame.FinalApproximation<BCT>() - endgame->FinalApproximation<BCT>()).norm()==0);
+}
+
+
+BOOST_AUTO_TEST_CASE(endgames_sharing_a_system_throw)
+{
+	auto sys = MakeCycleNumTwoSystem();
+	auto tracker = MakeTracker(*sys);
+	auto endgame = std::make_shared<TestedEGType>(*tracker);
+	auto other_endgame = std::make_shared<TestedEGType>(*tracker);
+
+	BOOST_CHECK_THROW(ParallelCauchyEndgame<TestedEGType>({endgame, other_endgame}), std::runtime_error);
+	BOOST_CHECK_THROW(ParallelCauchyEndgame<TestedEGType>(std::vector<std::shared_ptr<TestedEGType>>{}), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+//This file is part of Bertini 2.
+//
+//boundary_phase_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//boundary_phase_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with boundary_phase_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/nag_algorithms/boundary_phase.hpp"
+#include "test/nag_algorithms/solver_test_helpers.hpp"
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(boundary_phase)
+
+using namespace bertini::algorithm;
+using namespace bertini::tracking;
+using solver_test::SetupDoubleTracker;
+using solver_test::TightenDoubleTracker;
+using solver_test::Point;
+
+
+std::shared_ptr<System> MakeHomotopy()
+{
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	auto H = std::make_shared<System>();
+	H->AddVariableGroup(VariableGroup{x});
+	H->AddPathVariable(t);
+	H->AddFunction((1-t)*(pow(x,2) - 4) + t*(pow(x,2) - 1));
+	return H;
+}
+
+
+
+BOOST_AUTO_TEST_CASE(distinct_paths_are_not_retracked)
+{
+	DefaultPrecision(16);
+	BoundaryPhase<DoublePrecisionTracker> boundary(*MakeHomotopy(), 2, SetupDoubleTracker, TightenDoubleTracker);
+
+	std::vector<Vec<dbl>> start_points{Point(dbl(1,0)), Point(dbl(-1,0))};
+	auto results = boundary.Run(start_points, dbl(1), dbl(0.1));
+
+	BOOST_REQUIRE_EQUAL(results.size(), 2);
+	for (const auto& r : results)
+	{
+		BOOST_CHECK(r.code==SuccessCode::Success);
+		BOOST_CHECK_EQUAL(r.num_retracks, 0);
+		BOOST_CHECK(!r.crossed);
+		BOOST_CHECK(abs(r.point(0)*r.point(0) - 3.7) < 1e-6);
+	}
+	BOOST_CHECK(abs(results[0].point(0) + results[1].point(0)) < 1e-6);
+}
+
+
+BOOST_AUTO_TEST_CASE(colliding_paths_are_retracked_then_marked_crossed)
+{
+	DefaultPrecision(16);
+	BoundaryPhase<DoublePrecisionTracker> boundary(*MakeHomotopy(), 3, SetupDoubleTracker, TightenDoubleTracker);
+
+	BoundaryPhase<DoublePrecisionTracker>::Settings settings;
+	settings.max_num_retracks = 2;
+	boundary.SetSettings(settings);
+
+	// the first two paths start at the same point, so always meet at the boundary, like a path which jumped onto another
+	std::vector<Vec<dbl>> start_points{Point(dbl(1,0)), Point(dbl(1,0)), Point(dbl(-1,0))};
+	auto results = boundary.Run(start_points, dbl(1), dbl(0.1));
+
+	BOOST_REQUIRE_EQUAL(results.size(), 3);
+	for (unsigned ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(results[ii].code==SuccessCode::Success);
+		BOOST_CHECK(results[ii].crossed);
+		BOOST_CHECK(results[ii].num_retracks >= 1);
+		BOOST_CHECK(results[ii].num_retracks <= settings.max_num_retracks);
+	}
+
+	BOOST_CHECK_EQUAL(results[2].num_retracks, 0);
+	BOOST_CHECK(!results[2].crossed);
+}
+
+
+BOOST_AUTO_TEST_CASE(exception_while_tracking_is_rethrown)
+{
+	DefaultPrecision(16);
+	BoundaryPhase<DoublePrecisionTracker> boundary(*MakeHomotopy(), 2, SetupDoubleTracker, TightenDoubleTracker);
+
+	// the second start point has the wrong number of coordinates, so its tracker throws
+	std::vector<Vec<dbl>> start_points{Point(dbl(1,0)), Vec<dbl>::Zero(2), Point(dbl(-1,0))};
+	BOOST_CHECK_THROW(boundary.Run(start_points, dbl(1), dbl(0.1)), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,171 @@
+//This file is part of Bertini 2.
+//
+//monodromy_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//monodromy_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with monodromy_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/nag_algorithms/monodromy.hpp"
+#include "test/nag_algorithms/solver_test_helpers.hpp"
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(monodromy)
+
+using namespace bertini::algorithm;
+using namespace bertini::tracking;
+using solver_test::SetupDoubleTracker;
+
+
+std::shared_ptr<System> MakeCubeRootHomotopy()
+{
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	auto H = std::make_shared<System>();
+	auto p = AddStraightLineParameters(*H, t, 1);
+
+	H->AddVariableGroup(VariableGroup{x});
+	H->AddFunction(pow(x,3) - p[0]);
+	return H;
+}
+
+
+BOOST_AUTO_TEST_CASE(finds_all_cube_roots_from_one)
+{
+	DefaultPrecision(16);
+
+	Monodromy<DoublePrecisionTracker> monodromy(*MakeCubeRootHomotopy(), 1, 2, SetupDoubleTracker);
+
+	Vec<dbl> base_parameters(1);
+	base_parameters << dbl(0.4,-0.3);
+	Vec<dbl> seed(1);
+	seed << pow(base_parameters(0), 1./3);
+
+	monodromy.Seed(base_parameters, seed);
+
+	Monodromy<DoublePrecisionTracker>::StoppingCriteria stopping;
+	stopping.expected_num_solutions = 3;
+	stopping.max_num_loops = 200;
+	stopping.num_stable_loops = 200;
+	auto solutions = monodromy.Solve(stopping);
+
+	BOOST_REQUIRE_EQUAL(solutions.size(), 3);
+	BOOST_CHECK(monodromy.NumLoops() <= 200);
+	BOOST_CHECK(monodromy.NumPathsTracked() > 0);
+
+	for (const auto& s : solutions)
+		BOOST_CHECK(abs(pow(s(0),3) - base_parameters(0)) < 1e-8);
+
+	for (unsigned ii = 0; ii < solutions.size(); ++ii)
+		for (unsigned jj = ii+1; jj < solutions.size(); ++jj)
+			BOOST_CHECK(abs(solutions[ii](0) - solutions[jj](0)) > 1e-3);
+}
+
+
+BOOST_AUTO_TEST_CASE(stops_after_stable_loops)
+{
+	DefaultPrecision(16);
+
+	Monodromy<DoublePrecisionTracker> monodromy(*MakeCubeRootHomotopy(), 1, 1, SetupDoubleTracker);
+
+	Vec<dbl> base_parameters(1);
+	base_parameters << dbl(0.4,-0.3);
+
+	std::vector<Vec<dbl>> seeds(3, Vec<dbl>(1));
+	for (unsigned ii = 0; ii < 3; ++ii)
+		seeds[ii] << pow(base_parameters(0), 1./3) * std::polar(1.0, 2*acos(-1.0)*ii/3);
+
+	monodromy.Seed(base_parameters, seeds);
+	BOOST_CHECK_EQUAL(monodromy.Solutions().size(), 3);
+
+	Monodromy<DoublePrecisionTracker>::StoppingCriteria stopping;
+	stopping.num_stable_loops = 2;
+	monodromy.Solve(stopping);
+
+	// all the solutions were known from the start, so nothing new turns up
+	BOOST_CHECK_EQUAL(monodromy.NumLoops(), 2);
+	BOOST_CHECK_EQUAL(monodromy.Solutions().size(), 3);
+}
+
+
+BOOST_AUTO_TEST_CASE(duplicate_seeds_are_removed)
+{
+	Monodromy<DoublePrecisionTracker> monodromy(*MakeCubeRootHomotopy(), 1, 1, SetupDoubleTracker);
+
+	Vec<dbl> base_parameters(1);
+	base_parameters << dbl(8,0);
+	std::vector<Vec<dbl>> seeds(2, Vec<dbl>(1));
+	seeds[0] << dbl(2,0);
+	seeds[1] << dbl(2,1e-12);
+
+	monodromy.Seed(base_parameters, seeds);
+	BOOST_CHECK_EQUAL(monodromy.Solutions().size(), 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(duplicate_large_seeds_are_removed_relative_to_their_size)
+{
+	Monodromy<DoublePrecisionTracker> monodromy(*MakeCubeRootHomotopy(), 1, 1, SetupDoubleTracker);
+
+	Vec<dbl> base_parameters(1);
+	base_parameters << dbl(8e18,0);
+	std::vector<Vec<dbl>> seeds(3, Vec<dbl>(1));
+	seeds[0] << dbl(2e6,0);
+	seeds[1] << dbl(2e6,1e-3);
+	seeds[2] << dbl(2e6,1);
+
+	monodromy.Seed(base_parameters, seeds);
+	BOOST_CHECK_EQUAL(monodromy.Solutions().size(), 2);
+
+	// a tighter tolerance tells them all apart
+	monodromy.SameSolutionTolerance(1e-12);
+	monodromy.Seed(base_parameters, seeds);
+	BOOST_CHECK_EQUAL(monodromy.Solutions().size(), 3);
+}
+
+
+BOOST_AUTO_TEST_CASE(solving_without_seed_throws)
+{
+	Monodromy<DoublePrecisionTracker> monodromy(*MakeCubeRootHomotopy(), 1, 1, SetupDoubleTracker);
+
+	Monodromy<DoublePrecisionTracker>::StoppingCriteria stopping;
+	BOOST_CHECK_THROW(monodromy.Solve(stopping), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
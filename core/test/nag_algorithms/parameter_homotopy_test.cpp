@@ -0,0 +1,132 @@
+//This file is part of Bertini 2.
+//
+//parameter_homotopy_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parameter_homotopy_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parameter_homotopy_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/nag_algorithms/parameter_homotopy.hpp"
+#include "test/nag_algorithms/solver_test_helpers.hpp"
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(parameter_homotopy)
+
+using namespace bertini::algorithm;
+using namespace bertini::tracking;
+using solver_test::SetupDoubleTracker;
+
+
+std::shared_ptr<System> MakeSquareRootHomotopy()
+{
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	auto H = std::make_shared<System>();
+	auto p = AddStraightLineParameters(*H, t, 1);
+
+	H->AddVariableGroup(VariableGroup{x});
+	H->AddFunction(pow(x,2) - p[0]);
+	return H;
+}
+
+
+BOOST_AUTO_TEST_CASE(straight_line_parameters_added_to_system)
+{
+	auto H = MakeSquareRootHomotopy();
+
+	BOOST_CHECK_EQUAL(H->NumImplicitParameters(), 2);
+	BOOST_CHECK_EQUAL(H->NumParameters(), 1);
+	BOOST_CHECK(H->HavePathVariable());
+	BOOST_CHECK_EQUAL(H->NumVariables(), 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(solve_square_roots_at_several_instances)
+{
+	DefaultPrecision(16);
+
+	ParameterHomotopy<DoublePrecisionTracker> ph(*MakeSquareRootHomotopy(), 1, 2, SetupDoubleTracker);
+	BOOST_CHECK_EQUAL(ph.NumWorkers(), 2);
+
+	Vec<dbl> generic_parameters(1);
+	generic_parameters << dbl(1.3,0.7);
+
+	std::vector<Vec<dbl>> generic_solutions(2, Vec<dbl>(1));
+	generic_solutions[0] << sqrt(generic_parameters(0));
+	generic_solutions[1] << -sqrt(generic_parameters(0));
+
+	ph.GenericPoint(generic_parameters, generic_solutions);
+	BOOST_CHECK_EQUAL(ph.NumPathsPerInstance(), 2);
+
+	std::vector<Vec<dbl>> instances(5, Vec<dbl>(1));
+	for (unsigned ii = 0; ii < instances.size(); ++ii)
+		instances[ii] << dbl((ii+2)*(ii+2), 0);
+
+	auto results = ph.Solve(instances);
+
+	BOOST_CHECK_EQUAL(results.size(), instances.size());
+	for (unsigned ii = 0; ii < instances.size(); ++ii)
+	{
+		double root = ii+2;
+		BOOST_CHECK_EQUAL(results[ii].solutions.size(), 2);
+		BOOST_CHECK(results[ii].codes[0]==SuccessCode::Success);
+		BOOST_CHECK(results[ii].codes[1]==SuccessCode::Success);
+
+		// the two paths go to the two distinct roots
+		BOOST_CHECK(abs(results[ii].solutions[0](0)+results[ii].solutions[1](0)) < 1e-6);
+		BOOST_CHECK(abs(abs(results[ii].solutions[0](0)) - root) < 1e-6);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(homotopy_without_straight_line_parameters_throws)
+{
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	auto H = std::make_shared<System>();
+	H->AddVariableGroup(VariableGroup{x});
+	H->AddPathVariable(t);
+	H->AddFunction(pow(x,2) - t);
+
+	BOOST_CHECK_THROW(ParameterHomotopy<DoublePrecisionTracker>(*H, 1, 1, SetupDoubleTracker), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
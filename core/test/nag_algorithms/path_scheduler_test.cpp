@@ -0,0 +1,199 @@
+//This file is part of Bertini 2.
+//
+//path_scheduler_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//path_scheduler_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with path_scheduler_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+
+#include "bertini2/nag_algorithms/path_scheduler.hpp"
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(path_scheduler)
+
+using namespace bertini::algorithm;
+
+
+BOOST_AUTO_TEST_CASE(most_expensive_first)
+{
+	PathScheduler scheduler(4);
+	scheduler.PredictedCosts({1, 5, 3, 5});
+
+	unsigned path_index;
+	BOOST_CHECK(scheduler.Next(path_index));
+	BOOST_CHECK_EQUAL(path_index, 1);
+	BOOST_CHECK(scheduler.Next(path_index));
+	BOOST_CHECK_EQUAL(path_index, 3);
+	BOOST_CHECK(scheduler.Next(path_index));
+	BOOST_CHECK_EQUAL(path_index, 2);
+	BOOST_CHECK(scheduler.Next(path_index));
+	BOOST_CHECK_EQUAL(path_index, 0);
+	BOOST_CHECK(!scheduler.Next(path_index));
+
+	scheduler.Reset();
+	BOOST_CHECK(scheduler.Next(path_index));
+	BOOST_CHECK_EQUAL(path_index, 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(no_predictions_is_index_order)
+{
+	PathScheduler scheduler(3);
+
+	unsigned path_index;
+	for (unsigned ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK(scheduler.Next(path_index));
+		BOOST_CHECK_EQUAL(path_index, ii);
+	}
+	BOOST_CHECK(!scheduler.Next(path_index));
+}
+
+
+BOOST_AUTO_TEST_CASE(run_does_each_path_once_and_records_costs)
+{
+	unsigned num_paths = 100;
+	PathScheduler scheduler(num_paths);
+
+	std::vector<std::atomic<unsigned>> num_times_done(num_paths);
+	for (auto& n : num_times_done)
+		n = 0;
+
+	scheduler.Run(4, [&num_times_done](unsigned path_index, unsigned worker_index)
+		{
+			num_times_done[path_index]++;
+			return double(path_index);
+		});
+
+	for (unsigned ii = 0; ii < num_paths; ++ii)
+	{
+		BOOST_CHECK_EQUAL(num_times_done[ii].load(), 1);
+		BOOST_CHECK_EQUAL(scheduler.ActualCosts()[ii], double(ii));
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(run_rethrows_exception_from_worker)
+{
+	unsigned num_paths = 100;
+	PathScheduler scheduler(num_paths);
+
+	std::atomic<unsigned> num_done(0);
+
+	BOOST_CHECK_THROW(scheduler.Run(4, [&num_done](unsigned path_index, unsigned worker_index)
+		{
+			if (path_index==10)
+				throw std::runtime_error("failed on path 10");
+			num_done++;
+			return 1.0;
+		}), std::runtime_error);
+
+	BOOST_CHECK(num_done.load() < num_paths);
+}
+
+
+BOOST_AUTO_TEST_CASE(adaptive_precision_trackers_track_on_one_worker)
+{
+	using namespace bertini::tracking;
+
+	BOOST_CHECK_NO_THROW(CheckConcurrentTracking<AMPTracker>(1));
+	BOOST_CHECK_THROW(CheckConcurrentTracking<AMPTracker>(2), std::runtime_error);
+	BOOST_CHECK_NO_THROW(CheckConcurrentTracking<DoublePrecisionTracker>(4));
+	BOOST_CHECK_NO_THROW(CheckConcurrentTracking<MultiplePrecisionTracker>(4));
+}
+
+
+BOOST_AUTO_TEST_CASE(cost_accumulator_counts_iterations)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-t);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	DoublePrecisionTracker tracker(sys);
+
+	config::Stepping<double> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              double(1e-5),
+					double(1e5),
+					stepping_preferences,
+					newton_preferences);
+
+	dbl t_start(1);
+	dbl t_end(0);
+
+	Vec<dbl> y_start(1);
+	y_start << dbl(1);
+
+	Vec<dbl> y_end;
+
+	PathCostAccumulator<DoublePrecisionTracker> cost_accumulator;
+	tracker.AddObserver(&cost_accumulator);
+
+	auto code = tracker.TrackPath(y_end, t_start, t_end, y_start);
+	BOOST_CHECK(code==SuccessCode::Success);
+
+	// in double precision, every iteration costs 1
+	BOOST_CHECK_EQUAL(cost_accumulator.Cost(), double(tracker.NumTotalStepsTaken()));
+	BOOST_CHECK_EQUAL(cost_accumulator.NumPrecisionChanges(), 0);
+
+	double probed_cost = ProbePathCost(tracker, t_start, t_end, y_start, 1000);
+	BOOST_CHECK_EQUAL(probed_cost, cost_accumulator.Cost());
+
+	double partial_probe_cost = ProbePathCost(tracker, t_start, t_end, y_start, 1);
+	BOOST_CHECK(partial_probe_cost > 0);
+
+	// the probes are not seen by the tracker's observers
+	BOOST_CHECK_EQUAL(cost_accumulator.Cost(), double(tracker.NumTotalStepsTaken()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
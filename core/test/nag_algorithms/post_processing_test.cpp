@@ -0,0 +1,152 @@
+//This file is part of Bertini 2.
+//
+//post_processing_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//post_processing_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with post_processing_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/nag_algorithms/post_processing.hpp"
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+
+BOOST_AUTO_TEST_SUITE(post_processing)
+
+using namespace bertini::algorithm;
+using PostProcessingConfig = bertini::tracking::config::PostProcessing<double>;
+
+
+System MakeTwoVariableSystem()
+{
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 2);
+	sys.AddFunction(x - 1);
+	return sys;
+}
+
+Vec<dbl> Point(dbl a, dbl b)
+{
+	Vec<dbl> v(2);
+	v << a, b;
+	return v;
+}
+
+
+BOOST_AUTO_TEST_CASE(merges_nearby_endpoints_and_classifies)
+{
+	System sys = MakeTwoVariableSystem();
+	EndpointPostProcessor<dbl> post_processor(sys, PostProcessingConfig());
+
+	auto r0 = post_processor.Add(0, Point(dbl(1,0), dbl(2,0)));
+	auto r1 = post_processor.Add(1, Point(dbl(1+1e-12,0), dbl(2,0)));
+	auto r2 = post_processor.Add(2, Point(dbl(1,0), dbl(2,0.5)));
+	auto r3 = post_processor.Add(3, Point(dbl(1e7,0), dbl(0,0)));
+	auto r4 = post_processor.Add(4, Point(dbl(3,0), dbl(4,0)), 1e10);
+
+	BOOST_CHECK(r0.is_new);
+	BOOST_CHECK(!r1.is_new);
+	BOOST_CHECK_EQUAL(r1.solution_index, r0.solution_index);
+	BOOST_CHECK(r2.is_new);
+	BOOST_CHECK(r3.is_new);
+	BOOST_CHECK(r4.is_new);
+
+	BOOST_CHECK_EQUAL(post_processor.NumSolutions(), 4);
+
+	const auto& s0 = post_processor.GetSolution(r0.solution_index);
+	BOOST_CHECK_EQUAL(s0.Multiplicity(), 2);
+	BOOST_CHECK(s0.is_finite);
+	BOOST_CHECK(s0.is_real);
+	BOOST_CHECK(post_processor.IsSingular(r0.solution_index));
+
+	const auto& s2 = post_processor.GetSolution(r2.solution_index);
+	BOOST_CHECK(s2.is_finite);
+	BOOST_CHECK(!s2.is_real);
+	BOOST_CHECK(!post_processor.IsSingular(r2.solution_index));
+
+	BOOST_CHECK(!post_processor.GetSolution(r3.solution_index).is_finite);
+
+	BOOST_CHECK(post_processor.IsSingular(r4.solution_index));
+
+	unsigned num_finite, num_real, num_singular;
+	post_processor.Summary(num_finite, num_real, num_singular);
+	BOOST_CHECK_EQUAL(num_finite, 3);
+	BOOST_CHECK_EQUAL(num_real, 2);
+	BOOST_CHECK_EQUAL(num_singular, 2);
+}
+
+
+BOOST_AUTO_TEST_CASE(parallel_dedup_of_many_endpoints)
+{
+	System sys = MakeTwoVariableSystem();
+	EndpointPostProcessor<dbl> post_processor(sys, PostProcessingConfig());
+
+	unsigned num_distinct = 200, num_copies = 10;
+	std::vector<Vec<dbl>> endpoints;
+	for (unsigned copy = 0; copy < num_copies; ++copy)
+		for (unsigned ii = 0; ii < num_distinct; ++ii)
+			endpoints.push_back(Point(dbl(ii*0.01, copy*1e-13), dbl(1,-(ii*0.001))));
+
+	post_processor.AddAll(endpoints, std::vector<double>(), 4);
+
+	BOOST_CHECK_EQUAL(post_processor.NumSolutions(), num_distinct);
+	for (const auto& s : post_processor.Solutions())
+		BOOST_CHECK_EQUAL(s.Multiplicity(), num_copies);
+}
+
+
+BOOST_AUTO_TEST_CASE(dehomogenizes_before_comparing)
+{
+	System sys = MakeTwoVariableSystem();
+	sys.Homogenize();
+
+	EndpointPostProcessor<dbl> post_processor(sys, PostProcessingConfig());
+
+	Vec<dbl> a(3), b(3);
+	a << dbl(1,0), dbl(1,0), dbl(2,0);
+	b << dbl(0,2), dbl(0,2), dbl(0,4);
+
+	auto ra = post_processor.Add(0, a);
+	auto rb = post_processor.Add(1, b);
+
+	BOOST_CHECK(!rb.is_new);
+	BOOST_CHECK_EQUAL(post_processor.GetSolution(ra.solution_index).point.size(), 2);
+	BOOST_CHECK(post_processor.GetSolution(ra.solution_index).is_real);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
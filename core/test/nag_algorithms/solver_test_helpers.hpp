@@ -0,0 +1,90 @@
+//This file is part of Bertini 2.
+//
+//solver_test_helpers.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//solver_test_helpers.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with solver_test_helpers.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+/**
+\file solver_test_helpers.hpp
+
+\brief Tracker setups shared by the tests of the solvers in nag_algorithms.
+*/
+
+#pragma once
+
+#include <cmath>
+
+#include "bertini2/tracking/tracker.hpp"
+
+namespace solver_test {
+
+	using namespace bertini::tracking;
+
+	/**
+	\brief Set up a double precision tracker for ordinary tracking in the solver tests.
+	*/
+	inline
+	void SetupDoubleTracker(DoublePrecisionTracker & tracker)
+	{
+		config::Stepping<double> stepping_preferences;
+		config::Newton newton_preferences;
+
+		tracker.Setup(config::Predictor::RK4,
+		              double(1e-8),
+						double(1e5),
+						stepping_preferences,
+						newton_preferences);
+	}
+
+
+	/**
+	\brief Set up a double precision tracker for re-tracking in the solver tests, tighter at each level.
+	*/
+	inline
+	void TightenDoubleTracker(DoublePrecisionTracker & tracker, unsigned level)
+	{
+		config::Stepping<double> stepping_preferences;
+		stepping_preferences.max_step_size /= std::pow(10.0, level);
+		stepping_preferences.initial_step_size = stepping_preferences.max_step_size;
+		config::Newton newton_preferences;
+
+		tracker.Setup(config::Predictor::RK4,
+		              double(1e-8)/std::pow(10.0, level),
+						double(1e5),
+						stepping_preferences,
+						newton_preferences);
+	}
+
+
+	/**
+	\brief Make a point with one coordinate.
+	*/
+	inline
+	bertini::Vec<bertini::dbl> Point(bertini::dbl a)
+	{
+		bertini::Vec<bertini::dbl> v(1);
+		v << a;
+		return v;
+	}
+
+} // re: namespace solver_test
@@ -0,0 +1,115 @@
+//This file is part of Bertini 2.
+//
+//two_phase_solve_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//two_phase_solve_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with two_phase_solve_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/nag_algorithms/two_phase_solve.hpp"
+#include "bertini2/tracking/fixed_prec_cauchy_endgame.hpp"
+#include "test/nag_algorithms/solver_test_helpers.hpp"
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(two_phase_solve)
+
+using namespace bertini::algorithm;
+using namespace bertini::tracking;
+using solver_test::SetupDoubleTracker;
+using solver_test::TightenDoubleTracker;
+using solver_test::Point;
+
+using TrackerType = DoublePrecisionTracker;
+using EndgameType = EndgameSelector<TrackerType>::Cauchy;
+using Solver = TwoPhaseSolve<TrackerType, EndgameType>;
+
+
+// two paths go to the double root x=0, and one to the simple root x=3
+std::shared_ptr<System> MakeHomotopy()
+{
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	auto H = std::make_shared<System>();
+	H->AddVariableGroup(VariableGroup{x});
+	H->AddPathVariable(t);
+	H->AddFunction((pow(x,2) - t)*(x - 3));
+	return H;
+}
+
+
+
+BOOST_AUTO_TEST_CASE(nonsingular_paths_skip_the_endgame)
+{
+	DefaultPrecision(16);
+	Solver solver(*MakeHomotopy(), 2, 1, SetupDoubleTracker, TightenDoubleTracker);
+
+	std::vector<Vec<dbl>> start_points{Point(dbl(1,0)), Point(dbl(-1,0)), Point(dbl(3,0))};
+	auto results = solver.Solve(start_points, dbl(1), dbl(0.1));
+
+	BOOST_REQUIRE_EQUAL(results.size(), 3);
+	for (const auto& r : results)
+		BOOST_CHECK(r.code==SuccessCode::Success);
+
+	BOOST_CHECK(results[2].method==Solver::FinishMethod::Refined);
+	BOOST_CHECK_EQUAL(results[2].estimated_cycle_number, 1);
+	BOOST_CHECK(abs(results[2].solution(0) - dbl(3)) < 1e-8);
+
+	for (unsigned ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(results[ii].method==Solver::FinishMethod::Endgame);
+		BOOST_CHECK_EQUAL(results[ii].estimated_cycle_number, 2);
+		BOOST_CHECK(abs(results[ii].solution(0)) < 1e-6);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(without_endgame_workers_singular_paths_fail)
+{
+	DefaultPrecision(16);
+	Solver solver(*MakeHomotopy(), 1, 0, SetupDoubleTracker, TightenDoubleTracker);
+
+	std::vector<Vec<dbl>> start_points{Point(dbl(1,0)), Point(dbl(3,0))};
+	auto results = solver.Solve(start_points, dbl(1), dbl(0.1));
+
+	BOOST_CHECK(results[0].code==SuccessCode::Failure);
+	BOOST_CHECK(results[1].code==SuccessCode::Success);
+	BOOST_CHECK(results[1].method==Solver::FinishMethod::Refined);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,609 @@
+//This file is part of Bertini 2.
+//
+//benchmark.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file benchmark.cpp
+
+\brief The standard benchmark suite, timing evaluation, tracking and endgames on a fixed corpus of polynomial systems, and writing the results as JSON.
+
+For each system in the evaluation corpus, times evaluation of the functions and the Jacobian in double and multiple precision, and changing the precision of the system.  For each system in the tracking corpus, and for each of the double, fixed multiple and adaptive precision trackers, times one tracker step, tracking whole paths from t=1 to the endgame boundary t=0.1, and running the power series and Cauchy endgames from the endgame boundary.  For generated inputs in Bertini classic syntax, with expanded polynomials of increasing numbers of terms, times the startup work of parsing and differentiating, each on one thread and on all hardware threads.  Parsing reports the throughput in bytes per second.
+
+Each benchmark is repeated until it has run for at least the minimum time, and the mean, median and least time per iteration are reported, together with the average of each nonzero telemetry counter per iteration.  Compare the output of two versions to find regressions.
+
+Usage: b2_benchmark [--quick] [--min-time seconds] [--paths n] [--filter text] [--output file]
+
+  --quick       Run each benchmark briefly, and use only small inputs for the startup benchmarks, for checking that the suite works.
+  --min-time    The least time to spend on each benchmark, in seconds.  Default 1.
+  --paths       The number of paths to track per system.  Default 4.
+  --filter      Run only benchmarks whose name, family/size/operation/precision, contains the text.
+  --output      Write the JSON to a file, rather than to standard output.
+*/
+
+#include "test/timing/benchmark_systems.hpp"
+
+#include "bertini2/tracking/amp_cauchy_endgame.hpp"
+#include "bertini2/tracking/amp_powerseries_endgame.hpp"
+#include "bertini2/tracking/fixed_prec_cauchy_endgame.hpp"
+#include "bertini2/tracking/fixed_prec_powerseries_endgame.hpp"
+#include "bertini2/detail/telemetry.hpp"
+#include "bertini2/system_parsing.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
+
+
+
+namespace benchmark {
+
+	using namespace bertini::tracking;
+
+	using dbl = bertini::dbl;
+	using mpfr = bertini::mpfr;
+	template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+	using Clock = std::chrono::steady_clock;
+
+	inline
+	double SecondsSince(Clock::time_point start)
+	{
+		return std::chrono::duration<double>(Clock::now() - start).count();
+	}
+
+
+	/**
+	\brief The timings of one benchmark.
+	*/
+	struct Result
+	{
+		std::string family;
+		unsigned size;
+		std::string operation;
+		std::string precision;
+
+		std::uint64_t iterations = 0; ///< The number of timed iterations.
+		double total_seconds = 0; ///< The total time of the timed iterations.
+		double mean_seconds = 0; ///< The mean time per iteration.
+		double median_seconds = 0; ///< The median over samples of the time per iteration.
+		double min_seconds = 0; ///< The least over samples of the time per iteration.
+		std::uint64_t bytes = 0; ///< The size of the input handled per iteration, for throughput benchmarks.
+		std::vector<std::pair<std::string, double>> counters; ///< The nonzero telemetry counters, per iteration.
+
+		std::string Name() const
+		{
+			return family + "/" + std::to_string(size) + "/" + operation + "/" + precision;
+		}
+	};
+
+
+	/**
+	\brief Runs benchmarks, and collects their results.
+	*/
+	class Runner
+	{
+	public:
+
+		Runner(double min_seconds, unsigned min_samples, std::string const& filter) : min_seconds_(min_seconds), min_samples_(min_samples), filter_(filter)
+		{}
+
+		/**
+		\brief Whether a benchmark passes the filter.
+		*/
+		bool Wanted(std::string const& family, unsigned size, std::string const& operation, std::string const& precision) const
+		{
+			Result r{family, size, operation, precision};
+			return r.Name().find(filter_)!=std::string::npos;
+		}
+
+		/**
+		\brief Time an operation which times itself.
+
+		\param sample Takes one sample.  Returns the time it measured, and the number of iterations it did in that time, which may be zero if it could do no work.
+		\param bytes The size of the input handled per iteration, if reporting throughput.
+		*/
+		template<typename SampleF>
+		void TimeSamples(std::string const& family, unsigned size, std::string const& operation, std::string const& precision, SampleF sample, std::uint64_t bytes = 0)
+		{
+			if (!Wanted(family, size, operation, precision))
+				return;
+
+			Result r{family, size, operation, precision};
+			r.bytes = bytes;
+			std::vector<double> per_iteration;
+
+			auto before = bertini::telemetry::TakeSnapshot();
+			unsigned num_empty_samples = 0;
+			while (r.total_seconds < min_seconds_ || per_iteration.size() < min_samples_)
+			{
+				auto s = sample();
+				if (s.second==0)
+				{
+					if (++num_empty_samples > max_empty_samples)
+						break;
+					continue;
+				}
+				r.total_seconds += s.first;
+				r.iterations += s.second;
+				per_iteration.push_back(s.first / s.second);
+			}
+			auto used = bertini::telemetry::TakeSnapshot() - before;
+
+			if (per_iteration.empty())
+			{
+				std::cerr << r.Name() << " did no work; omitted\n";
+				return;
+			}
+
+			std::sort(per_iteration.begin(), per_iteration.end());
+			r.mean_seconds = r.total_seconds / r.iterations;
+			r.median_seconds = per_iteration[per_iteration.size()/2];
+			r.min_seconds = per_iteration.front();
+
+			for (unsigned ii = 0; ii < bertini::telemetry::NumCounters; ++ii)
+				if (used.counts[ii] > 0)
+					r.counters.emplace_back(bertini::telemetry::Name(static_cast<bertini::telemetry::Counter>(ii)), static_cast<double>(used.counts[ii]) / r.iterations);
+
+			std::cerr << std::left << std::setw(48) << r.Name() << std::right << std::setw(14) << std::scientific << std::setprecision(3) << r.median_seconds << " s\n" << std::defaultfloat;
+			results_.push_back(r);
+		}
+
+		/**
+		\brief Time an operation, run in batches long enough to time accurately.
+
+		\param op Does one iteration of the operation.
+		\param bytes The size of the input handled per iteration, if reporting throughput.
+		*/
+		template<typename OpF>
+		void Time(std::string const& family, unsigned size, std::string const& operation, std::string const& precision, OpF op, std::uint64_t bytes = 0)
+		{
+			if (!Wanted(family, size, operation, precision))
+				return;
+
+			// find a batch size which takes at least a millisecond.  these runs also warm up.
+			unsigned batch = 1;
+			while (true)
+			{
+				auto start = Clock::now();
+				for (unsigned ii = 0; ii < batch; ++ii)
+					op();
+				if (SecondsSince(start) > 1e-3 || batch >= (1u<<20))
+					break;
+				batch *= 2;
+			}
+
+			TimeSamples(family, size, operation, precision, [&]()
+				{
+					auto start = Clock::now();
+					for (unsigned ii = 0; ii < batch; ++ii)
+						op();
+					return std::make_pair(SecondsSince(start), batch);
+				}, bytes);
+		}
+
+		std::vector<Result> const& Results() const
+		{
+			return results_;
+		}
+
+	private:
+		static constexpr unsigned max_empty_samples = 100; ///< The number of samples doing no work, after which a benchmark is abandoned.
+
+		double min_seconds_;
+		unsigned min_samples_;
+		std::string filter_;
+		std::vector<Result> results_;
+	};
+
+
+
+	/**
+	\brief Precision-dependent choices for each type of tracker.
+	*/
+	template<class TrackerT>
+	struct TrackerChoices
+	{};
+
+	template<>
+	struct TrackerChoices<DoublePrecisionTracker>
+	{
+		static std::string Label() {return "double";}
+		static unsigned Precision() {return bertini::DoublePrecision();}
+	};
+
+	template<>
+	struct TrackerChoices<MultiplePrecisionTracker>
+	{
+		static std::string Label() {return "multiple30";}
+		static unsigned Precision() {return 30;}
+	};
+
+	template<>
+	struct TrackerChoices<AMPTracker>
+	{
+		static std::string Label() {return "adaptive";}
+		static unsigned Precision() {return bertini::DoublePrecision();}
+	};
+
+
+
+	/**
+	\brief Time evaluation of a system's functions and Jacobian in one precision.
+	*/
+	template<typename CT>
+	void EvaluationBenchmarks(Runner & runner, CorpusSystem const& c, std::string const& precision_label, unsigned precision)
+	{
+		bertini::DefaultPrecision(precision);
+		c.system.precision(precision);
+		auto x = EvaluationPoint<CT>(c.system.NumVariables());
+
+		runner.Time(c.family, c.size, "eval", precision_label, [&]{c.system.Eval(x);});
+		runner.Time(c.family, c.size, "jacobian", precision_label, [&]{c.system.Jacobian(x);});
+	}
+
+
+	void EvaluationBenchmarks(Runner & runner, CorpusSystem const& c)
+	{
+		EvaluationBenchmarks<dbl>(runner, c, "double", bertini::DoublePrecision());
+		EvaluationBenchmarks<mpfr>(runner, c, "multiple30", 30);
+
+		// the AMP tracker changes the precision of the system every time it changes precision
+		runner.Time(c.family, c.size, "precision_change", "multiple30", [&]{
+				c.system.precision(50);
+				c.system.precision(30);
+			});
+	}
+
+
+
+	/**
+	\brief Time stepping, tracking and endgames with one type of tracker on one system.
+	*/
+	template<class TrackerT>
+	void TrackingBenchmarks(Runner & runner, CorpusSystem const& c, unsigned num_paths)
+	{
+		using CT = typename TrackerTraits<TrackerT>::BaseComplexType;
+		using RT = typename TrackerTraits<TrackerT>::BaseRealType;
+		using PrecisionConfig = typename TrackerTraits<TrackerT>::PrecisionConfig;
+		using Choices = TrackerChoices<TrackerT>;
+
+		const auto label = Choices::Label();
+		bool any_wanted = false;
+		for (auto op : {"tracker_step", "track_path", "powerseries_endgame", "cauchy_endgame"})
+			any_wanted = any_wanted || runner.Wanted(c.family, c.size, op, label);
+		if (!any_wanted)
+			return;
+
+		bertini::DefaultPrecision(Choices::Precision());
+		Homotopy h(c.system);
+		h.homotopy.precision(Choices::Precision());
+
+		TrackerT tracker(h.homotopy);
+		tracker.Setup(config::Predictor::HeunEuler,
+		              bertini::NumTraits<RT>::FromString("1e-5"), bertini::NumTraits<RT>::FromString("1e5"),
+		              config::Stepping<RT>(), config::Newton());
+		tracker.PrecisionSetup(PrecisionConfig(h.homotopy));
+
+		num_paths = std::min<unsigned>(num_paths, static_cast<unsigned>(h.start.NumStartPoints()));
+		std::vector<Vec<CT>> start_points;
+		for (unsigned ii = 0; ii < num_paths; ++ii)
+			start_points.push_back(h.start.StartPoint<CT>(ii));
+
+		const CT t_start(1), t_endgame_boundary(0.1);
+
+		unsigned next_path = 0;
+		runner.TimeSamples(c.family, c.size, "tracker_step", label, [&]()
+			{
+				if (!tracker.IsPathInProgress())
+				{
+					bertini::DefaultPrecision(Choices::Precision());
+					tracker.InitializePath(t_start, t_endgame_boundary, start_points[next_path]);
+					next_path = (next_path+1) % start_points.size();
+					if (!tracker.IsPathInProgress())
+						return std::make_pair(0.0, 0u);
+				}
+
+				auto start = Clock::now();
+				auto code = tracker.StepPath(1);
+				auto seconds = SecondsSince(start);
+
+				if (code==SuccessCode::Success)
+				{
+					Vec<CT> discarded;
+					tracker.FinalizePath(discarded);
+				}
+				return std::make_pair(seconds, 1u);
+			});
+
+		std::vector<Vec<CT>> boundary_points;
+		runner.TimeSamples(c.family, c.size, "track_path", label, [&]()
+			{
+				double seconds = 0;
+				for (const auto& s : start_points)
+				{
+					bertini::DefaultPrecision(Choices::Precision());
+					Vec<CT> result;
+					auto start = Clock::now();
+					auto code = tracker.TrackPath(result, t_start, t_endgame_boundary, s);
+					seconds += SecondsSince(start);
+
+					if (code==SuccessCode::Success && boundary_points.size() < start_points.size())
+						boundary_points.push_back(result);
+				}
+				return std::make_pair(seconds, static_cast<unsigned>(start_points.size()));
+			});
+
+		// the endgames need points at the endgame boundary, which the track_path benchmark collects if it ran
+		if (boundary_points.empty())
+			for (const auto& s : start_points)
+			{
+				bertini::DefaultPrecision(Choices::Precision());
+				Vec<CT> result;
+				if (tracker.TrackPath(result, t_start, t_endgame_boundary, s)==SuccessCode::Success)
+					boundary_points.push_back(result);
+			}
+
+		if (boundary_points.empty())
+		{
+			std::cerr << "no paths on " << c.family << "/" << c.size << " reached the endgame boundary with the " << label << " tracker; skipping endgames\n";
+			return;
+		}
+
+		typename EndgameSelector<TrackerT>::PSEG pseg(tracker);
+		runner.TimeSamples(c.family, c.size, "powerseries_endgame", label, [&]()
+			{
+				double seconds = 0;
+				for (const auto& b : boundary_points)
+				{
+					auto start = Clock::now();
+					pseg.Run(t_endgame_boundary, b);
+					seconds += SecondsSince(start);
+				}
+				return std::make_pair(seconds, static_cast<unsigned>(boundary_points.size()));
+			});
+
+		typename EndgameSelector<TrackerT>::Cauchy cauchy(tracker);
+		runner.TimeSamples(c.family, c.size, "cauchy_endgame", label, [&]()
+			{
+				double seconds = 0;
+				for (const auto& b : boundary_points)
+				{
+					auto start = Clock::now();
+					cauchy.Run(t_endgame_boundary, b);
+					seconds += SecondsSince(start);
+				}
+				return std::make_pair(seconds, static_cast<unsigned>(boundary_points.size()));
+			});
+	}
+
+
+
+	/**
+	\brief Make the text of a system of expanded polynomials, in Bertini classic syntax.
+
+	Each term is a random decimal coefficient times a product of up to three random variables, each to a random power up to 3.  The text is the same every time for the same sizes.
+
+	\param num_variables The number of variables.
+	\param num_functions The number of functions.
+	\param num_terms The number of terms in each function.
+	*/
+	std::string ExpandedPolynomialInput(unsigned num_variables, unsigned num_functions, unsigned num_terms)
+	{
+		std::mt19937 engine(num_terms);
+		std::uniform_int_distribution<unsigned> variable(0, num_variables-1), power(1, 3), num_factors(1, 3), digits(0, 999999);
+
+		std::stringstream input;
+		input << "variable_group ";
+		for (unsigned ii = 0; ii < num_variables; ++ii)
+			input << (ii ? ", " : "") << "x" << ii;
+		input << ";\nfunction ";
+		for (unsigned ii = 0; ii < num_functions; ++ii)
+			input << (ii ? ", " : "") << "f" << ii;
+		input << ";\n";
+
+		for (unsigned ii = 0; ii < num_functions; ++ii)
+		{
+			input << "f" << ii << " = ";
+			for (unsigned jj = 0; jj < num_terms; ++jj)
+			{
+				input << (jj ? (digits(engine)%2 ? " + " : " - ") : "") << digits(engine)%10 << "." << digits(engine);
+				for (unsigned kk = num_factors(engine); kk > 0; --kk)
+				{
+					input << "*x" << variable(engine);
+					auto p = power(engine);
+					if (p > 1)
+						input << "^" << p;
+				}
+			}
+			input << ";\n";
+		}
+		return input.str();
+	}
+
+
+	/**
+	\brief Time the startup work for a generated system, parsing and differentiating, on one thread and on all hardware threads.
+	*/
+	void StartupBenchmarks(Runner & runner, unsigned num_terms)
+	{
+		const unsigned num_variables = 10, num_functions = 8;
+		const std::string family = "expanded_polynomial";
+		const unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+		const std::string threads_label = "threads" + std::to_string(num_threads);
+
+		bool any_wanted = false;
+		for (auto op : {"parse", "differentiate"})
+			for (const auto& label : {std::string("serial"), threads_label})
+				any_wanted = any_wanted || runner.Wanted(family, num_terms, op, label);
+		if (!any_wanted)
+			return;
+
+		auto input = ExpandedPolynomialInput(num_variables, num_functions, num_terms);
+
+		runner.Time(family, num_terms, "parse", "serial", [&]{bertini::System sys(input);}, input.size());
+		runner.Time(family, num_terms, "parse", threads_label, [&]{bertini::ParseSystem(input, num_threads);}, input.size());
+
+		bertini::System sys(input);
+		runner.Time(family, num_terms, "differentiate", "serial", [&]{sys.Differentiate();});
+		runner.Time(family, num_terms, "differentiate", threads_label, [&]{sys.Differentiate(num_threads);});
+	}
+
+
+
+	/**
+	\brief Escape a string for inclusion in JSON.
+	*/
+	std::string JsonString(std::string const& s)
+	{
+		std::stringstream out;
+		out << '"';
+		for (char c : s)
+		{
+			switch (c)
+			{
+				case '"': out << "\\\""; break;
+				case '\\': out << "\\\\"; break;
+				case '\n': out << "\\n"; break;
+				case '\t': out << "\\t"; break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20)
+						out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+					else
+						out << c;
+			}
+		}
+		out << '"';
+		return out.str();
+	}
+
+
+	void WriteJson(std::ostream & out, std::vector<Result> const& results, double min_seconds, unsigned num_paths)
+	{
+		out << std::setprecision(9);
+		out << "{\n";
+	#ifdef PACKAGE_VERSION
+		out << "  \"bertini_version\": " << JsonString(PACKAGE_VERSION) << ",\n";
+	#endif
+	#ifdef __VERSION__
+		out << "  \"compiler\": " << JsonString(__VERSION__) << ",\n";
+	#endif
+		out << "  \"telemetry\": " << (bertini::telemetry::Enabled() ? "true" : "false") << ",\n";
+		out << "  \"min_time\": " << min_seconds << ",\n";
+		out << "  \"paths\": " << num_paths << ",\n";
+		out << "  \"results\": [";
+		for (unsigned ii = 0; ii < results.size(); ++ii)
+		{
+			const auto& r = results[ii];
+			out << (ii ? ",\n" : "\n");
+			out << "    {\"name\": " << JsonString(r.Name())
+			    << ", \"family\": " << JsonString(r.family)
+			    << ", \"size\": " << r.size
+			    << ", \"operation\": " << JsonString(r.operation)
+			    << ", \"precision\": " << JsonString(r.precision)
+			    << ", \"iterations\": " << r.iterations
+			    << ", \"total_seconds\": " << r.total_seconds
+			    << ", \"mean_seconds\": " << r.mean_seconds
+			    << ", \"median_seconds\": " << r.median_seconds
+			    << ", \"min_seconds\": " << r.min_seconds;
+			if (r.bytes > 0)
+				out << ", \"bytes\": " << r.bytes
+				    << ", \"bytes_per_second\": " << r.bytes / r.mean_seconds;
+			out << ", \"counters\": {";
+			for (unsigned jj = 0; jj < r.counters.size(); ++jj)
+				out << (jj ? ", " : "") << JsonString(r.counters[jj].first) << ": " << r.counters[jj].second;
+			out << "}}";
+		}
+		out << "\n  ]\n}\n";
+	}
+
+} // re: namespace benchmark
+
+
+
+int main(int argc, char** argv)
+{
+	using namespace benchmark;
+
+	double min_seconds = 1;
+	unsigned min_samples = 3;
+	unsigned num_paths = 4;
+	unsigned max_startup_terms = 100000;
+	std::string filter, output;
+
+	for (int ii = 1; ii < argc; ++ii)
+	{
+		std::string arg(argv[ii]);
+		bool have_value = ii+1 < argc;
+		if (arg=="--quick")
+		{
+			min_seconds = 0.01;
+			min_samples = 1;
+			num_paths = 1;
+			max_startup_terms = 1000;
+		}
+		else if (arg=="--min-time" && have_value)
+			min_seconds = std::stod(argv[++ii]);
+		else if (arg=="--paths" && have_value)
+			num_paths = std::stoul(argv[++ii]);
+		else if (arg=="--filter" && have_value)
+			filter = argv[++ii];
+		else if (arg=="--output" && have_value)
+			output = argv[++ii];
+		else
+		{
+			std::cerr << "usage: b2_benchmark [--quick] [--min-time seconds] [--paths n] [--filter text] [--output file]\n";
+			return 1;
+		}
+	}
+
+	Runner runner(min_seconds, min_samples, filter);
+
+	for (const auto& c : EvaluationCorpus())
+		EvaluationBenchmarks(runner, c);
+
+	for (const auto& c : TrackingCorpus())
+	{
+		TrackingBenchmarks<DoublePrecisionTracker>(runner, c, num_paths);
+		TrackingBenchmarks<MultiplePrecisionTracker>(runner, c, num_paths);
+		TrackingBenchmarks<AMPTracker>(runner, c, num_paths);
+	}
+
+	for (unsigned num_terms = 1000; num_terms <= max_startup_terms; num_terms *= 10)
+		StartupBenchmarks(runner, num_terms);
+
+	if (output.empty())
+		WriteJson(std::cout, runner.Results(), min_seconds, num_paths);
+	else
+	{
+		std::ofstream fout(output);
+		WriteJson(fout, runner.Results(), min_seconds, num_paths);
+	}
+
+	return 0;
+}
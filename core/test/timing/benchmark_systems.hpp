@@ -0,0 +1,285 @@
+//This file is part of Bertini 2.
+//
+//benchmark_systems.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark_systems.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark_systems.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file benchmark_systems.hpp
+
+\brief The fixed corpus of polynomial systems used by b2_benchmark.
+
+Every system is built with the System API, not parsed, so that parsing does not affect the timings, and so that the corpus does not change between versions unless this file does.
+*/
+
+#pragma once
+
+#include "bertini2/system.hpp"
+#include "bertini2/start_system.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+	using System = bertini::System;
+	using Var = std::shared_ptr<bertini::node::Variable>;
+	using Nd = std::shared_ptr<bertini::node::Node>;
+	using VariableGroup = bertini::VariableGroup;
+
+
+	/**
+	\brief A member of the corpus.
+	*/
+	struct CorpusSystem
+	{
+		std::string family; ///< The name of the family, such as "cyclic".
+		unsigned size; ///< The index of the member within the family, usually the number of variables.
+		System system; ///< The system, not homogenized.
+	};
+
+
+	inline
+	VariableGroup MakeVariables(unsigned n)
+	{
+		VariableGroup v;
+		for (unsigned ii = 0; ii < n; ++ii)
+			v.push_back(std::make_shared<bertini::node::Variable>("x" + std::to_string(ii)));
+		return v;
+	}
+
+
+	/**
+	\brief Cyclic n-roots.  \f$\sum_i \prod_{j<k} x_{i+j} = 0\f$ for k = 1, ..., n-1, and \f$\prod_i x_i = 1\f$, with indices mod n.
+	*/
+	inline
+	System Cyclic(unsigned n)
+	{
+		auto x = MakeVariables(n);
+		System sys;
+		sys.AddVariableGroup(x);
+
+		for (unsigned k = 1; k < n; ++k)
+		{
+			Nd f = std::make_shared<bertini::node::Integer>(0);
+			for (unsigned ii = 0; ii < n; ++ii)
+			{
+				Nd term = x[ii];
+				for (unsigned jj = 1; jj < k; ++jj)
+					term = term * x[(ii+jj)%n];
+				f = f + term;
+			}
+			sys.AddFunction(f);
+		}
+
+		Nd product = x[0];
+		for (unsigned ii = 1; ii < n; ++ii)
+			product = product * x[ii];
+		sys.AddFunction(product - 1);
+
+		return sys;
+	}
+
+
+	/**
+	\brief Katsura n, in the n+1 variables \f$x_0, \ldots, x_n\f$.  \f$\sum_{l=-n}^{n} x_{|l|} x_{|m-l|} = x_m\f$ for m = 0, ..., n-1, and \f$x_0 + 2\sum_{i=1}^n x_i = 1\f$, with \f$x_i = 0\f$ for i > n.
+	*/
+	inline
+	System Katsura(unsigned n)
+	{
+		auto x = MakeVariables(n+1);
+		System sys;
+		sys.AddVariableGroup(x);
+
+		for (int m = 0; m < static_cast<int>(n); ++m)
+		{
+			Nd f = -x[m];
+			for (int l = -static_cast<int>(n); l <= static_cast<int>(n); ++l)
+			{
+				int a = std::abs(l), b = std::abs(m-l);
+				if (b <= static_cast<int>(n))
+					f = f + x[a]*x[b];
+			}
+			sys.AddFunction(f);
+		}
+
+		Nd f = x[0] - 1;
+		for (unsigned ii = 1; ii <= n; ++ii)
+			f = f + 2*x[ii];
+		sys.AddFunction(f);
+
+		return sys;
+	}
+
+
+	/**
+	\brief Noon's neural network model.  \f$x_i \sum_{j\neq i} x_j^2 - 1.1 x_i + 1 = 0\f$ for i = 1, ..., n.
+	*/
+	inline
+	System Noon(unsigned n)
+	{
+		auto x = MakeVariables(n);
+		System sys;
+		sys.AddVariableGroup(x);
+
+		auto c = std::make_shared<bertini::node::Rational>("11/10");
+		for (unsigned ii = 0; ii < n; ++ii)
+		{
+			Nd squares = std::make_shared<bertini::node::Integer>(0);
+			for (unsigned jj = 0; jj < n; ++jj)
+				if (jj!=ii)
+					squares = squares + pow(x[jj],2);
+			sys.AddFunction(x[ii]*squares - c*x[ii] + 1);
+		}
+
+		return sys;
+	}
+
+
+	/**
+	\brief Morgan's economics model.  \f$(x_k + \sum_{i=1}^{n-k-1} x_i x_{i+k}) x_n = k\f$ for k = 1, ..., n-1, and \f$\sum_{i=1}^{n-1} x_i + 1 = 0\f$.
+	*/
+	inline
+	System Economics(unsigned n)
+	{
+		auto x = MakeVariables(n);
+		System sys;
+		sys.AddVariableGroup(x);
+
+		// x[ii-1] is x_i in the formula
+		for (unsigned k = 1; k < n; ++k)
+		{
+			Nd f = x[k-1];
+			for (unsigned ii = 1; ii + k < n; ++ii)
+				f = f + x[ii-1]*x[ii+k-1];
+			sys.AddFunction(f*x[n-1] - static_cast<int>(k));
+		}
+
+		Nd f = std::make_shared<bertini::node::Integer>(1);
+		for (unsigned ii = 0; ii + 1 < n; ++ii)
+			f = f + x[ii];
+		sys.AddFunction(f);
+
+		return sys;
+	}
+
+
+	/**
+	\brief A system with a single singular solution at \f$(1, \ldots, 1)\f$, for exercising endgames.  \f$(x_i - 1)^{m_i} + (x_i - 1)(x_{i+1} - 1) = 0\f$, with multiplicities \f$m_i\f$ alternating between 2 and 3, and indices mod n.
+	*/
+	inline
+	System Singular(unsigned n)
+	{
+		auto x = MakeVariables(n);
+		System sys;
+		sys.AddVariableGroup(x);
+
+		for (unsigned ii = 0; ii < n; ++ii)
+			sys.AddFunction(pow(x[ii]-1, static_cast<int>(2 + ii%2)) + (x[ii]-1)*(x[(ii+1)%n]-1));
+
+		return sys;
+	}
+
+
+	/**
+	\brief The systems whose evaluation is timed.
+	*/
+	inline
+	std::vector<CorpusSystem> EvaluationCorpus()
+	{
+		return {
+			{"cyclic", 5, Cyclic(5)},
+			{"cyclic", 7, Cyclic(7)},
+			{"katsura", 5, Katsura(5)},
+			{"katsura", 8, Katsura(8)},
+			{"noon", 4, Noon(4)},
+			{"noon", 6, Noon(6)},
+			{"economics", 5, Economics(5)},
+			{"economics", 8, Economics(8)},
+			{"singular", 4, Singular(4)}
+		};
+	}
+
+
+	/**
+	\brief The systems whose paths are tracked, and on which the endgames are run.  Smaller than the evaluation corpus, so that a full run takes minutes, not hours.
+	*/
+	inline
+	std::vector<CorpusSystem> TrackingCorpus()
+	{
+		return {
+			{"cyclic", 5, Cyclic(5)},
+			{"katsura", 4, Katsura(4)},
+			{"noon", 3, Noon(3)},
+			{"economics", 4, Economics(4)},
+			{"singular", 2, Singular(2)}
+		};
+	}
+
+
+	/**
+	\brief A copy of a system, homogenized and patched.
+	*/
+	inline
+	System HomogenizedAndPatched(System s)
+	{
+		s.Homogenize();
+		s.AutoPatch();
+		return s;
+	}
+
+
+	/**
+	\brief The homogenized total degree homotopy from a start system to a member of the corpus, with path variable t, together with its start system.
+	*/
+	struct Homotopy
+	{
+		System target;
+		bertini::start_system::TotalDegree start;
+		System homotopy;
+
+		Homotopy(System const& s) : target(HomogenizedAndPatched(s)), start(target)
+		{
+			start.Homogenize();
+
+			auto t = std::make_shared<bertini::node::Variable>("t");
+			homotopy = (1-t)*target + t*start;
+			homotopy.AddPathVariable(t);
+		}
+	};
+
+
+	/**
+	\brief A fixed point at which to evaluate a system, so that every run evaluates at the same point.
+	*/
+	template<typename CT>
+	bertini::Vec<CT> EvaluationPoint(unsigned num_variables)
+	{
+		bertini::Vec<CT> v(num_variables);
+		for (unsigned ii = 0; ii < num_variables; ++ii)
+			v(ii) = CT(0.7*std::cos(ii+1.0), 0.6*std::sin(2.0*ii+1.0));
+		return v;
+	}
+
+} // re: namespace benchmark
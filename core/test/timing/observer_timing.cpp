@@ -0,0 +1,167 @@
+//This file is part of Bertini 2.
+//
+//observer_timing.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//observer_timing.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with observer_timing.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file observer_timing.cpp
+
+\brief Times tracking with and without observers attached, to measure the cost of emitting events.
+
+Tracks the same path many times with a DoublePrecisionTracker: with no observers, with an observer which wants no event the tracker emits, and with an observer which wants every event.  The first two should take the same time, as events nobody wants are never built.
+
+Usage: b2_observer_timing [num_paths]
+*/
+
+#include "bertini2/tracking/tracker.hpp"
+
+#include <boost/timer/timer.hpp>
+
+#include <iostream>
+
+
+
+using System = bertini::System;
+using Var = std::shared_ptr<bertini::node::Variable>;
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = bertini::dbl;
+using DoublePrecisionTracker = bertini::tracking::DoublePrecisionTracker;
+using EmitterT = bertini::tracking::TrackerTraits<DoublePrecisionTracker>::EventEmitterType;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+
+
+/**
+\brief Counts the events it receives, wanting the events given at construction.
+*/
+class CountingObserver : public bertini::Observer<DoublePrecisionTracker>
+{
+public:
+	CountingObserver(bertini::EventMask wanted) : wanted_(wanted)
+	{}
+
+	void Observe(bertini::AnyEvent const& e) override
+	{
+		++num_observed_;
+	}
+
+	void Visit(DoublePrecisionTracker const&) override
+	{}
+
+	bertini::EventMask ObservedEvents() const override
+	{
+		return wanted_;
+	}
+
+	unsigned long NumObserved() const
+	{
+		return num_observed_;
+	}
+
+private:
+	bertini::EventMask wanted_;
+	unsigned long num_observed_ = 0;
+};
+
+
+
+/**
+\brief Track the same path many times, returning the elapsed wall time in seconds.
+*/
+double TimeTracking(DoublePrecisionTracker const& tracker, unsigned num_paths)
+{
+	dbl t_start(1), t_end(0);
+	Vec<dbl> start_point(2), end_point;
+	start_point << dbl(1), dbl(1);
+
+	boost::timer::cpu_timer timer;
+	for (unsigned ii = 0; ii < num_paths; ++ii)
+		tracker.TrackPath(end_point, t_start, t_end, start_point);
+	timer.stop();
+
+	return timer.elapsed().wall * 1e-9;
+}
+
+
+
+int main(int argc, char** argv)
+{
+	unsigned num_paths = 1000;
+	if (argc > 1)
+		num_paths = atoi(argv[1]);
+
+	bertini::DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<bertini::node::Variable>("x");
+	Var y = std::make_shared<bertini::node::Variable>("y");
+	Var t = std::make_shared<bertini::node::Variable>("t");
+
+	System sys;
+	VariableGroup v{x,y};
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	config::Stepping<double> stepping_preferences;
+	config::Newton newton_preferences;
+
+	auto setup = [&](DoublePrecisionTracker & tracker)
+	{
+		tracker.Setup(config::Predictor::RK4,
+		              1e-5,
+		              1e5,
+		              stepping_preferences,
+		              newton_preferences);
+	};
+
+	DoublePrecisionTracker unobserved(sys);
+	setup(unobserved);
+
+	// fixed precision trackers never change precision, so this observer is never sent anything
+	CountingObserver uninterested(bertini::EventBits<PrecisionChanged<EmitterT>>());
+	DoublePrecisionTracker observed_uninterested(sys);
+	setup(observed_uninterested);
+	observed_uninterested.AddObserver(&uninterested);
+
+	CountingObserver everything(bertini::AllEvents);
+	DoublePrecisionTracker observed_everything(sys);
+	setup(observed_everything);
+	observed_everything.AddObserver(&everything);
+
+	// warm up
+	TimeTracking(unobserved, 10);
+
+	auto time_unobserved = TimeTracking(unobserved, num_paths);
+	auto time_uninterested = TimeTracking(observed_uninterested, num_paths);
+	auto time_everything = TimeTracking(observed_everything, num_paths);
+
+	std::cout << "tracking " << num_paths << " paths, " << unobserved.NumTotalStepsTaken() << " steps each\n";
+	std::cout << "no observers:                  " << time_unobserved << " s\n";
+	std::cout << "observer wanting no events:    " << time_uninterested << " s, " << uninterested.NumObserved() << " events delivered\n";
+	std::cout << "observer wanting all events:   " << time_everything << " s, " << everything.NumObserved() << " events delivered\n";
+
+	return 0;
+}
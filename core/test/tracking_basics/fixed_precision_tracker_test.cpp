@@ -160,6 +160,67 @@ BOOST_AUTO_TEST_CASE(multiple_100_tracker_track_linear)
 
 
 
+BOOST_AUTO_TEST_CASE(multiple_100_tracker_resumes_after_precision_change)
+{
+	DefaultPrecision(100);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-t);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+
+	bertini::tracking::MultiplePrecisionTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::Euler,
+	              mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	BOOST_CHECK(tracker.InitializePath(t_start, t_end, y_start)==SuccessCode::Success);
+
+	SuccessCode step_code = tracker.StepPath(1);
+	BOOST_CHECK(step_code==SuccessCode::PathInProgress);
+
+	// something else, such as another path, runs at a different precision in between
+	DefaultPrecision(50);
+	sys.precision(50);
+
+	while (step_code==SuccessCode::PathInProgress)
+		step_code = tracker.StepPath(2);
+
+	BOOST_CHECK(step_code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 100);
+	BOOST_CHECK_EQUAL(sys.precision(), 100);
+
+	Vec<mpfr> y_end;
+	tracker.FinalizePath(y_end);
+
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK_EQUAL(Precision(y_end(0)), 100);
+	BOOST_CHECK(abs(y_end(0)-mpfr(0)) < 1e-5);
+}
+
+
 
 
 BOOST_AUTO_TEST_SUITE_END()
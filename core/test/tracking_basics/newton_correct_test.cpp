@@ -780,6 +780,41 @@ BOOST_AUTO_TEST_CASE(circle_line_one_corrector_step_double)
 		BOOST_CHECK(success_code==bertini::tracking::SuccessCode::FailedToConverge);
 	}
 
+	BOOST_AUTO_TEST_CASE(path_derivative_reuses_converged_factorization_double)
+	{
+		Vec<dbl> current_space(2);
+		current_space << dbl(1.3,0.1), dbl(0.4, -0.02);
+		dbl current_time(0.9);
+
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+		VariableGroup vars{x,y};
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+		sys.AddFunction( t*(pow(x,2)-1.0) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+
+		auto corrector = std::make_shared<NewtonCorrector>(sys);
+
+		Vec<dbl> converged;
+		auto success_code = corrector->Correct(converged, sys, current_space, current_time, 1e-13, 1, 20);
+		BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+
+		Vec<dbl> expected = -sys.Jacobian(converged, current_time).lu().solve(sys.TimeDerivative(converged, current_time));
+
+		Vec<dbl> dx_dt;
+		BOOST_CHECK(corrector->PathDerivative(dx_dt, sys, converged, current_time, 1e-10));
+		BOOST_CHECK((dx_dt - expected).norm() < 1e-10);
+
+		// a different point or time must not reuse it
+		BOOST_CHECK(!corrector->PathDerivative(dx_dt, sys, current_space, current_time, 1e-10));
+		BOOST_CHECK(!corrector->PathDerivative(dx_dt, sys, converged, dbl(0.8), 1e-10));
+
+		// nor may it be reused if the final step was too long.  a negative tolerance forces a fresh factorization.
+		BOOST_CHECK(!corrector->PathDerivative(dx_dt, sys, converged, current_time, -1.0));
+		BOOST_CHECK((dx_dt - expected).norm() < threshold_clearance_d);
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
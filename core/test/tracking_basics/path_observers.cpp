@@ -230,6 +230,117 @@ BOOST_AUTO_TEST_CASE(union_of_observers)
 
 
 
+/**
+An observable which emits one of each of a few tracking events when asked, for testing filtering.
+*/
+class Beeper : public bertini::Observable<>
+{
+public:
+	ReturnType Accept(bertini::VisitorBase& guest) override
+	{ return AcceptBase(*this, guest); }
+
+	void Beep() const
+	{
+		Emit<bertini::tracking::SuccessfulStep<Beeper>>(*this);
+		Emit<bertini::tracking::FailedStep<Beeper>>(*this);
+		Emit<bertini::tracking::PredictorMatrixSolveFailure<Beeper>>(*this);
+	}
+};
+
+/**
+Counts the events it receives, and wants only the events given to it at construction.
+*/
+class CountingObserver : public bertini::Observer<Beeper>
+{
+public:
+	CountingObserver(bertini::EventMask wanted) : wanted_(wanted)
+	{}
+
+	void Observe(bertini::AnyEvent const& e) override
+	{
+		++num_observed_;
+	}
+
+	void Visit(Beeper const&) override
+	{}
+
+	bertini::EventMask ObservedEvents() const override
+	{
+		return wanted_;
+	}
+
+	unsigned NumObserved() const
+	{
+		return num_observed_;
+	}
+
+private:
+	bertini::EventMask wanted_;
+	unsigned num_observed_ = 0;
+};
+
+
+BOOST_AUTO_TEST_CASE(event_masks_follow_hierarchy)
+{
+	using namespace bertini::tracking;
+	using bertini::EventBits;
+
+	BOOST_CHECK(SuccessfulStep<Beeper>::Mask & EventBits<TrackingEvent<Beeper>>());
+	BOOST_CHECK(PredictorMatrixSolveFailure<Beeper>::Mask & EventBits<MatrixSolveFailure<Beeper>>());
+	BOOST_CHECK(PredictorMatrixSolveFailure<Beeper>::Mask & EventBits<PrecisionEvent<Beeper>>());
+	BOOST_CHECK(!(SuccessfulStep<Beeper>::Mask & EventBits<FailedStep<Beeper>>()));
+	BOOST_CHECK(!(PredictorMatrixSolveFailure<Beeper>::Mask & EventBits<CorrectorMatrixSolveFailure<Beeper>>()));
+	BOOST_CHECK(SuccessfulPredict<Beeper,dbl>::Mask & EventBits<SuccessfulPredict<Beeper,mpfr>>());
+}
+
+
+BOOST_AUTO_TEST_CASE(observers_receive_only_wanted_events)
+{
+	using namespace bertini::tracking;
+	using bertini::EventBits;
+
+	Beeper beeper;
+	BOOST_CHECK(!beeper.IsObserved<SuccessfulStep<Beeper>>());
+	beeper.Beep(); // no observers, nothing built
+
+	CountingObserver steps(EventBits<SuccessfulStep<Beeper>, FailedStep<Beeper>>());
+	CountingObserver precision(EventBits<PrecisionEvent<Beeper>>());
+	CountingObserver everything(bertini::AllEvents);
+	CountingObserver nothing(0);
+
+	beeper.AddObserver(&steps);
+	beeper.AddObserver(&precision);
+	beeper.AddObserver(&everything);
+	beeper.AddObserver(&nothing);
+
+	BOOST_CHECK(beeper.IsObserved<SuccessfulStep<Beeper>>());
+	BOOST_CHECK(beeper.IsObserved<CorrectorMatrixSolveFailure<Beeper>>());
+	BOOST_CHECK(beeper.IsObserved<StepsizeIncreased<Beeper>>()); // because of everything
+
+	beeper.Beep();
+
+	BOOST_CHECK_EQUAL(steps.NumObserved(), 2);
+	BOOST_CHECK_EQUAL(precision.NumObserved(), 1);
+	BOOST_CHECK_EQUAL(everything.NumObserved(), 3);
+	BOOST_CHECK_EQUAL(nothing.NumObserved(), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE(is_observed_reflects_wanted_events)
+{
+	using namespace bertini::tracking;
+
+	Beeper beeper;
+	CountingObserver steps(bertini::EventBits<SuccessfulStep<Beeper>>());
+	beeper.AddObserver(&steps);
+
+	BOOST_CHECK(!beeper.IsObserved<FailedStep<Beeper>>());
+	BOOST_CHECK(!beeper.IsObserved<PrecisionChanged<Beeper>>());
+	BOOST_CHECK(!beeper.IsObserved<Initializing<Beeper,dbl>>());
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,136 @@
+//This file is part of Bertini 2.
+//
+//ring_buffer_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//ring_buffer_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with ring_buffer_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/tracking_config.hpp"
+
+
+using dbl = std::complex<double>;
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::tracking::RingBuffer;
+
+
+BOOST_AUTO_TEST_SUITE(ring_buffer)
+
+
+BOOST_AUTO_TEST_CASE(push_pop_keeps_order)
+{
+	RingBuffer<int> b;
+	for (int ii = 0; ii < 10; ++ii)
+		b.push_back(ii);
+
+	BOOST_CHECK_EQUAL(b.size(), 10);
+	BOOST_CHECK_EQUAL(b.front(), 0);
+	BOOST_CHECK_EQUAL(b.back(), 9);
+
+	b.pop_front(); b.pop_front(); b.pop_back();
+	BOOST_CHECK_EQUAL(b.size(), 7);
+	for (unsigned ii = 0; ii < b.size(); ++ii)
+		BOOST_CHECK_EQUAL(b[ii], ii+2);
+
+	int expected = 2;
+	for (const auto& x : b)
+		BOOST_CHECK_EQUAL(x, expected++);
+}
+
+
+BOOST_AUTO_TEST_CASE(sliding_window_does_not_grow)
+{
+	RingBuffer<int> b;
+	for (int ii = 0; ii < 4; ++ii)
+		b.push_back(ii);
+	b.push_back(4); b.pop_front();
+
+	auto capacity = b.capacity();
+	for (int ii = 5; ii < 100; ++ii)
+	{
+		b.push_back(ii);
+		b.pop_front();
+	}
+
+	BOOST_CHECK_EQUAL(b.capacity(), capacity);
+	BOOST_CHECK_EQUAL(b.size(), 4);
+	for (unsigned ii = 0; ii < 4; ++ii)
+		BOOST_CHECK_EQUAL(b[ii], 96+ii);
+}
+
+
+BOOST_AUTO_TEST_CASE(clear_keeps_storage)
+{
+	RingBuffer<Vec<dbl>> b;
+	for (int ii = 0; ii < 5; ++ii)
+		b.push_back(Vec<dbl>::Constant(3, dbl(ii)));
+
+	auto capacity = b.capacity();
+	b.clear();
+	BOOST_CHECK(b.empty());
+	BOOST_CHECK_EQUAL(b.capacity(), capacity);
+
+	auto& v = b.extend_back();
+	BOOST_CHECK_EQUAL(v.size(), 3);
+	BOOST_CHECK_EQUAL(b.size(), 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(push_back_own_element_while_growing)
+{
+	RingBuffer<Vec<dbl>> b;
+	b.push_back(Vec<dbl>::Constant(2, dbl(1)));
+	while (b.size() < b.capacity())
+		b.push_back(b.back());
+
+	b.push_back(b.front());
+	BOOST_CHECK_EQUAL(b.back().size(), 2);
+	BOOST_CHECK_EQUAL(b.back()(0), dbl(1));
+}
+
+
+BOOST_AUTO_TEST_CASE(copy_has_same_elements)
+{
+	RingBuffer<int> a;
+	for (int ii = 0; ii < 6; ++ii)
+		a.push_back(ii);
+	a.pop_front();
+
+	RingBuffer<int> b(a);
+	RingBuffer<int> c;
+	c.push_back(17);
+	c = a;
+
+	BOOST_CHECK_EQUAL(b.size(), 5);
+	BOOST_CHECK_EQUAL(c.size(), 5);
+	for (unsigned ii = 0; ii < 5; ++ii)
+	{
+		BOOST_CHECK_EQUAL(b[ii], ii+1);
+		BOOST_CHECK_EQUAL(c[ii], ii+1);
+	}
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -28,6 +28,7 @@
 #include <boost/test/unit_test.hpp>
 #include "start_system.hpp"
 #include "tracking/tracker.hpp"
+#include "tracking/resumable_path.hpp"
 
 using System = bertini::System;
 using Variable = bertini::node::Variable;
@@ -535,7 +536,7 @@ BOOST_AUTO_TEST_CASE(AMP_simple_nonhomogeneous_system_trackable_initialprecision
 	tracking_success = tracker.TrackPath(end_point,
 	                  t_start, t_end, start_point);
 
-	mpfr_float::default_precision(40);
+	DefaultPrecision(40);
 
 	Vec<mpfr> true_solution(2);
 	true_solution <<  mpfr("0.61803398874989484820458683436563811772030918"), mpfr("1.13856426511017256414753784441721594451116198");
@@ -919,6 +920,133 @@ BOOST_AUTO_TEST_CASE(AMP_track_TD_functionalized)
 }
 
 
+
+BOOST_AUTO_TEST_CASE(AMP_tracker_step_path_in_pieces)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,2));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_end_whole;
+	SuccessCode whole_code = tracker.TrackPath(y_end_whole, t_start, t_end, y_start);
+	unsigned num_steps_whole = tracker.NumTotalStepsTaken();
+
+	BOOST_CHECK(tracker.InitializePath(t_start, t_end, y_start)==SuccessCode::Success);
+	BOOST_CHECK(tracker.IsPathInProgress());
+
+	SuccessCode step_code = tracker.StepPath(1);
+	BOOST_CHECK(step_code==SuccessCode::PathInProgress);
+	BOOST_CHECK_EQUAL(tracker.NumTotalStepsTaken(), 1);
+
+	while (step_code==SuccessCode::PathInProgress)
+		step_code = tracker.StepPath(3);
+
+	BOOST_CHECK(step_code==whole_code);
+
+	Vec<mpfr> y_end_pieces;
+	tracker.FinalizePath(y_end_pieces);
+	BOOST_CHECK(!tracker.IsPathInProgress());
+
+	BOOST_CHECK_EQUAL(tracker.NumTotalStepsTaken(), num_steps_whole);
+	BOOST_CHECK_EQUAL(y_end_pieces.size(),1);
+	BOOST_CHECK(abs(y_end_pieces(0)-y_end_whole(0)) < 1e-20);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(AMP_tracker_interleaved_resumable_paths)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(pow(y,2)-(1+t));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+
+	Vec<mpfr> y_start_1(1), y_start_2(1);
+	y_start_1 << sqrt(mpfr(2));
+	y_start_2 << -sqrt(mpfr(2));
+
+	std::vector<ResumablePath<AMPTracker>> paths;
+	paths.emplace_back(tracker, t_start, t_end, y_start_1);
+	paths.emplace_back(tracker, t_start, t_end, y_start_2);
+
+	BOOST_CHECK_EQUAL(paths[0].NumTotalStepsTaken(), 0);
+
+	bool any_in_progress = true;
+	while (any_in_progress)
+	{
+		any_in_progress = false;
+		for (auto& p : paths)
+			if (p.Advance(2)==SuccessCode::PathInProgress)
+				any_in_progress = true;
+	}
+
+	BOOST_CHECK(paths[0].Status()==SuccessCode::Success);
+	BOOST_CHECK(paths[1].Status()==SuccessCode::Success);
+	BOOST_CHECK(paths[0].NumTotalStepsTaken()>0);
+
+	BOOST_CHECK(abs(paths[0].Solution()(0)-mpfr(1)) < 1e-5);
+	BOOST_CHECK(abs(paths[1].Solution()(0)-mpfr(-1)) < 1e-5);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
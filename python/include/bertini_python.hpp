@@ -40,6 +40,7 @@
 #include "parser_export.hpp"
 #include "tracker_export.hpp"
 #include "endgame_export.hpp"
+#include "telemetry_export.hpp"
 
 #endif
 
@@ -83,6 +83,10 @@ namespace bertini{
 			void (bertini::System::*set_prec_)(unsigned) const = &bertini::System::precision;
 			unsigned (bertini::System::*get_prec_)(void) const = &bertini::System::precision;
 
+			// differentiation, on one thread or several
+			void (bertini::System::*differentiate_)() const = &bertini::System::Differentiate;
+			void (bertini::System::*differentiate_threads_)(unsigned) const = &bertini::System::Differentiate;
+
 			void (bertini::System::*sysAddFunc1)(std::shared_ptr<node::Function> const&) = &bertini::System::AddFunction;
 			void (bertini::System::*sysAddFunc2)(std::shared_ptr<node::Node> const&) = &bertini::System::AddFunction;
 			
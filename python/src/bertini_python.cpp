@@ -74,6 +74,8 @@ namespace bertini
 			ExportTrackers();
 
 			ExportEndgames();
+
+			ExportTelemetry();
 		}
 	
 	}
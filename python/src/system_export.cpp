@@ -55,7 +55,9 @@ namespace bertini{
 			cl
 			.def("precision", get_prec_)
 			.def("precision", set_prec_)
-			.def("differentiate", &SystemBaseT::Differentiate)
+			.def("differentiate", differentiate_)
+			.def("differentiate", differentiate_threads_, "differentiate the functions of the system on a number of threads")
+			.def("clone", &SystemBaseT::Clone, "make a deep copy of the system, sharing no nodes with it, for evaluating on another thread.")
 
 			.def("eval", return_Eval0_ptr<dbl>() ,"evaluate the system in double precision, using already-set variable values.")
 			.def("eval", return_Eval0_ptr<mpfr>() ,"evaluate the system in multiple precision, using already-set variable values.")
@@ -0,0 +1,89 @@
+//This file is part of Bertini 2.
+//
+//python/telemetry_export.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//python/telemetry_export.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with python/telemetry_export.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+//
+//  Daniel Brake
+//  University of Notre Dame
+//
+//
+//  python/telemetry_export.cpp:  source file for exposing the telemetry counters to python.
+
+#include "telemetry_export.hpp"
+
+namespace bertini{
+	namespace python{
+
+		void ExportTelemetry()
+		{
+			scope current_scope;
+			std::string new_submodule_name(extract<const char*>(current_scope.attr("__name__")));
+			new_submodule_name.append(".telemetry");
+			object new_submodule(borrowed(PyImport_AddModule(new_submodule_name.c_str())));
+			current_scope.attr("telemetry") = new_submodule;
+
+			scope new_submodule_scope = new_submodule;
+
+			using telemetry::Counter;
+			using telemetry::Phase;
+			using telemetry::Snapshot;
+
+			enum_<Counter>("Counter")
+				.value("SystemEvaluationsDouble", Counter::SystemEvaluationsDouble)
+				.value("SystemEvaluationsMultiple", Counter::SystemEvaluationsMultiple)
+				.value("JacobianEvaluationsDouble", Counter::JacobianEvaluationsDouble)
+				.value("JacobianEvaluationsMultiple", Counter::JacobianEvaluationsMultiple)
+				.value("LUFactorizations", Counter::LUFactorizations)
+				.value("LinearSolves", Counter::LinearSolves)
+				.value("NewtonIterations", Counter::NewtonIterations)
+				.value("PredictorStages", Counter::PredictorStages)
+				.value("PrecisionIncreases", Counter::PrecisionIncreases)
+				.value("PrecisionDecreases", Counter::PrecisionDecreases)
+				.value("EndgameSamples", Counter::EndgameSamples)
+				.value("EndgameLoopClosures", Counter::EndgameLoopClosures)
+				;
+
+			enum_<Phase>("Phase")
+				.value("Tracking", Phase::Tracking)
+				.value("Prediction", Phase::Prediction)
+				.value("Correction", Phase::Correction)
+				.value("Endgame", Phase::Endgame)
+				;
+
+			class_<Snapshot>("Snapshot", init<>())
+				.def("count", &Snapshot::Count)
+				.def("seconds", &Snapshot::Seconds)
+				.def("entries", &Snapshot::Entries)
+				.def(self - self)
+				;
+
+			const char* (*counter_name)(Counter) = &telemetry::Name;
+			const char* (*phase_name)(Phase) = &telemetry::Name;
+			def("name", counter_name);
+			def("name", phase_name);
+
+			def("take_snapshot", &telemetry::TakeSnapshot);
+			def("reset", &telemetry::Reset);
+			def("enabled", &telemetry::Enabled);
+		}
+
+}}// re: namespaces
+
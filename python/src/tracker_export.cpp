@@ -203,6 +203,7 @@ namespace bertini{
 				.value("MinTrackTimeReached", SuccessCode::MinTrackTimeReached)
 				.value("SecurityMaxNormReached", SuccessCode::SecurityMaxNormReached)
 				.value("CycleNumTooHigh", SuccessCode::CycleNumTooHigh)
+				.value("PathInProgress", SuccessCode::PathInProgress)
 				;
 			
 			{ // enter a scope for config types
@@ -0,0 +1,69 @@
+# This file is part of Bertini 2.
+# 
+# python/test/telemetry_test.py is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# python/test/telemetry_test.py is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with python/test/telemetry_test.py.  If not, see <http://www.gnu.org/licenses/>.
+# 
+#  Copyright(C) 2016 by Bertini2 Development Team
+# 
+#  See <http://www.gnu.org/licenses/> for a copy of the license, 
+#  as well as COPYING.  Bertini2 is provided with permitted 
+#  additional terms in the b2/licenses/ directory.
+
+#  individual authors of this file include:
+# 
+#   Daniel Brake
+#   University of Notre Dame
+# 
+
+
+from pybertini import *
+from pybertini.function_tree.symbol import *
+from pybertini.function_tree import *
+from pybertini import telemetry
+import unittest
+
+
+class TelemetryTest(unittest.TestCase):
+    def setUp(self):
+        self.x = Variable("x");
+        self.y = Variable("y");
+        #
+        self.s = System();
+        self.s.add_ungrouped_variable(self.x);
+        self.s.add_ungrouped_variable(self.y);
+        self.s.add_function(Function(self.x*self.y));
+
+    def test_system_evaluations_counted(self):
+        if not telemetry.enabled():
+            return
+        v = VectorXd.Zero(2);
+        before = telemetry.take_snapshot();
+        self.s.eval(v)
+        self.s.eval(v)
+        used = telemetry.take_snapshot() - before;
+        self.assertEqual(used.count(telemetry.Counter.SystemEvaluationsDouble), 2)
+        self.assertEqual(used.count(telemetry.Counter.SystemEvaluationsMultiple), 0)
+
+    def test_reset(self):
+        v = VectorXd.Zero(2);
+        self.s.eval(v)
+        telemetry.reset()
+        self.assertEqual(telemetry.take_snapshot().count(telemetry.Counter.SystemEvaluationsDouble), 0)
+
+    def test_names(self):
+        self.assertEqual(telemetry.name(telemetry.Counter.NewtonIterations), "newton_iterations")
+        self.assertEqual(telemetry.name(telemetry.Phase.Tracking), "tracking")
+
+
+if __name__ == '__main__':
+    unittest.main();
@@ -31,13 +31,14 @@ import function_tree_test
 import differentiation_test
 import system_test
 import parser_test
+import telemetry_test
 
 import unittest
 
 
 
 
-mods = (mpfr_test, function_tree_test, differentiation_test, system_test, parser_test)
+mods = (mpfr_test, function_tree_test, differentiation_test, system_test, parser_test, telemetry_test)
 suite = unittest.TestSuite();
 print mods
 for tests in mods: